@@ -0,0 +1,104 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <rsc/misc/Clock.h>
+#include <rsc/misc/langutils.h>
+
+using namespace std;
+using namespace rsc::misc;
+
+/**
+ * Adapters for clocks without a matching signature.
+ */
+boost::uint64_t posixTime() {
+    return boost::posix_time::microsec_clock::universal_time().time_of_day()
+            .total_microseconds();
+}
+
+boost::uint64_t cycleClock() {
+    return CycleClock::now();
+}
+
+/**
+ * Calls a clock function a number of times.
+ *
+ * @return average duration of a call in nanoseconds
+ */
+double benchmark(boost::uint64_t (*clock)(), const boost::uint64_t& calls) {
+
+    // accumulate the results so that the calls cannot be optimized away
+    boost::uint64_t sum = 0;
+    const boost::uint64_t start = monotonicNanos();
+    for (boost::uint64_t i = 0; i < calls; ++i) {
+        sum += clock();
+    }
+    const boost::uint64_t duration = monotonicNanos() - start;
+    if (sum == 0) {
+        cerr << "Clock did not advance" << endl;
+    }
+    return (double) duration / (double) calls;
+
+}
+
+int main(int argc, char** argv) {
+
+    boost::uint64_t calls = 10000000;
+    if (argc > 1) {
+        calls = strtoull(argv[1], NULL, 10);
+    }
+
+    // calibrate the cycle clock outside of the measurement
+    cout << "Calls per clock: " << calls << endl;
+    cout << "Cycle counter used: "
+            << (CycleClock::isCycleCounterUsed() ? "yes" : "no") << " ("
+            << setprecision(4) << CycleClock::getNanosPerCycle()
+            << " ns/cycle)" << endl;
+
+    const string names[] = { "currentTimeMillis", "currentTimeMicros",
+            "posix_time::microsec_clock", "coarseTimeMillis",
+            "coarseMonotonicMillis", "monotonicNanos", "CycleClock::now" };
+    boost::uint64_t (*clocks[])() = { &currentTimeMillis, &currentTimeMicros,
+            &posixTime, &coarseTimeMillis, &coarseMonotonicMillis,
+            &monotonicNanos, &cycleClock };
+
+    cout << setw(28) << "clock" << setw(14) << "ns/call" << endl;
+    for (unsigned int i = 0; i < sizeof(clocks) / sizeof(clocks[0]); ++i) {
+        cout << setw(28) << names[i] << setw(14) << fixed << setprecision(2)
+                << benchmark(clocks[i], calls) << endl;
+    }
+
+    return EXIT_SUCCESS;
+
+}
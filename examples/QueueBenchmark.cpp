@@ -0,0 +1,140 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/ptr_container/ptr_vector.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <rsc/misc/langutils.h>
+#include <rsc/threading/SPSCQueue.h>
+#include <rsc/threading/SynchronizedQueue.h>
+
+using namespace std;
+using namespace rsc::misc;
+using namespace rsc::threading;
+
+/**
+ * Pushes a number of messages on a queue.
+ */
+template<class Q>
+void produce(Q* queue, const boost::uint64_t& messages) {
+    for (boost::uint64_t i = 0; i < messages; ++i) {
+        queue->push(i);
+    }
+}
+
+/**
+ * Pops a number of messages from a queue, blocking if required.
+ */
+template<class Q>
+void consume(Q* queue, const boost::uint64_t& messages) {
+    boost::uint64_t sum = 0;
+    for (boost::uint64_t i = 0; i < messages; ++i) {
+        sum += queue->pop();
+    }
+    if (sum != messages * (messages - 1) / 2) {
+        cerr << "Lost or corrupted messages" << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Runs the benchmark with the given number of threads. A single thread
+ * alternately pushes and pops. Otherwise threads / 2 independent
+ * producer/consumer pairs are used, each one with its own queue because an
+ * SPSCQueue only permits a single producer and consumer.
+ *
+ * @return throughput in messages per second over all queues
+ */
+template<class Q>
+double benchmark(const unsigned int& threads,
+        const boost::uint64_t& messages) {
+
+    const unsigned int pairs = threads / 2 > 0 ? threads / 2 : 1;
+    boost::ptr_vector<Q> queues;
+    for (unsigned int i = 0; i < pairs; ++i) {
+        queues.push_back(new Q);
+    }
+
+    const boost::uint64_t start = currentTimeMicros();
+
+    if (threads == 1) {
+        Q& queue = queues[0];
+        for (boost::uint64_t i = 0; i < messages; ++i) {
+            queue.push(i);
+            queue.pop();
+        }
+    } else {
+        boost::thread_group group;
+        for (unsigned int i = 0; i < pairs; ++i) {
+            group.create_thread(
+                    boost::bind(&consume<Q>, &queues[i], messages));
+            group.create_thread(
+                    boost::bind(&produce<Q>, &queues[i], messages));
+        }
+        group.join_all();
+    }
+
+    const boost::uint64_t duration = currentTimeMicros() - start;
+    return (double) (messages * pairs) * 1000000.0
+            / (double) (duration > 0 ? duration : 1);
+
+}
+
+int main(int argc, char** argv) {
+
+    boost::uint64_t messages = 1000000;
+    if (argc > 1) {
+        messages = strtoull(argv[1], NULL, 10);
+    }
+
+    cout << "Messages per producer: " << messages << endl;
+    cout << setw(8) << "threads" << setw(22) << "SynchronizedQueue"
+            << setw(22) << "SPSCQueue" << setw(10) << "speedup" << endl;
+
+    const unsigned int threadCounts[] = { 1, 2, 8 };
+    for (unsigned int i = 0; i < sizeof(threadCounts) / sizeof(unsigned int);
+            ++i) {
+        const double synchronized = benchmark<
+                SynchronizedQueue<boost::uint64_t> >(threadCounts[i], messages);
+        const double spsc = benchmark<SPSCQueue<boost::uint64_t> >(
+                threadCounts[i], messages);
+        cout << setw(8) << threadCounts[i] << setw(16) << fixed
+                << setprecision(0) << synchronized << " msg/s" << setw(16)
+                << spsc << " msg/s" << setw(9) << setprecision(2)
+                << spsc / synchronized << "x" << endl;
+    }
+
+    return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,314 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ConfigCache.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "MappedFile.h"
+
+using namespace std;
+
+namespace rsc {
+namespace config {
+
+namespace {
+
+/**
+ * 64 bit FNV-1a hash.
+ */
+boost::uint64_t hashBytes(const char* begin, const char* end) {
+    boost::uint64_t hash = 14695981039346656037ull;
+    for (; begin != end; ++begin) {
+        hash ^= (unsigned char) *begin;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+boost::uint64_t hashFile(const boost::filesystem::path& source) {
+    MappedFile contents(source);
+    return hashBytes(contents.begin(), contents.end());
+}
+
+/**
+ * Properties of a source file which are compared cheaply before comparing
+ * the content hash.
+ */
+struct SourceStamp {
+
+    SourceStamp() :
+        exists(false), size(0), modified(0) {
+    }
+
+    explicit SourceStamp(const boost::filesystem::path& source) :
+        exists(false), size(0), modified(0) {
+        boost::system::error_code error;
+        if (!boost::filesystem::is_regular_file(source, error) || error) {
+            return;
+        }
+        size = boost::filesystem::file_size(source, error);
+        if (error) {
+            return;
+        }
+        modified = boost::filesystem::last_write_time(source, error);
+        if (error) {
+            return;
+        }
+        exists = true;
+    }
+
+    bool exists;
+    boost::uint64_t size;
+    boost::int64_t modified;
+
+};
+
+template<class T>
+void append(string& block, const T& value) {
+    block.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendString(string& block, const string& value) {
+    append(block, (boost::uint32_t) value.size());
+    block.append(value);
+}
+
+/**
+ * Reads values from a cache in memory.
+ */
+class Reader {
+public:
+
+    Reader(const char* begin, const char* end) :
+        next(begin), end(end) {
+    }
+
+    template<class T>
+    T read() {
+        if ((size_t) (end - next) < sizeof(T)) {
+            throw runtime_error("Configuration cache is truncated.");
+        }
+        T value;
+        memcpy(&value, next, sizeof(T));
+        next += sizeof(T);
+        return value;
+    }
+
+    void readString(string& value) {
+        const boost::uint32_t size = read<boost::uint32_t>();
+        if ((size_t) (end - next) < size) {
+            throw runtime_error("Configuration cache is truncated.");
+        }
+        value.assign(next, size);
+        next += size;
+    }
+
+    const char* position() const {
+        return next;
+    }
+
+private:
+
+    const char* next;
+    const char* end;
+
+};
+
+/**
+ * Validates the cache contents against the current sources and decodes the
+ * options.
+ */
+bool decode(const MappedFile&                           contents,
+            const vector<boost::filesystem::path>&      sources,
+            ConfigCache::Options&                       options) {
+
+    if (contents.size() < sizeof(ConfigCache::MAGIC)
+        || !equal(ConfigCache::MAGIC,
+                  ConfigCache::MAGIC + sizeof(ConfigCache::MAGIC),
+                  contents.begin())) {
+        return false;
+    }
+
+    Reader reader(contents.begin() + sizeof(ConfigCache::MAGIC),
+                  contents.end());
+    if (reader.read<boost::uint32_t>() != ConfigCache::VERSION
+        || reader.read<boost::uint32_t>() != ConfigCache::BYTE_ORDER_MARK) {
+        return false;
+    }
+    const boost::uint64_t checksum = reader.read<boost::uint64_t>();
+    if (checksum != hashBytes(reader.position(), contents.end())) {
+        return false;
+    }
+
+    if (reader.read<boost::uint32_t>() != sources.size()) {
+        return false;
+    }
+    string path;
+    for (vector<boost::filesystem::path>::const_iterator it = sources.begin();
+         it != sources.end(); ++it) {
+        reader.readString(path);
+        SourceStamp cached;
+        cached.exists   = reader.read<boost::uint8_t>() != 0;
+        cached.size     = reader.read<boost::uint64_t>();
+        cached.modified = reader.read<boost::int64_t>();
+        const boost::uint64_t hash = reader.read<boost::uint64_t>();
+
+        if (path != it->string()) {
+            return false;
+        }
+        const SourceStamp current(*it);
+        if (current.exists != cached.exists) {
+            return false;
+        }
+        if (current.exists
+            && (current.size != cached.size
+                || current.modified != cached.modified
+                || hashFile(*it) != hash)) {
+            return false;
+        }
+    }
+
+    const boost::uint32_t count = reader.read<boost::uint32_t>();
+    options.resize(count);
+    for (ConfigCache::Options::iterator it = options.begin();
+         it != options.end(); ++it) {
+        it->first.resize(reader.read<boost::uint32_t>());
+        for (vector<string>::iterator componentIt = it->first.begin();
+             componentIt != it->first.end(); ++componentIt) {
+            reader.readString(*componentIt);
+        }
+        reader.readString(it->second);
+    }
+    return true;
+
+}
+
+}
+
+const char ConfigCache::MAGIC[8] = { 'R', 'S', 'C', 'C', 'O', 'N', 'F', '\n' };
+const boost::uint32_t ConfigCache::VERSION = 1;
+const boost::uint32_t ConfigCache::BYTE_ORDER_MARK = 0x01020304;
+
+ConfigCache::ConfigCache(const boost::filesystem::path& file) :
+    file(file), created(time(0)) {
+}
+
+bool ConfigCache::replay(const vector<boost::filesystem::path>& sources,
+                         OptionHandler&                         handler) const {
+    Options options;
+    try {
+        // the cache is only ever replaced by renaming
+        MappedFile contents(file, MappedFile::MAP);
+        if (!decode(contents, sources, options)) {
+            return false;
+        }
+    } catch (const runtime_error&) {
+        // missing or truncated cache or unreadable source
+        return false;
+    }
+
+    for (Options::const_iterator it = options.begin(); it != options.end();
+         ++it) {
+        handler.handleOption(it->first, it->second);
+    }
+    return true;
+}
+
+bool ConfigCache::store(const vector<boost::filesystem::path>& sources,
+                        const Options&                         options) const {
+
+    string body;
+    append(body, (boost::uint32_t) sources.size());
+    for (vector<boost::filesystem::path>::const_iterator it = sources.begin();
+         it != sources.end(); ++it) {
+        const SourceStamp stamp(*it);
+        // the options might stem from an older version of the file
+        if (stamp.exists && stamp.modified >= (boost::int64_t) created - 1) {
+            return false;
+        }
+        appendString(body, it->string());
+        append(body, (boost::uint8_t) stamp.exists);
+        append(body, stamp.size);
+        append(body, stamp.modified);
+        append(body, stamp.exists ? hashFile(*it) : (boost::uint64_t) 0);
+    }
+    append(body, (boost::uint32_t) options.size());
+    for (Options::const_iterator it = options.begin(); it != options.end();
+         ++it) {
+        append(body, (boost::uint32_t) it->first.size());
+        for (vector<string>::const_iterator componentIt = it->first.begin();
+             componentIt != it->first.end(); ++componentIt) {
+            appendString(body, *componentIt);
+        }
+        appendString(body, it->second);
+    }
+
+    string header(MAGIC, sizeof(MAGIC));
+    append(header, VERSION);
+    append(header, BYTE_ORDER_MARK);
+    append(header, hashBytes(body.data(), body.data() + body.size()));
+
+    // readers must never see a partially written cache
+    const boost::filesystem::path temporary = file.parent_path()
+        / boost::filesystem::unique_path(file.filename().string()
+                                         + ".%%%%-%%%%-%%%%");
+    boost::system::error_code error;
+    {
+        boost::filesystem::ofstream stream(temporary,
+                                           ios::out | ios::binary | ios::trunc);
+        stream.write(header.data(), header.size());
+        stream.write(body.data(), body.size());
+        stream.close();
+        if (!stream) {
+            boost::filesystem::remove(temporary, error);
+            throw runtime_error("Unable to write configuration cache "
+                                + temporary.string());
+        }
+    }
+    boost::filesystem::rename(temporary, file, error);
+    if (error) {
+        boost::system::error_code ignored;
+        boost::filesystem::remove(temporary, ignored);
+        throw runtime_error("Unable to replace configuration cache "
+                            + file.string() + ": " + error.message());
+    }
+    return true;
+
+}
+
+const boost::filesystem::path& ConfigCache::getFile() const {
+    return file;
+}
+
+}
+}
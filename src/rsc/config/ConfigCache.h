@@ -0,0 +1,122 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include "OptionHandler.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace config {
+
+/**
+ * A compiled cache of the options provided by a list of configuration files.
+ * The cache stores the options in the order in which they were passed to an
+ * OptionHandler together with the size, modification time and a content hash
+ * of each source file. As long as none of the source files changed, the
+ * options can be replayed into a handler without parsing any file.
+ *
+ * Source files modified less than a second before the cache object was
+ * created are never stored, because their modification time cannot tell
+ * whether the options were parsed from the current version of the file.
+ *
+ * The cache file is written to a temporary file and renamed afterwards, so
+ * that concurrently starting processes never observe a partially written
+ * cache. Caches written on hosts with a different byte order or by a
+ * different version are treated as invalid.
+ *
+ * @author jmoringe
+ */
+class RSC_EXPORT ConfigCache {
+public:
+
+    /**
+     * Options in the order they were provided.
+     */
+    typedef std::vector<std::pair<std::vector<std::string>, std::string> > Options;
+
+    static const char MAGIC[8];
+    static const boost::uint32_t VERSION;
+    static const boost::uint32_t BYTE_ORDER_MARK;
+
+    /**
+     * Creates a cache stored in the given file. The file does not need to
+     * exist. Create the object before processing the source files which are
+     * going to be stored.
+     *
+     * @param file path of the cache file
+     */
+    explicit ConfigCache(const boost::filesystem::path& file);
+
+    /**
+     * Passes the cached options to @a handler if the cache was created from
+     * exactly the given source files and none of them has changed since.
+     * Otherwise, @a handler is not called at all.
+     *
+     * @param sources source files in the order they were processed
+     * @param handler handler to pass the options to
+     * @return @c true if the options were replayed, @c false if the cache is
+     *         missing, invalid or outdated
+     */
+    bool replay(const std::vector<boost::filesystem::path>& sources,
+                OptionHandler&                              handler) const;
+
+    /**
+     * Replaces the contents of the cache unless a source file has been
+     * modified too recently.
+     *
+     * @param sources source files in the order they were processed
+     * @param options options provided by these files
+     * @return @c true if the cache was written
+     * @throw std::runtime_error the cache file cannot be written
+     */
+    bool store(const std::vector<boost::filesystem::path>& sources,
+               const Options&                              options) const;
+
+    /**
+     * Returns the path of the cache file.
+     *
+     * @return path
+     */
+    const boost::filesystem::path& getFile() const;
+
+private:
+
+    boost::filesystem::path file;
+    std::time_t created;
+
+};
+
+}
+}
@@ -26,13 +26,17 @@
 
 #include "ConfigFileSource.h"
 
+#include <string.h>
+
 #include <iterator>
+#include <stdexcept>
 
 #include <boost/format.hpp>
-#include <boost/tokenizer.hpp>
 
 #include "../runtime/ContainerIO.h"
 
+#include "MappedFile.h"
+
 using namespace std;
 
 using namespace boost;
@@ -42,20 +46,123 @@ using namespace rsc::logging;
 namespace rsc {
 namespace config {
 
-// Taken from Boost.ProgramOptions
-string trim(const string& s) {
-    string::size_type n, n2;
-    n = s.find_first_not_of(" \t\r\n");
-    if (n == string::npos) {
-        return string();
-    } else {
-        n2 = s.find_last_not_of(" \t\r\n");
-        return s.substr(n, n2 - n + 1);
+namespace {
+
+bool isWhitespace(const char& c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+void trim(const char*& begin, const char*& end) {
+    while (begin != end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    while (end != begin && isWhitespace(*(end - 1))) {
+        --end;
     }
 }
 
+/**
+ * Splits option keys into components exactly like
+ * ConfigSource::splitKeyAtDots but incrementally, so that the components of
+ * a section name are split only once for all keys of the section.
+ */
+class KeySplitter {
+public:
+
+    KeySplitter() :
+            inQuote(false), empty(true) {
+    }
+
+    void append(const char* begin, const char* end) {
+        if (!error.empty() || begin == end) {
+            return;
+        }
+        empty = false;
+        for (const char* next = begin; next != end; ++next) {
+            if (*next == '\\') {
+                if (++next == end) {
+                    error = "cannot end with escape";
+                    return;
+                }
+                if (*next == 'n') {
+                    current += '\n';
+                } else if (*next == '"' || *next == '.' || *next == '\\') {
+                    current += *next;
+                } else {
+                    error = "unknown escape sequence";
+                    return;
+                }
+            } else if (*next == '.' && !inQuote) {
+                components.push_back(current);
+                current.clear();
+            } else if (*next == '"') {
+                inQuote = !inQuote;
+            } else {
+                current += *next;
+            }
+        }
+    }
+
+    /**
+     * Returns the validated components of everything appended so far. The
+     * section name and the key are only used for error messages.
+     */
+    void finish(const string& section, const char* keyBegin,
+            const char* keyEnd, vector<string>& output) const {
+        if (!error.empty()) {
+            throw invalid_argument(error);
+        }
+        output = components;
+        if (!empty) {
+            output.push_back(current);
+        }
+        for (vector<string>::const_iterator it = output.begin();
+                it != output.end(); ++it) {
+            if (it->empty()) {
+                throw invalid_argument(
+                        "Empty component in key '" + section
+                                + string(keyBegin, keyEnd) + "'");
+            }
+        }
+        if (output.empty()) {
+            throw invalid_argument("Option key is empty");
+        }
+    }
+
+private:
+
+    vector<string> components;
+    string current;
+    bool inQuote;
+    bool empty;
+    string error;
+
+};
+
+}
+
 ConfigFileSource::ConfigFileSource(istream& stream) :
-    logger(Logger::getLogger("rsc.config.ConfigFileSource")), stream(stream) {
+    logger(Logger::getLogger("rsc.config.ConfigFileSource")) {
+    const string contents((istreambuf_iterator<char>(stream)),
+            istreambuf_iterator<char>());
+    parse(contents.data(), contents.data() + contents.size());
+}
+
+ConfigFileSource::ConfigFileSource(const boost::filesystem::path& file) :
+    logger(Logger::getLogger("rsc.config.ConfigFileSource")) {
+    MappedFile contents(file);
+    parse(contents.begin(), contents.end());
+}
+
+void ConfigFileSource::provideOptions(OptionHandler& handler) {
+    for (map<vector<string>, string>::const_iterator it = options.begin();
+            it != options.end(); ++it) {
+        handler.handleOption(it->first, it->second);
+    }
+}
+
+// Syntax based on Boost.ProgramOptions
+void ConfigFileSource::parse(const char* begin, const char* end) {
 
     // Parse option keys and values and store them in an internal map.
     // Option keys are of the form
@@ -71,59 +178,72 @@ ConfigFileSource::ConfigFileSource(istream& stream) :
     //
     //   (logging system.subsystem) instead of
     //   (logging system subsystem)
-    string name;
-    string value;
-    while (getOption(name, value)) {
-        vector<string> key;
-        splitKeyAtDots(name, key);
-
-        RSCTRACE(logger, "Option " << key << " -> " << value);
-        options[key] = value;
-    }
-}
-
-void ConfigFileSource::provideOptions(OptionHandler& handler) {
-    for (map<vector<string>, string>::const_iterator it = options.begin();
-            it != options.end(); ++it) {
-        handler.handleOption(it->first, it->second);
-    }
-}
-
-// Based on Boost.ProgramOptions
-bool ConfigFileSource::getOption(string& name, string& value) {
-    string line;
-    while (getline(this->stream, line)) {
+    string currentSection;
+    KeySplitter sectionSplitter;
+    vector<string> key;
+
+    const char* lineBegin = begin;
+    while (lineBegin != end) {
+        const char* lineEnd = static_cast<const char*>(memchr(lineBegin, '\n',
+                end - lineBegin));
+        const char* next = lineEnd ? lineEnd + 1 : end;
+        if (!lineEnd) {
+            lineEnd = end;
+        }
 
         // check for files encoded with the old Mac EOL style.
-        size_t rPos = line.find('\r');
-        if (rPos != line.npos && rPos != 0 && rPos != line.size() - 1) {
+        const char* r = static_cast<const char*>(memchr(lineBegin, '\r',
+                lineEnd - lineBegin));
+        if (r && r != lineBegin && r != lineEnd - 1) {
             throw invalid_argument("Old Mac EOL style '\\r' is not supported.");
         }
 
         // Strip '#' comments and whitespace
-        string::size_type n;
-        if ((n = line.find('#')) != string::npos)
-            line = line.substr(0, n);
-        line = trim(line);
+        const char* comment = static_cast<const char*>(memchr(lineBegin, '#',
+                lineEnd - lineBegin));
+        if (comment) {
+            lineEnd = comment;
+        }
+        trim(lineBegin, lineEnd);
 
-        if (!line.empty()) {
+        if (lineBegin != lineEnd) {
+            const char* equals;
             // Handle section name
-            if (*line.begin() == '[' && *line.rbegin() == ']') {
-                currentSection = line.substr(1, line.size() - 2);
-                if (*currentSection.rbegin() != '.') {
+            if (*lineBegin == '[' && *(lineEnd - 1) == ']') {
+                currentSection.assign(lineBegin + 1, lineEnd - 1);
+                if (currentSection.empty()
+                        || *currentSection.rbegin() != '.') {
                     currentSection += '.';
                 }
-            } else if ((n = line.find('=')) != string::npos) {
-                name = currentSection + trim(line.substr(0, n));
-                value = trim(line.substr(n + 1));
-                return true;
+                sectionSplitter = KeySplitter();
+                sectionSplitter.append(currentSection.data(),
+                        currentSection.data() + currentSection.size());
+            } else if ((equals = static_cast<const char*>(memchr(lineBegin,
+                    '=', lineEnd - lineBegin)))) {
+                const char* nameBegin = lineBegin;
+                const char* nameEnd = equals;
+                trim(nameBegin, nameEnd);
+                const char* valueBegin = equals + 1;
+                const char* valueEnd = lineEnd;
+                trim(valueBegin, valueEnd);
+
+                KeySplitter splitter(sectionSplitter);
+                splitter.append(nameBegin, nameEnd);
+                splitter.finish(currentSection, nameBegin, nameEnd, key);
+
+                string& value = options[key];
+                value.assign(valueBegin, valueEnd);
+                RSCTRACE(logger, "Option " << key << " -> " << value);
             } else {
                 throw invalid_argument(
-                        str(format("Syntax error in line `%1%'") % line));
+                        str(format("Syntax error in line `%1%'")
+                                % string(lineBegin, lineEnd)));
             }
         }
+
+        lineBegin = next;
     }
-    return false;
+
 }
 
 }
@@ -31,6 +31,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/filesystem/path.hpp>
+
 #include "../logging/Logger.h"
 
 #include "ConfigSource.h"
@@ -44,6 +46,10 @@ namespace config {
  * information in "ini-file" syntax. Sections and keys are mapped to
  * hierarchical names.
  *
+ * The input is parsed in a single pass over an in-memory buffer without
+ * copying lines. Files can be mapped into memory directly, which is the
+ * fastest way to read large configuration files.
+ *
  * Currently, only files with line encoding styles of the respective platform
  * the code is run on are supported. Others may work but without guarantee.
  *
@@ -51,19 +57,33 @@ namespace config {
  */
 class RSC_EXPORT ConfigFileSource : public ConfigSource {
 public:
+
+    /**
+     * Parses the remaining contents of a stream.
+     *
+     * @param stream stream to read completely
+     * @throw std::invalid_argument syntax error in the contents
+     */
     ConfigFileSource(std::istream& stream);
 
+    /**
+     * Parses a file by mapping it into memory. Files which cannot be mapped
+     * are read into memory instead.
+     *
+     * @param file file to parse
+     * @throw std::invalid_argument syntax error in the contents
+     * @throw std::runtime_error file cannot be read
+     */
+    explicit ConfigFileSource(const boost::filesystem::path& file);
+
     void provideOptions(OptionHandler& handler);
 
 private:
     logging::LoggerPtr logger;
 
-    std::istream& stream;
-    std::string currentSection;
-
     std::map<std::vector<std::string>, std::string> options;
 
-    bool getOption(std::string& name, std::string& value);
+    void parse(const char* begin, const char* end);
 };
 
 }
@@ -0,0 +1,438 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "ConfigWatcher.h"
+
+#ifdef HAVE_INOTIFY_H
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/bind.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "../logging/LoggerFactory.h"
+#include "../runtime/ContainerIO.h"
+
+#include "CommandLinePropertySource.h"
+#include "ConfigFileSource.h"
+#include "Environment.h"
+
+using namespace std;
+
+using namespace rsc::logging;
+
+namespace rsc {
+namespace config {
+
+namespace {
+
+/**
+ * Merges options into a map, later options overriding earlier ones.
+ */
+class MapOptionHandler: public OptionHandler {
+public:
+    explicit MapOptionHandler(ConfigWatcher::Options& options) :
+            options(options) {
+    }
+
+    void handleOption(const vector<string>& key, const string& value) {
+        this->options[key] = value;
+    }
+
+private:
+    ConfigWatcher::Options& options;
+};
+
+#ifdef HAVE_INOTIFY_H
+const uint32_t WATCH_EVENTS = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM
+        | IN_DELETE;
+#endif
+
+}
+
+ConfigWatcher::FileVersion::FileVersion() :
+        exists(false), modified(0), size(0) {
+}
+
+bool ConfigWatcher::FileVersion::operator==(const FileVersion& other) const {
+    return exists == other.exists && modified == other.modified
+            && size == other.size;
+}
+
+ConfigWatcher::ConfigWatcher(const string& configFileName,
+        const string& environmentVariablePrefix, int argc, const char** argv,
+        const unsigned int& pollInterval, bool stripEnvironmentVariablePrefix,
+        const boost::filesystem::path& prefix,
+        const vector<string>& configurationFiles) :
+        logger(Logger::getLogger("rsc.config.ConfigWatcher")),
+        environmentVariablePrefix(environmentVariablePrefix),
+        stripEnvironmentVariablePrefix(stripEnvironmentVariablePrefix),
+        pollInterval(pollInterval), reloads(0), reloadRequested(false),
+        notifyDescriptor(-1) {
+
+    for (vector<string>::const_iterator it = configurationFiles.begin();
+            it != configurationFiles.end(); ++it) {
+        try {
+            this->files.push_back(
+                    boost::filesystem::absolute(
+                            resolveConfigurationFile(*it, prefix,
+                                    configFileName).first));
+        } catch (const runtime_error& e) {
+            RSCWARN(logger,
+                    "Failed to resolve configuration file designated by `"
+                    << *it << "': " << e.what());
+        }
+    }
+
+    if (argc > 0) {
+        MapOptionHandler handler(this->commandLineOptions);
+        CommandLinePropertySource(argc, argv).provideOptions(handler);
+    }
+
+    try {
+        this->options = readOptions();
+    } catch (const std::exception& e) {
+        RSCWARN(logger, "Failed to read configuration files: " << e.what());
+    }
+    this->versions = currentVersions();
+
+#ifdef HAVE_INOTIFY_H
+    // Watch the directories instead of the files to notice files which
+    // are created or replaced by renaming.
+    this->notifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    for (vector<boost::filesystem::path>::const_iterator it =
+            this->files.begin();
+            (this->notifyDescriptor >= 0) && (it != this->files.end()); ++it) {
+        const int watch = inotify_add_watch(this->notifyDescriptor,
+                it->parent_path().string().c_str(), WATCH_EVENTS);
+        if (watch < 0) {
+            RSCDEBUG(logger, "Cannot watch directory of " << *it
+                     << ", falling back to polling");
+            close(this->notifyDescriptor);
+            this->notifyDescriptor = -1;
+            this->watchedNames.clear();
+        } else {
+            this->watchedNames[watch].push_back(it->filename().string());
+        }
+    }
+#endif
+
+    this->thread = boost::thread(boost::bind(&ConfigWatcher::watch, this));
+
+}
+
+ConfigWatcher::~ConfigWatcher() {
+    this->thread.interrupt();
+    this->thread.join();
+#ifdef HAVE_INOTIFY_H
+    if (this->notifyDescriptor >= 0) {
+        close(this->notifyDescriptor);
+    }
+#endif
+}
+
+void ConfigWatcher::addHandler(OptionHandler& handler, bool replay) {
+    if (!replay) {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->handlers.push_back(&handler);
+        return;
+    }
+
+    // Registering and replaying under the delivery lock guarantees that
+    // no reload is delivered in between.
+    boost::mutex::scoped_lock delivery(this->deliveryMutex);
+    Options current;
+    {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->handlers.push_back(&handler);
+        current = this->options;
+        this->deliveringThread = boost::this_thread::get_id();
+    }
+    deliver(current, vector<OptionHandler*>(1, &handler));
+    boost::mutex::scoped_lock lock(this->mutex);
+    this->deliveringThread = boost::thread::id();
+    if (this->reloadRequested) {
+        lock.unlock();
+        delivery.unlock();
+        reload();
+    }
+}
+
+void ConfigWatcher::removeHandler(OptionHandler& handler) {
+    {
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->handlers.erase(
+                remove(this->handlers.begin(), this->handlers.end(), &handler),
+                this->handlers.end());
+        if (this->deliveringThread == boost::this_thread::get_id()) {
+            return;
+        }
+    }
+    // Wait for a delivery which may still call the handler. Later
+    // deliveries do not see it anymore.
+    boost::mutex::scoped_lock delivery(this->deliveryMutex);
+}
+
+bool ConfigWatcher::isHandler(OptionHandler* handler) const {
+    boost::mutex::scoped_lock lock(this->mutex);
+    return find(this->handlers.begin(), this->handlers.end(), handler)
+            != this->handlers.end();
+}
+
+ConfigWatcher::Options ConfigWatcher::getOptions() const {
+    boost::mutex::scoped_lock lock(this->mutex);
+    return this->options;
+}
+
+vector<boost::filesystem::path> ConfigWatcher::getFiles() const {
+    return this->files;
+}
+
+unsigned int ConfigWatcher::getReloads() const {
+    return this->reloads.load();
+}
+
+ConfigWatcher::Options ConfigWatcher::readOptions() const {
+    Options result;
+    MapOptionHandler handler(result);
+    for (vector<boost::filesystem::path>::const_iterator it =
+            this->files.begin(); it != this->files.end(); ++it) {
+        boost::system::error_code error;
+        if (boost::filesystem::exists(*it, error)) {
+            ConfigFileSource(*it).provideOptions(handler);
+        }
+    }
+    if (!this->environmentVariablePrefix.empty()) {
+        EnvironmentVariableSource(this->environmentVariablePrefix,
+                this->stripEnvironmentVariablePrefix).provideOptions(handler);
+    }
+    for (Options::const_iterator it = this->commandLineOptions.begin();
+            it != this->commandLineOptions.end(); ++it) {
+        result[it->first] = it->second;
+    }
+    return result;
+}
+
+unsigned int ConfigWatcher::reload() {
+
+    {
+        boost::mutex::scoped_lock lock(this->mutex);
+        if (this->deliveringThread == boost::this_thread::get_id()) {
+            // called from a handler, the running reload repeats itself
+            this->reloadRequested = true;
+            return 0;
+        }
+    }
+
+    // Reloads are serialized including their delivery so that
+    // concurrent reloads cannot deliver outdated options.
+    boost::mutex::scoped_lock delivery(this->deliveryMutex);
+
+    unsigned int delivered = 0;
+    do {
+
+        Options newOptions = readOptions();
+
+        Options changes;
+        vector<OptionHandler*> currentHandlers;
+        {
+            boost::mutex::scoped_lock lock(this->mutex);
+            for (Options::const_iterator it = newOptions.begin();
+                    it != newOptions.end(); ++it) {
+                Options::const_iterator previous = this->options.find(
+                        it->first);
+                if ((previous == this->options.end())
+                        || (previous->second != it->second)) {
+                    changes.insert(*it);
+                }
+            }
+            for (Options::const_iterator it = this->options.begin();
+                    it != this->options.end(); ++it) {
+                if (newOptions.find(it->first) == newOptions.end()) {
+                    RSCDEBUG(logger, "Option " << it->first << " was removed");
+                }
+            }
+            this->options.swap(newOptions);
+            currentHandlers = this->handlers;
+            this->reloadRequested = false;
+            if (!changes.empty()) {
+                this->deliveringThread = boost::this_thread::get_id();
+            }
+        }
+
+        if (changes.empty()) {
+            break;
+        }
+        ++this->reloads;
+        delivered += changes.size();
+
+        deliver(changes, currentHandlers);
+
+        boost::mutex::scoped_lock lock(this->mutex);
+        this->deliveringThread = boost::thread::id();
+        if (!this->reloadRequested) {
+            break;
+        }
+
+    } while (true);
+
+    return delivered;
+
+}
+
+void ConfigWatcher::deliver(const Options& changes,
+        const vector<OptionHandler*>& handlers) {
+    for (vector<OptionHandler*>::const_iterator handler = handlers.begin();
+            handler != handlers.end(); ++handler) {
+        // skip handlers removed by a previous handler call
+        if (!isHandler(*handler)) {
+            continue;
+        }
+        BatchOptionHandler* batch = dynamic_cast<BatchOptionHandler*>(
+                *handler);
+        if (batch) {
+            batch->beginBatch();
+        }
+        for (Options::const_iterator it = changes.begin();
+                it != changes.end(); ++it) {
+            if (!isHandler(*handler)) {
+                break;
+            }
+            RSCDEBUG(logger, "Changed option " << it->first << " -> "
+                     << it->second);
+            try {
+                (*handler)->handleOption(it->first, it->second);
+            } catch (const std::exception& e) {
+                RSCWARN(logger, "Failed to apply changed option "
+                        << it->first << ": " << e.what());
+            }
+        }
+        if (batch) {
+            try {
+                batch->commitBatch();
+            } catch (const std::exception& e) {
+                RSCWARN(logger, "Failed to apply changed options: "
+                        << e.what());
+            }
+        }
+    }
+}
+
+vector<ConfigWatcher::FileVersion> ConfigWatcher::currentVersions() const {
+    vector<FileVersion> result;
+    for (vector<boost::filesystem::path>::const_iterator it =
+            this->files.begin(); it != this->files.end(); ++it) {
+        FileVersion current;
+        boost::system::error_code error;
+        current.modified = boost::filesystem::last_write_time(*it, error);
+        if (!error) {
+            current.size = boost::filesystem::file_size(*it, error);
+            current.exists = !error;
+        }
+        if (!current.exists) {
+            current = FileVersion();
+        }
+        result.push_back(current);
+    }
+    return result;
+}
+
+bool ConfigWatcher::waitForChange() {
+
+#ifdef HAVE_INOTIFY_H
+    if (this->notifyDescriptor >= 0) {
+        pollfd descriptor;
+        descriptor.fd = this->notifyDescriptor;
+        descriptor.events = POLLIN;
+        const int ready = poll(&descriptor, 1, this->pollInterval);
+        boost::this_thread::interruption_point();
+        if (ready <= 0) {
+            return false;
+        }
+
+        union {
+            inotify_event event;
+            char bytes[4096];
+        } buffer;
+        bool changed = false;
+        ssize_t length;
+        while ((length = read(this->notifyDescriptor, buffer.bytes,
+                sizeof(buffer.bytes))) > 0) {
+            for (const char* position = buffer.bytes;
+                    position < buffer.bytes + length;) {
+                const inotify_event* event =
+                        reinterpret_cast<const inotify_event*>(position);
+                if (event->len > 0) {
+                    const vector<string>& names =
+                            this->watchedNames[event->wd];
+                    changed = changed
+                            || (find(names.begin(), names.end(),
+                                    string(event->name)) != names.end());
+                }
+                position += sizeof(inotify_event) + event->len;
+            }
+        }
+        return changed;
+    }
+#endif
+
+    boost::this_thread::sleep(
+            boost::posix_time::milliseconds(this->pollInterval));
+    vector<FileVersion> current = currentVersions();
+    if (current == this->versions) {
+        return false;
+    }
+    this->versions.swap(current);
+    return true;
+
+}
+
+void ConfigWatcher::watch() {
+
+    while (true) {
+
+        if (!waitForChange()) {
+            continue;
+        }
+
+        try {
+            reload();
+        } catch (const std::exception& e) {
+            RSCWARN(logger, "Unable to reload configuration files: "
+                    << e.what());
+        }
+
+    }
+
+}
+
+}
+}
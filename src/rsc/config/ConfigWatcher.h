@@ -0,0 +1,261 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "../logging/Logger.h"
+
+#include "Configuration.h"
+#include "OptionHandler.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace config {
+
+/**
+ * Watches the configuration files processed by @ref configure and
+ * delivers changed options to registered @ref OptionHandler instances
+ * while the process keeps running.
+ *
+ * The files are watched in a background thread using inotify where
+ * available and by periodically checking their modification times and
+ * sizes otherwise. On a change, all files are parsed again in the
+ * background thread and the resulting options are compared to the
+ * previous ones. Only added options and options with changed values are
+ * passed to the handlers, hence handlers which publish their settings
+ * atomically, like logging::OptionBasedConfigurator, never block the
+ * threads using them. Handlers implementing @ref BatchOptionHandler
+ * receive the changes of each reload as one batch.
+ *
+ * Options removed from the files are not delivered, since handlers have
+ * no notion of removing an option; they keep the last value. If an
+ * environment variable prefix or command line arguments are given,
+ * environment variables and command line options override file options
+ * the same way as in @ref configure so that changes to overridden options
+ * are not delivered.
+ *
+ * Files with syntax errors, e.g. while being written, are reported and
+ * the previous options are kept until the next change.
+ *
+ * @author jmoringe
+ */
+class RSC_EXPORT ConfigWatcher: private boost::noncopyable {
+public:
+
+    typedef std::map<std::vector<std::string>, std::string> Options;
+
+    /**
+     * Reads the configuration files and starts watching them. The
+     * parameters have the same meaning as for @ref configure.
+     *
+     * @param configFileName file name from which the file names for
+     *                       the special entries of
+     *                       @a configurationFiles are derived
+     * @param environmentVariablePrefix prefix of the environment
+     *                                  variables overriding file
+     *                                  options. Empty to ignore the
+     *                                  environment.
+     * @param argc number of command line arguments, 0 to ignore the
+     *             command line
+     * @param argv command line arguments, only used during
+     *             construction
+     * @param pollInterval interval between checks in milliseconds when
+     *                     inotify is not available. Also bounds the
+     *                     time needed for stopping the watcher.
+     * @param stripEnvironmentVariablePrefix whether the prefix is
+     *                                       stripped from environment
+     *                                       variable names
+     * @param prefix installation prefix for the prefix-wide file
+     * @param configurationFiles files to watch in ascending order of
+     *                           precedence
+     */
+    ConfigWatcher(const std::string& configFileName,
+            const std::string& environmentVariablePrefix = "",
+            int argc = 0,
+            const char** argv = 0,
+            const unsigned int& pollInterval = 1000,
+            bool stripEnvironmentVariablePrefix = true,
+            const boost::filesystem::path& prefix = "/",
+            const std::vector<std::string>& configurationFiles =
+                    defaultConfigurationFiles());
+
+    /**
+     * Stops watching the files.
+     */
+    virtual ~ConfigWatcher();
+
+    /**
+     * Registers a handler for changed options.
+     *
+     * @param handler handler to register, must remain valid until it is
+     *                removed or the watcher is destroyed
+     * @param replay if @c true, the current options are passed to the
+     *               handler before it receives any change, otherwise
+     *               only changes are passed
+     */
+    void addHandler(OptionHandler& handler, bool replay = false);
+
+    /**
+     * Unregisters a handler. Once this method returns, the handler will
+     * not be called anymore. May be called from a handler.
+     *
+     * @param handler handler to remove
+     */
+    void removeHandler(OptionHandler& handler);
+
+    /**
+     * Reads the files again and delivers changed options to the
+     * handlers. This happens automatically when the files change but
+     * may also be triggered explicitly, e.g. on @c SIGHUP. Handlers are
+     * called without holding the lock protecting the watcher's state, so
+     * that they may use its other methods. When called from a handler,
+     * the files are read again after the current delivery has finished
+     * and 0 is returned.
+     *
+     * @return number of delivered options
+     * @throw std::invalid_argument syntax error in a file
+     * @throw std::runtime_error a file cannot be read
+     */
+    unsigned int reload();
+
+    /**
+     * Returns the options as of the last successful reload.
+     *
+     * @return current options
+     */
+    Options getOptions() const;
+
+    /**
+     * Returns the resolved paths of the watched files.
+     *
+     * @return paths in ascending order of precedence
+     */
+    std::vector<boost::filesystem::path> getFiles() const;
+
+    /**
+     * Returns the number of reloads which changed at least one option.
+     *
+     * @return number of reloads
+     */
+    unsigned int getReloads() const;
+
+private:
+
+    /**
+     * Identifies a state of a watched file.
+     */
+    struct FileVersion {
+        FileVersion();
+        bool operator==(const FileVersion& other) const;
+        bool exists;
+        std::time_t modified;
+        boost::uintmax_t size;
+    };
+
+    Options readOptions() const;
+
+    std::vector<FileVersion> currentVersions() const;
+
+    /**
+     * Blocks for at most the poll interval.
+     *
+     * @return @c true if a watched file might have changed
+     */
+    bool waitForChange();
+
+    void watch();
+
+    logging::LoggerPtr logger;
+
+    std::vector<boost::filesystem::path> files;
+    const std::string environmentVariablePrefix;
+    const bool stripEnvironmentVariablePrefix;
+    const unsigned int pollInterval;
+
+    /**
+     * Options from the command line, which override all others.
+     */
+    Options commandLineOptions;
+
+    bool isHandler(OptionHandler* handler) const;
+
+    /**
+     * Passes options to handlers. Requires #deliveryMutex to be locked.
+     */
+    void deliver(const Options& changes,
+            const std::vector<OptionHandler*>& handlers);
+
+    /**
+     * Serializes reloads including the delivery of their changes, so
+     * that handlers receive changes in order.
+     */
+    boost::mutex deliveryMutex;
+
+    /**
+     * Guards options, handlers and the delivery state. Never held while
+     * calling handlers.
+     */
+    mutable boost::mutex mutex;
+    Options options;
+    std::vector<OptionHandler*> handlers;
+    boost::atomic<unsigned int> reloads;
+
+    /**
+     * Thread currently delivering changes, if any.
+     */
+    boost::thread::id deliveringThread;
+
+    /**
+     * Set if a handler requested a reload during a delivery.
+     */
+    bool reloadRequested;
+
+    std::vector<FileVersion> versions;
+
+    /**
+     * inotify descriptor or -1 for polling.
+     */
+    int notifyDescriptor;
+    std::map<int, std::vector<std::string> > watchedNames;
+
+    boost::thread thread;
+
+};
+
+}
+}
@@ -37,6 +37,7 @@
 #include "../logging/LoggerFactory.h"
 
 #include "Environment.h"
+#include "ConfigCache.h"
 #include "ConfigFileSource.h"
 #include "CommandLinePropertySource.h"
 
@@ -53,6 +54,8 @@ const std::string DEFAULT_DEBUG_VARIABLE_NAME = "__CONFIG_DEBUG";
 
 const std::string DEFAULT_FILE_VARIABLE_NAME = "__CONFIG_FILES";
 
+const std::string DEFAULT_CACHE_VARIABLE_NAME = "__CONFIG_CACHE";
+
 const std::string CONFIG_FILE_KEY_PREFIX = "%prefix";
 const std::string CONFIG_FILE_KEY_USER   = "%user";
 const std::string CONFIG_FILE_KEY_PWD    = "%pwd";
@@ -65,6 +68,8 @@ LoggerPtr getLogger() {
 
 std::vector<std::string>
 defaultConfigurationFiles(const std::string& fileVariableName) {
+    // Observe variables replaced since the previous lookup.
+    refreshEnvironment();
     boost::shared_ptr<std::string> files;
     if ((files = getEnvironmentVariable(fileVariableName))) {
         return splitSequenceValue(*files);
@@ -105,7 +110,10 @@ void describeFileStream(const std::string&             label,
          << (stream ? "exists" : "does not exist") << endl;
 }
 
-void processConfigFile(unsigned int                   index,
+/**
+ * @return @c false if the file could not be processed completely
+ */
+bool processConfigFile(unsigned int                   index,
                        const std::string&             spec,
                        const boost::filesystem::path& prefix,
                        const std::string&             configFileName,
@@ -120,7 +128,7 @@ void processConfigFile(unsigned int                   index,
         RSCWARN(getLogger(),
                 "Failed to resolve configuration file designated by "
                 << spec << "': " << e.what());
-        return;
+        return false;
     }
     try {
 
@@ -131,13 +139,110 @@ void processConfigFile(unsigned int                   index,
                                file, stream);
         }
         if (stream) {
-            ConfigFileSource source(stream);
+            stream.close();
+            ConfigFileSource source(file);
             source.provideOptions(handler);
         }
     } catch (const runtime_error& e) {
         RSCWARN(getLogger(),
                 "Failed to process " << description << " `"
                 << file << "': " << e.what());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Passes options on to another handler and records them for a
+ * ConfigCache.
+ */
+class RecordingOptionHandler : public OptionHandler {
+public:
+    RecordingOptionHandler(OptionHandler& target)
+        : target(target) {
+    }
+
+    void handleOption(const vector<string>& key, const string& value) {
+        options.push_back(make_pair(key, value));
+        target.handleOption(key, value);
+    }
+
+    const ConfigCache::Options& getOptions() const {
+        return options;
+    }
+private:
+    OptionHandler&       target;
+    ConfigCache::Options options;
+};
+
+void processConfigFiles(const std::vector<std::string>& configurationFiles,
+                        const boost::filesystem::path&  prefix,
+                        const std::string&              configFileName,
+                        bool                            debug,
+                        OptionHandler&                  handler) {
+    boost::shared_ptr<std::string> cacheFile
+        = getEnvironmentVariable(DEFAULT_CACHE_VARIABLE_NAME);
+    if (cacheFile && cacheFile->empty()) {
+        cacheFile.reset();
+    }
+
+    // Without a cache or if not all files can be resolved, all files are
+    // processed directly.
+    vector<boost::filesystem::path> files;
+    if (cacheFile) {
+        try {
+            for (std::vector<std::string>::const_iterator it
+                     = configurationFiles.begin();
+                 it != configurationFiles.end(); ++it) {
+                files.push_back(boost::filesystem::absolute(
+                        resolveConfigurationFile(*it, prefix, configFileName)
+                        .first));
+            }
+        } catch (const runtime_error&) {
+            cacheFile.reset();
+        }
+    }
+    if (!cacheFile) {
+        unsigned int index = 1;
+        for (std::vector<std::string>::const_iterator it
+                 = configurationFiles.begin();
+             it != configurationFiles.end(); ++it) {
+            processConfigFile(index++, *it, prefix, configFileName, debug,
+                              handler);
+        }
+        return;
+    }
+
+    ConfigCache cache(*cacheFile);
+    if (cache.replay(files, handler)) {
+        if (debug) {
+            cerr << "     <replayed from cache " << cache.getFile() << ">"
+                 << endl;
+        }
+        return;
+    }
+
+    RecordingOptionHandler recorder(handler);
+    bool complete = true;
+    unsigned int index = 1;
+    for (std::vector<std::string>::const_iterator it
+             = configurationFiles.begin();
+         it != configurationFiles.end(); ++it) {
+        complete = processConfigFile(index++, *it, prefix, configFileName,
+                                     debug, recorder)
+            && complete;
+    }
+    if (!complete) {
+        return;
+    }
+    try {
+        if (cache.store(files, recorder.getOptions()) && debug) {
+            cerr << "     <stored in cache " << cache.getFile() << ">" << endl;
+        }
+    } catch (const runtime_error& e) {
+        RSCWARN(getLogger(),
+                "Failed to store configuration cache " << cache.getFile()
+                << ": " << e.what());
     }
 }
 
@@ -150,6 +255,7 @@ void configure(OptionHandler&                  handler,
                const boost::filesystem::path&  prefix,
                const std::string&              debugVariableName,
                const std::vector<std::string>& configurationFiles) {
+    refreshEnvironment();
     bool debug = getEnvironmentVariable(debugVariableName).get();
 
     // 0) In debug mode, header first.
@@ -162,11 +268,8 @@ void configure(OptionHandler&                  handler,
     if (debug) {
         cerr << "  1. Configuration files" << endl;
     }
-    unsigned int index = 1;
-    for (std::vector<std::string>::const_iterator it = configurationFiles.begin();
-         it != configurationFiles.end(); ++it) {
-        processConfigFile(index++, *it, prefix, configFileName, debug, handler);
-    }
+    processConfigFiles(configurationFiles, prefix, configFileName, debug,
+                       handler);
 
     // 2) Add environment Variables
     {
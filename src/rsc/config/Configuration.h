@@ -39,6 +39,12 @@ RSC_EXPORT extern const std::string DEFAULT_DEBUG_VARIABLE_NAME;
 
 RSC_EXPORT extern const std::string DEFAULT_FILE_VARIABLE_NAME;
 
+/**
+ * Name of the environment variable which designates a ConfigCache file for
+ * the options of the configuration files processed by @ref configure.
+ */
+RSC_EXPORT extern const std::string DEFAULT_CACHE_VARIABLE_NAME;
+
 RSC_EXPORT extern const std::string CONFIG_FILE_KEY_PREFIX;
 RSC_EXPORT extern const std::string CONFIG_FILE_KEY_USER;
 RSC_EXPORT extern const std::string CONFIG_FILE_KEY_PWD;
@@ -81,7 +87,14 @@ resolveConfigurationFile(const std::string&             spec,
  *    configFileName
  * -# Environment Variables
  *
- * See #ConfigFileSource for the configuration file format.
+ * See #ConfigFileSource for the configuration file format. Changes to the
+ * configuration files can be applied at runtime using a ConfigWatcher.
+ *
+ * If the environment variable @c __CONFIG_CACHE names a file, the options
+ * of the configuration files are stored there as a ConfigCache. As long as
+ * none of the configuration files changes, subsequent calls replay the
+ * cached options instead of parsing the files. Environment variables and
+ * command line options are always processed.
  *
  * Setting the environment variable @c __CONFIG_DEBUG to an arbitrary
  * value enables configuration debugging. All debug output is written
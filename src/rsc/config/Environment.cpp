@@ -26,6 +26,8 @@
 
 #include "Environment.h"
 
+#include <string.h>
+
 #include <algorithm>
 #include <iterator>
 
@@ -38,8 +40,8 @@
 #endif
 
 #include <boost/algorithm/string.hpp>
-#include <boost/program_options.hpp>
-#include <boost/program_options/environment_iterator.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/unordered_map.hpp>
 
 #include <rsc/runtime/ContainerIO.h>
 
@@ -101,14 +103,171 @@ path userConfigDirectory() {
     return userHomeDirectory() / ".config";
 }
 
-boost::shared_ptr<std::string> getEnvironmentVariable(const std::string& name) {
-    for (environment_iterator it = environment_iterator(environ); it
-             != environment_iterator(); ++it) {
-        if (it->first == name) {
-            return boost::shared_ptr<string>(new string(it->second));
+namespace {
+
+/**
+ * An indexed copy of the process environment.
+ *
+ * Entries are sorted by name so that all variables sharing a prefix
+ * form a contiguous range and a hash map provides constant time
+ * lookup by name. The snapshot remembers the entry pointers of @c
+ * environ it was built from which allows detecting modifications
+ * through @c setenv, @c unsetenv or @c putenv without copying any
+ * strings, either completely in linear time or, for added and
+ * removed variables, in constant time.
+ *
+ * @author jmoringe
+ */
+class EnvironmentSnapshot {
+public:
+
+    struct Entry {
+        string name;
+        string value;
+
+        bool operator<(const Entry& other) const {
+            return this->name < other.name;
+        }
+    };
+    typedef vector<Entry> Entries;
+    typedef Entries::const_iterator const_iterator;
+
+    explicit EnvironmentSnapshot(char** environment) :
+        array(environment) {
+        for (char** it = environment; *it; ++it) {
+            this->pointers.push_back(*it);
+
+            Entry entry;
+            const char* separator = strchr(*it, '=');
+            if (separator) {
+                entry.name.assign(*it, separator - *it);
+                entry.value.assign(separator + 1);
+            } else {
+                entry.name.assign(*it);
+            }
+            this->entries.push_back(entry);
         }
+
+        // Stable sorting keeps duplicate names in environment order,
+        // so the first occurrence wins in the index like it does for
+        // getenv.
+        stable_sort(this->entries.begin(), this->entries.end());
+        this->index.rehash(this->entries.size());
+        for (size_t i = 0; i < this->entries.size(); ++i) {
+            this->index.insert(make_pair(this->entries[i].name, i));
+        }
+    }
+
+    /**
+     * Checks in constant time whether variables have been added or
+     * removed since the snapshot was built. Values replaced in place
+     * are not detected unless they are stored in the last entry.
+     */
+    bool hasSameLayout(char** environment) const {
+        const size_t size = this->pointers.size();
+        return (environment == this->array)
+            && ((size == 0)
+                || (environment[size - 1] == this->pointers[size - 1]))
+            && (environment[size] == 0);
+    }
+
+    bool isCurrent(char** environment) const {
+        size_t i = 0;
+        for (; environment[i]; ++i) {
+            if ((i >= this->pointers.size())
+                || (this->pointers[i] != environment[i])) {
+                return false;
+            }
+        }
+        return i == this->pointers.size();
+    }
+
+    const Entry* find(const string& name) const {
+        Index::const_iterator it = this->index.find(name);
+        if (it == this->index.end()) {
+            return 0;
+        }
+        return &this->entries[it->second];
+    }
+
+    pair<const_iterator, const_iterator>
+    findPrefix(const string& prefix) const {
+        Entry key;
+        key.name = prefix;
+        const_iterator begin
+            = lower_bound(this->entries.begin(), this->entries.end(), key);
+        const_iterator end = begin;
+        while ((end != this->entries.end())
+               && (end->name.compare(0, prefix.size(), prefix) == 0)) {
+            ++end;
+        }
+        return make_pair(begin, end);
+    }
+
+private:
+    typedef boost::unordered_map<string, size_t> Index;
+
+    char** array;
+    vector<const char*> pointers;
+    Entries entries;
+    Index index;
+};
+
+typedef boost::shared_ptr<const EnvironmentSnapshot> EnvironmentSnapshotPtr;
+
+/**
+ * Intentionally leaked to remain usable during static destruction.
+ */
+boost::mutex& environmentMutex() {
+    static boost::mutex* mutex = new boost::mutex;
+    return *mutex;
+}
+
+EnvironmentSnapshotPtr& environmentSnapshot() {
+    static EnvironmentSnapshotPtr* snapshot = new EnvironmentSnapshotPtr;
+    return *snapshot;
+}
+
+/**
+ * Return a snapshot of the current environment, building a new one
+ * only if the environment changed since the previous call.
+ *
+ * @param validate if @c true, every entry is compared to detect values
+ *                 replaced in place, otherwise only added and removed
+ *                 variables are detected without locking
+ */
+EnvironmentSnapshotPtr currentEnvironment(bool validate) {
+    EnvironmentSnapshotPtr snapshot
+        = boost::atomic_load(&environmentSnapshot());
+    if (!validate && snapshot && snapshot->hasSameLayout(environ)) {
+        return snapshot;
+    }
+
+    boost::mutex::scoped_lock lock(environmentMutex());
+    snapshot = environmentSnapshot();
+    if (!snapshot
+        || !(validate ? snapshot->isCurrent(environ)
+                      : snapshot->hasSameLayout(environ))) {
+        snapshot.reset(new EnvironmentSnapshot(environ));
+        boost::atomic_store(&environmentSnapshot(), snapshot);
+    }
+    return snapshot;
+}
+
+}
+
+void refreshEnvironment() {
+    boost::mutex::scoped_lock lock(environmentMutex());
+    boost::atomic_store(&environmentSnapshot(), EnvironmentSnapshotPtr());
+}
+
+boost::shared_ptr<std::string> getEnvironmentVariable(const std::string& name) {
+    EnvironmentSnapshotPtr environment = currentEnvironment(false);
+    const EnvironmentSnapshot::Entry* entry = environment->find(name);
+    if (!entry) {
+        return boost::shared_ptr<string>();
     }
-    return boost::shared_ptr<string>();
+    return boost::shared_ptr<string>(new string(entry->value));
 }
 
 string transformName(const string& name, const string& prefix,
@@ -119,6 +278,7 @@ string transformName(const string& name, const string& prefix,
         if (stripPrefix) {
             start = start + prefix.size();
         }
+        result.reserve(name.end() - start);
         transform(start, name.end(), back_inserter(result), &::tolower);
         return result;
     } else {
@@ -153,13 +313,19 @@ EnvironmentVariableSource::EnvironmentVariableSource(const string& prefix,
 EnvironmentVariableSource::Matches EnvironmentVariableSource::getMatches() {
     if (!this->matches) {
         this->matches.reset(new Matches());
-        for (environment_iterator it = environment_iterator(environ); it
-                 != environment_iterator(); ++it) {
-            string name = transformName(it->first, this->prefix, this->stripPrefix);
+        // configuring is rare, hence all entries are validated
+        EnvironmentSnapshotPtr environment = currentEnvironment(true);
+        pair<EnvironmentSnapshot::const_iterator,
+             EnvironmentSnapshot::const_iterator> range
+            = environment->findPrefix(this->prefix);
+        for (EnvironmentSnapshot::const_iterator it = range.first;
+             it != range.second; ++it) {
+            string name = transformName(it->name, this->prefix,
+                                        this->stripPrefix);
             if (name.empty()) {
                 continue;
             }
-            this->matches->push_back(Match(it->first, name, it->second));
+            this->matches->push_back(Match(it->name, name, it->value));
         }
     }
     return *this->matches;
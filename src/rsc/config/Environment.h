@@ -94,6 +94,13 @@ RSC_EXPORT boost::filesystem::path userConfigDirectory();
  * Return the value of the environment value @a name or an empty
  * pointer.
  *
+ * Lookups use an indexed snapshot of the environment and take
+ * constant time without locking. The snapshot is rebuilt when
+ * variables have been added or removed since the previous lookup.
+ * Replacing the value of an existing variable, e.g. with @c setenv,
+ * is not always detected by lookups, call @ref refreshEnvironment
+ * afterwards. @ref EnvironmentVariableSource always detects it.
+ *
  * @return A @ref boost::shared_ptr that is null if there is no
  *         environment variable named @a name and holds the value of
  *         the environment variable otherwise.
@@ -103,6 +110,14 @@ RSC_EXPORT boost::filesystem::path userConfigDirectory();
 RSC_EXPORT boost::shared_ptr<std::string>
 getEnvironmentVariable(const std::string& name);
 
+/**
+ * Discard the snapshot used by @ref getEnvironmentVariable so that
+ * the next lookup observes all modifications of the environment.
+ *
+ * @author jmoringe
+ */
+RSC_EXPORT void refreshEnvironment();
+
 /**
  * Objects of this class analyze the environment of the current
  * process, finding environment variables whose name starts with a
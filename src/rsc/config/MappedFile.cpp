@@ -0,0 +1,138 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "MappedFile.h"
+
+#include <string.h>
+
+#include <iterator>
+#include <stdexcept>
+
+#ifndef WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/format.hpp>
+
+using namespace std;
+
+namespace rsc {
+namespace config {
+
+MappedFile::MappedFile(const boost::filesystem::path& file, const Mode& mode) :
+        mapping(0), mappedSize(0) {
+#ifndef WIN32
+    int fd = open(file.string().c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error(
+                boost::str(
+                        boost::format("Unable to open file `%1%': %2%")
+                                % file.string() % strerror(errno)));
+    }
+    struct stat status;
+    bool copied = false;
+    if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode)
+            && status.st_size > 0) {
+        if (mode == MAP) {
+            void* result = mmap(0, status.st_size, PROT_READ, MAP_PRIVATE,
+                    fd, 0);
+            if (result != MAP_FAILED) {
+                mapping = static_cast<const char*>(result);
+                mappedSize = status.st_size;
+                madvise(result, mappedSize, MADV_SEQUENTIAL);
+            }
+        } else {
+            // a file truncated while reading only yields a shorter copy
+            buffer.resize(status.st_size);
+            size_t filled = 0;
+            while (filled < buffer.size()) {
+                const ssize_t count = pread(fd, &buffer[filled],
+                        buffer.size() - filled, filled);
+                if (count < 0 && errno == EINTR) {
+                    continue;
+                } else if (count < 0) {
+                    const int error = errno;
+                    close(fd);
+                    throw runtime_error(
+                            boost::str(
+                                    boost::format(
+                                            "Unable to read file `%1%': %2%")
+                                            % file.string()
+                                            % strerror(error)));
+                } else if (count == 0) {
+                    break;
+                }
+                filled += count;
+            }
+            buffer.resize(filled);
+            copied = true;
+        }
+    }
+    close(fd);
+    if (mapping || copied) {
+        return;
+    }
+#else
+    (void) mode;
+#endif
+    boost::filesystem::ifstream stream(file, ios::in | ios::binary);
+    if (!stream) {
+        throw runtime_error(
+                boost::str(
+                        boost::format("Unable to open file `%1%'")
+                                % file.string()));
+    }
+    buffer.assign(istreambuf_iterator<char>(stream),
+            istreambuf_iterator<char>());
+}
+
+MappedFile::~MappedFile() {
+#ifndef WIN32
+    if (mapping) {
+        munmap(const_cast<char*>(mapping), mappedSize);
+    }
+#endif
+}
+
+const char* MappedFile::begin() const {
+    return mapping ? mapping : buffer.data();
+}
+
+const char* MappedFile::end() const {
+    return begin() + size();
+}
+
+size_t MappedFile::size() const {
+    return mapping ? mappedSize : buffer.size();
+}
+
+}
+}
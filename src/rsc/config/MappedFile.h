@@ -0,0 +1,94 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <boost/filesystem/path.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace config {
+
+/**
+ * The read-only contents of a file, either copied into memory or mapped
+ * into memory if requested and possible. Files which cannot be mapped,
+ * e.g. empty files, pipes or all files on Windows, are always read into
+ * memory.
+ *
+ * @author jmoringe
+ */
+class RSC_EXPORT MappedFile: boost::noncopyable {
+public:
+
+    /**
+     * How the contents of a file are accessed.
+     */
+    enum Mode {
+        /**
+         * Copy the contents of the file as of the time of opening it,
+         * i.e. up to the size it had then. Safe for files other
+         * processes modify in place.
+         */
+        COPY,
+        /**
+         * Map the file into memory. Only safe for files which are replaced
+         * atomically, e.g. by renaming, because accessing the mapping
+         * raises @c SIGBUS if another process truncates the file.
+         */
+        MAP
+    };
+
+    /**
+     * Copies or maps a file.
+     *
+     * @param file file to read
+     * @param mode how the contents are accessed
+     * @throw std::runtime_error file cannot be read
+     */
+    explicit MappedFile(const boost::filesystem::path& file,
+            const Mode& mode = COPY);
+
+    ~MappedFile();
+
+    const char* begin() const;
+    const char* end() const;
+    std::size_t size() const;
+
+private:
+
+    const char* mapping;
+    std::size_t mappedSize;
+    std::string buffer;
+
+};
+
+}
+}
@@ -32,5 +32,8 @@ namespace config {
 OptionHandler::~OptionHandler() {
 }
 
+BatchOptionHandler::~BatchOptionHandler() {
+}
+
 }
 }
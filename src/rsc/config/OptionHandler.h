@@ -55,5 +55,26 @@ public:
                               const std::string& value) = 0;
 };
 
+/** An @ref OptionHandler which can apply a group of related options,
+ * e.g. the changes of one reload of a @ref ConfigWatcher, as a single
+ * change. The options of a group are passed between calls of
+ * @ref beginBatch and @ref commitBatch.
+ *
+ * @author jmoringe
+ */
+class RSC_EXPORT BatchOptionHandler: public OptionHandler {
+public:
+    virtual ~BatchOptionHandler();
+
+    /** Called before the first option of a group.
+     */
+    virtual void beginBatch() = 0;
+
+    /** Called after the last option of a group, even if handling
+     * an option failed.
+     */
+    virtual void commitBatch() = 0;
+};
+
 }
 }
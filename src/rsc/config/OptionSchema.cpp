@@ -0,0 +1,195 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include "OptionSchema.h"
+
+#include <map>
+#include <stdexcept>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/format.hpp>
+
+#include "../runtime/ContainerIO.h"
+
+using namespace std;
+
+namespace rsc {
+namespace config {
+
+namespace {
+
+/**
+ * Orders key components either case-sensitively or not.
+ */
+class ComponentLess {
+public:
+    explicit ComponentLess(bool caseSensitive) :
+            caseSensitive(caseSensitive) {
+    }
+
+    bool operator()(const string& left, const string& right) const {
+        if (this->caseSensitive) {
+            return left < right;
+        }
+        return boost::algorithm::ilexicographical_compare(left, right);
+    }
+
+private:
+    bool caseSensitive;
+};
+
+}
+
+class OptionSchema::Node {
+public:
+    typedef map<string, NodePtr, ComponentLess> Children;
+
+    explicit Node(bool caseSensitive) :
+            children(ComponentLess(caseSensitive)) {
+    }
+
+    Children children;
+    NodePtr any;
+    NodePtr rest;
+    Matches bindings;
+};
+
+OptionSchema::OptionSchema(bool caseSensitive) :
+        caseSensitive(caseSensitive), root(new Node(caseSensitive)) {
+}
+
+OptionSchema::~OptionSchema() {
+}
+
+vector<string> OptionSchema::splitPattern(const string& pattern) {
+    vector<string> components;
+    if (!pattern.empty()) {
+        boost::algorithm::split(components, pattern,
+                boost::algorithm::is_any_of("."));
+    }
+    return components;
+}
+
+void OptionSchema::addBinding(Group group, const vector<string>& pattern,
+        BindingPtr binding) {
+    Node* node = this->root.get();
+    for (vector<string>::const_iterator it = pattern.begin();
+            it != pattern.end(); ++it) {
+        NodePtr* next;
+        if (*it == "**") {
+            next = &node->rest;
+        } else if (*it == "*") {
+            next = &node->any;
+        } else {
+            next = &node->children[*it];
+        }
+        if (!*next) {
+            next->reset(new Node(this->caseSensitive));
+        }
+        node = next->get();
+    }
+    node->bindings.push_back(make_pair(group, binding));
+}
+
+void OptionSchema::collect(const Node& node, const vector<string>& key,
+        size_t position, Matches& matches) const {
+    // Visiting literal children before wildcards finds the most
+    // specific pattern of each group first.
+    if (position == key.size()) {
+        const size_t previous = matches.size();
+        for (Matches::const_iterator it = node.bindings.begin();
+                it != node.bindings.end(); ++it) {
+            bool served = false;
+            for (size_t i = 0; i < previous; ++i) {
+                if (matches[i].first == it->first) {
+                    served = true;
+                    break;
+                }
+            }
+            if (!served) {
+                matches.push_back(*it);
+            }
+        }
+    } else {
+        Node::Children::const_iterator child = node.children.find(
+                key[position]);
+        if (child != node.children.end()) {
+            collect(*child->second, key, position + 1, matches);
+        }
+        if (node.any) {
+            collect(*node.any, key, position + 1, matches);
+        }
+    }
+    if (node.rest) {
+        for (size_t i = position; i <= key.size(); ++i) {
+            collect(*node.rest, key, i, matches);
+        }
+    }
+}
+
+void OptionSchema::handleOption(const vector<string>& key,
+        const string& value) {
+    Matches matches;
+    collect(*this->root, key, 0, matches);
+
+    vector<pair<const type_info*, boost::any> > values;
+    for (Matches::const_iterator it = matches.begin(); it != matches.end();
+            ++it) {
+        const Binding& binding = *it->second;
+
+        const boost::any* converted = NULL;
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (*values[i].first == binding.getType()) {
+                converted = &values[i].second;
+                break;
+            }
+        }
+        if (!converted) {
+            try {
+                values.push_back(
+                        make_pair(&binding.getType(), binding.convert(value)));
+            } catch (const boost::bad_lexical_cast&) {
+                throw invalid_argument(
+                        boost::str(
+                                boost::format(
+                                        "Invalid value `%1%' for option `%2%'.")
+                                        % value
+                                        % boost::io::group(
+                                                std::container_none,
+                                                std::element_sequence(".", ""),
+                                                key)));
+            }
+            converted = &values.back().second;
+        }
+
+        binding.invoke(key, *converted);
+    }
+}
+
+}
+}
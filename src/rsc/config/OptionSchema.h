@@ -0,0 +1,221 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/any.hpp>
+#include <boost/function.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "OptionHandler.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace config {
+
+/**
+ * Converts raw option values into values of type @a T. The default
+ * implementation uses @c boost::lexical_cast after stripping
+ * surrounding whitespace. Specialize this template to support
+ * additional types; specializations should throw
+ * @c std::invalid_argument for invalid values.
+ *
+ * @author jmoringe
+ */
+template<class T>
+struct OptionValueConverter {
+    static T convert(const std::string& value) {
+        return boost::lexical_cast<T>(boost::algorithm::trim_copy(value));
+    }
+};
+
+/**
+ * String values are passed through unmodified.
+ *
+ * @author jmoringe
+ */
+template<>
+struct OptionValueConverter<std::string> {
+    static std::string convert(const std::string& value) {
+        return value;
+    }
+};
+
+/**
+ * An @ref OptionHandler which routes options to typed callbacks
+ * according to key patterns declared up front.
+ *
+ * Patterns are sequences of key components. Besides literal
+ * components, the wildcard @c * matches exactly one component and
+ * @c ** matches any number of components including none. All
+ * patterns are compiled into a trie so that each option is routed
+ * with a single walk over its key regardless of the number of
+ * declared patterns. Values are converted through @ref
+ * OptionValueConverter at most once per option and target type,
+ * even if several callbacks receive them.
+ *
+ * Callbacks are declared in groups, usually one per consumer. Within
+ * a group, only the callbacks of the most specific matching pattern
+ * receive an option, where a literal component is more specific than
+ * @c * which in turn is more specific than @c **. Matching patterns of
+ * different groups all receive the option. This allows configuring
+ * several consumers with a single pass over the configuration
+ * sources:
+ *
+ * @code
+ * OptionSchema schema;
+ * loggingConfigurator.declareOptions(schema);
+ * pluginConfigurator.declareOptions(schema);
+ * configure(schema, "rsb.conf", "RSB_", argc, argv);
+ * @endcode
+ *
+ * @author jmoringe
+ */
+class RSC_EXPORT OptionSchema: public OptionHandler {
+public:
+
+    /**
+     * Identifies a group of mutually exclusive patterns, usually the
+     * address of the declaring object.
+     */
+    typedef const void* Group;
+
+    /**
+     * Creates an empty schema.
+     *
+     * @param caseSensitive if @c false, literal pattern components
+     *                      match key components regardless of case
+     */
+    explicit OptionSchema(bool caseSensitive = true);
+    virtual ~OptionSchema();
+
+    /**
+     * Declares a callback for options matching @a pattern.
+     *
+     * @param group group of the pattern
+     * @param pattern key components of the pattern
+     * @param callback called with the complete key and the converted
+     *                 value of each routed option
+     */
+    template<class T>
+    void addOption(Group group, const std::vector<std::string>& pattern,
+            const boost::function<void(const std::vector<std::string>&,
+                    const T&)>& callback) {
+        addBinding(group, pattern, BindingPtr(new TypedBinding<T>(callback)));
+    }
+
+    /**
+     * Declares a callback for options matching the dot-separated
+     * @a pattern.
+     *
+     * @param group group of the pattern
+     * @param pattern pattern with components separated by dots
+     * @param callback called with the complete key and the converted
+     *                 value of each routed option
+     */
+    template<class T>
+    void addOption(Group group, const std::string& pattern,
+            const boost::function<void(const std::vector<std::string>&,
+                    const T&)>& callback) {
+        addOption<T>(group, splitPattern(pattern), callback);
+    }
+
+    /**
+     * Routes an option to the callbacks of all matching patterns.
+     *
+     * @throw std::invalid_argument if the value cannot be converted to
+     *                              the type of a matching callback
+     */
+    void handleOption(const std::vector<std::string>& key,
+            const std::string& value);
+
+private:
+
+    class Binding {
+    public:
+        virtual ~Binding() {
+        }
+        virtual const std::type_info& getType() const = 0;
+        virtual boost::any convert(const std::string& value) const = 0;
+        virtual void invoke(const std::vector<std::string>& key,
+                const boost::any& value) const = 0;
+    };
+    typedef boost::shared_ptr<Binding> BindingPtr;
+
+    template<class T>
+    class TypedBinding: public Binding {
+    public:
+        typedef boost::function<void(const std::vector<std::string>&,
+                const T&)> Callback;
+
+        explicit TypedBinding(const Callback& callback) :
+                callback(callback) {
+        }
+
+        const std::type_info& getType() const {
+            return typeid(T);
+        }
+
+        boost::any convert(const std::string& value) const {
+            return boost::any(OptionValueConverter<T>::convert(value));
+        }
+
+        void invoke(const std::vector<std::string>& key,
+                const boost::any& value) const {
+            this->callback(key, *boost::any_cast<T>(&value));
+        }
+
+    private:
+        Callback callback;
+    };
+
+    class Node;
+    typedef boost::shared_ptr<Node> NodePtr;
+
+    typedef std::vector<std::pair<Group, BindingPtr> > Matches;
+
+    static std::vector<std::string> splitPattern(const std::string& pattern);
+
+    void addBinding(Group group, const std::vector<std::string>& pattern,
+            BindingPtr binding);
+
+    void collect(const Node& node, const std::vector<std::string>& key,
+            std::size_t position, Matches& matches) const;
+
+    bool caseSensitive;
+    NodePtr root;
+
+};
+
+}
+}
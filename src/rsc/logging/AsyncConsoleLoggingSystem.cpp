@@ -0,0 +1,81 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "AsyncConsoleLoggingSystem.h"
+
+#include "AsyncLogger.h"
+#include "StreamLogRecordSink.h"
+#include "../misc/Registry.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+string AsyncConsoleLoggingSystem::getName() {
+    return "AsyncConsoleLoggingSystem";
+}
+
+AsyncConsoleLoggingSystem::AsyncConsoleLoggingSystem() :
+        stream(cerr), capacity(AsyncLogWriter::DEFAULT_CAPACITY), policy(
+                AsyncLogWriter::OVERFLOW_BLOCK) {
+}
+
+AsyncConsoleLoggingSystem::AsyncConsoleLoggingSystem(ostream& stream,
+        const unsigned int& capacity,
+        const AsyncLogWriter::OverflowPolicy& policy) :
+        stream(stream), capacity(capacity), policy(policy) {
+}
+
+AsyncConsoleLoggingSystem::~AsyncConsoleLoggingSystem() {
+}
+
+string AsyncConsoleLoggingSystem::getRegistryKey() const {
+    return getName();
+}
+
+AsyncLogWriterPtr AsyncConsoleLoggingSystem::getWriter() {
+    boost::mutex::scoped_lock lock(writerMutex);
+    if (!writer) {
+        writer.reset(
+                new AsyncLogWriter(
+                        LogRecordSinkPtr(new StreamLogRecordSink(stream)),
+                        capacity, policy));
+        AsyncLogWriter::flushAtExit(writer);
+    }
+    return writer;
+}
+
+LoggerPtr AsyncConsoleLoggingSystem::createLogger(const string& name) {
+    return LoggerPtr(new AsyncLogger(name, getWriter()));
+}
+
+CREATE_GLOBAL_REGISTREE_MSG(loggingSystemRegistry(), new AsyncConsoleLoggingSystem, AsyncConsoleLoggingSystem, "Could it be that you have linked two different versions of RSC in your program?")
+;
+
+}
+}
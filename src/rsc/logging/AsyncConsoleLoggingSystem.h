@@ -0,0 +1,99 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <iostream>
+
+#include <boost/thread/mutex.hpp>
+
+#include "AsyncLogWriter.h"
+#include "LoggingSystem.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A logging system with the output format of ConsoleLoggingSystem which
+ * moves formatting and writing of messages to a background thread. Logging
+ * threads only place messages in a bounded lock-free buffer.
+ *
+ * The background thread is started with the first logger created by this
+ * system. Pending messages are written when the process exits normally.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT AsyncConsoleLoggingSystem: public LoggingSystem {
+public:
+
+    /**
+     * Creates a system writing to @c std::cerr with the default capacity
+     * and blocking overflow behavior.
+     */
+    AsyncConsoleLoggingSystem();
+
+    /**
+     * Creates a system with explicit settings.
+     *
+     * @param stream stream to write to, must outlive this system
+     * @param capacity capacity of the message buffer
+     * @param policy behavior if the message buffer is full
+     */
+    AsyncConsoleLoggingSystem(std::ostream& stream,
+            const unsigned int& capacity,
+            const AsyncLogWriter::OverflowPolicy& policy);
+
+    virtual ~AsyncConsoleLoggingSystem();
+
+    std::string getRegistryKey() const;
+
+    LoggerPtr createLogger(const std::string& name);
+
+    /**
+     * Returns the writer used by all loggers of this system, starting it if
+     * required.
+     *
+     * @return the writer
+     */
+    AsyncLogWriterPtr getWriter();
+
+    static std::string getName();
+
+private:
+
+    std::ostream& stream;
+    const unsigned int capacity;
+    const AsyncLogWriter::OverflowPolicy policy;
+
+    boost::mutex writerMutex;
+    AsyncLogWriterPtr writer;
+
+};
+
+}
+}
@@ -0,0 +1,269 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "AsyncLogWriter.h"
+
+#include <cstdlib>
+#include <iterator>
+
+#include <boost/bind.hpp>
+#include <boost/format.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include "../misc/Clock.h"
+#include "../threading/InterruptedException.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+LogRecordSink::~LogRecordSink() {
+}
+
+boost::uint32_t currentLogThreadId() {
+    static boost::atomic<boost::uint32_t> nextId(1);
+    static boost::thread_specific_ptr<boost::uint32_t> threadId;
+    if (!threadId.get()) {
+        threadId.reset(
+                new boost::uint32_t(
+                        nextId.fetch_add(1, boost::memory_order_relaxed)));
+    }
+    return *threadId;
+}
+
+namespace {
+
+boost::mutex& exitWritersMutex() {
+    static boost::mutex mutex;
+    return mutex;
+}
+
+vector<boost::weak_ptr<AsyncLogWriter> >& exitWriters() {
+    static vector<boost::weak_ptr<AsyncLogWriter> > writers;
+    return writers;
+}
+
+void flushWritersAtExit() {
+    boost::mutex::scoped_lock lock(exitWritersMutex());
+    for (vector<boost::weak_ptr<AsyncLogWriter> >::iterator it =
+            exitWriters().begin(); it != exitWriters().end(); ++it) {
+        AsyncLogWriterPtr writer = it->lock();
+        if (writer) {
+            writer->flush();
+        }
+    }
+}
+
+}
+
+const unsigned int AsyncLogWriter::DEFAULT_CAPACITY = 8192;
+const unsigned int AsyncLogWriter::MAX_BATCH_SIZE = 512;
+const unsigned int AsyncLogWriter::FLUSH_INTERVAL_MS = 100;
+
+AsyncLogWriter::AsyncLogWriter(LogRecordSinkPtr sink,
+        const unsigned int& capacity, const OverflowPolicy& policy) :
+        sink(sink), buffer(capacity), policy(policy), dropped(0), unreportedDrops(
+                0), appended(0), written(0), blockedAppenders(0), stopping(
+                false) {
+    writerThread = boost::thread(
+            boost::bind(&AsyncLogWriter::writerLoop, this));
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        stopping = true;
+        writtenCondition.notify_all();
+    }
+    buffer.interrupt();
+    writerThread.join();
+}
+
+bool AsyncLogWriter::append(const LogRecord& record) {
+
+    if (buffer.tryPush(record)) {
+        ++appended;
+        return true;
+    }
+
+    switch (policy.load(boost::memory_order_relaxed)) {
+    case OVERFLOW_BLOCK: {
+        boost::mutex::scoped_lock lock(mutex);
+        ++blockedAppenders;
+        // pairs with the fence in writeBatch so that either we see the free
+        // space or the writer sees us blocked
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        while (!buffer.tryPush(record)) {
+            if (stopping) {
+                --blockedAppenders;
+                ++dropped;
+                return false;
+            }
+            writtenCondition.wait(lock);
+        }
+        --blockedAppenders;
+        ++appended;
+        return true;
+    }
+    case OVERFLOW_COUNT:
+        ++unreportedDrops;
+        ++dropped;
+        return false;
+    default:
+        ++dropped;
+        return false;
+    }
+
+}
+
+void AsyncLogWriter::flush() {
+    const boost::uint64_t target = appended.load();
+    boost::mutex::scoped_lock lock(mutex);
+    while (written < target && !stopping) {
+        writtenCondition.wait(lock);
+    }
+    lock.unlock();
+    flushSink();
+}
+
+void AsyncLogWriter::setOverflowPolicy(const OverflowPolicy& policy) {
+    this->policy = policy;
+}
+
+AsyncLogWriter::OverflowPolicy AsyncLogWriter::getOverflowPolicy() const {
+    return (OverflowPolicy) policy.load();
+}
+
+boost::uint64_t AsyncLogWriter::getDroppedRecords() const {
+    return dropped;
+}
+
+void AsyncLogWriter::flushAtExit(AsyncLogWriterPtr writer) {
+    // construct the statics before registering the handler so that they are
+    // destructed after it has run
+    boost::mutex::scoped_lock lock(exitWritersMutex());
+    vector<boost::weak_ptr<AsyncLogWriter> >& writers = exitWriters();
+    if (writers.empty()) {
+        atexit(&flushWritersAtExit);
+    }
+    writers.push_back(writer);
+}
+
+void AsyncLogWriter::writerLoop() {
+
+    vector<LogRecord> batch;
+    batch.reserve(MAX_BATCH_SIZE);
+
+    // whether records have been written since the last flush and when the
+    // first of them has to be flushed at the latest
+    bool unflushed = false;
+    boost::uint64_t flushDue = 0;
+
+    while (true) {
+
+        try {
+            if (!unflushed) {
+                batch.push_back(buffer.pop());
+            } else {
+                const boost::uint64_t now = rsc::misc::coarseMonotonicMillis();
+                if (now >= flushDue) {
+                    flushSink();
+                    unflushed = false;
+                    continue;
+                }
+                batch.push_back(buffer.pop(flushDue - now));
+            }
+        } catch (const rsc::threading::QueueEmptyException& e) {
+            // no new records for the rest of the interval
+            flushSink();
+            unflushed = false;
+            continue;
+        } catch (const rsc::threading::InterruptedException& e) {
+            // write everything that is left before terminating
+            while (buffer.drain(back_inserter(batch), MAX_BATCH_SIZE) > 0) {
+                writeBatch(batch);
+            }
+            flushSink();
+            return;
+        }
+        buffer.drain(back_inserter(batch), MAX_BATCH_SIZE - 1);
+        writeBatch(batch);
+
+        if (!unflushed) {
+            unflushed = true;
+            flushDue = rsc::misc::coarseMonotonicMillis() + FLUSH_INTERVAL_MS;
+        }
+
+    }
+
+}
+
+void AsyncLogWriter::writeBatch(vector<LogRecord>& batch) {
+
+    const size_t count = batch.size();
+
+    // the batch has been taken out of the buffer, release blocked clients
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+    if (blockedAppenders.load() > 0) {
+        boost::mutex::scoped_lock lock(mutex);
+        writtenCondition.notify_all();
+    }
+
+    const boost::uint64_t drops = unreportedDrops.exchange(0);
+    if (drops > 0) {
+        LogRecord report;
+        report.level = Logger::LEVEL_WARN;
+        report.timestamp = rsc::misc::coarseTimeMillis();
+        report.loggerName.reset(new string("rsc.logging.AsyncLogWriter"));
+        report.message = boost::str(
+                boost::format(
+                        "%d log messages were dropped because the buffer was full")
+                        % drops);
+        batch.push_back(report);
+    }
+
+    {
+        boost::mutex::scoped_lock lock(sinkMutex);
+        sink->write(batch);
+    }
+    batch.clear();
+
+    boost::mutex::scoped_lock lock(mutex);
+    written += count;
+    writtenCondition.notify_all();
+
+}
+
+void AsyncLogWriter::flushSink() {
+    boost::mutex::scoped_lock lock(sinkMutex);
+    sink->flush();
+}
+
+}
+}
@@ -0,0 +1,308 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "DeferredMessage.h"
+#include "Logger.h"
+#include "../threading/RingBufferQueue.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A single log message as passed from a logging thread to an AsyncLogWriter.
+ *
+ * @author jwienke
+ */
+struct LogRecord {
+
+    LogRecord() :
+            level(Logger::LEVEL_OFF), timestamp(0), threadId(0) {
+    }
+
+    /**
+     * Level of the message.
+     */
+    Logger::Level level;
+
+    /**
+     * Time of logging in milliseconds since the epoch.
+     */
+    boost::uint64_t timestamp;
+
+    /**
+     * Process-local number of the thread which logged the message. Threads
+     * are numbered in the order of their first log message starting with 1.
+     * 0 if unknown.
+     */
+    boost::uint32_t threadId;
+
+    /**
+     * Name of the logger the message was logged with. Shared with the logger
+     * so that passing it on does not require copying the name.
+     */
+    boost::shared_ptr<const std::string> loggerName;
+
+    /**
+     * The message itself if it has been formatted by the client.
+     */
+    std::string message;
+
+    /**
+     * The message if it still needs to be formatted. Only used if #message
+     * is empty.
+     */
+    DeferredMessage deferredMessage;
+
+    /**
+     * Formats the message of this record regardless of whether it is
+     * deferred or not.
+     *
+     * @param stream stream to format on
+     * @return the stream passed in
+     */
+    std::ostream& formatMessage(std::ostream& stream) const {
+        if (message.empty()) {
+            return deferredMessage.format(stream);
+        }
+        return stream << message;
+    }
+
+};
+
+/**
+ * Returns the number of the calling thread as stored in LogRecord::threadId.
+ *
+ * @return process-local thread number, starting with 1
+ */
+RSC_EXPORT boost::uint32_t currentLogThreadId();
+
+/**
+ * Destination for batches of LogRecord instances written by an
+ * AsyncLogWriter. Implementations are only called from the writer thread.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT LogRecordSink {
+public:
+
+    virtual ~LogRecordSink();
+
+    /**
+     * Writes a batch of records in the given order.
+     *
+     * @param records records to write
+     */
+    virtual void write(const std::vector<LogRecord>& records) = 0;
+
+    /**
+     * Flushes all records written so far to the underlying medium.
+     */
+    virtual void flush() = 0;
+
+};
+
+typedef boost::shared_ptr<LogRecordSink> LogRecordSinkPtr;
+
+/**
+ * Decouples logging threads from the output of log messages. Logging threads
+ * only place records in a bounded lock-free ring buffer while a background
+ * thread takes them out in batches and passes them to a LogRecordSink. The
+ * sink is flushed by the background thread at most once every
+ * #FLUSH_INTERVAL_MS, as soon as no new records arrive for the rest of the
+ * interval, so that light load does not cause one flush per record.
+ *
+ * If the ring buffer is full, the configured OverflowPolicy decides what
+ * happens to new records.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT AsyncLogWriter: private boost::noncopyable {
+public:
+
+    /**
+     * Possible behaviors if a record is appended while the ring buffer is
+     * full.
+     *
+     * @author jwienke
+     */
+    enum OverflowPolicy {
+        /**
+         * Block the logging thread until there is space in the buffer.
+         */
+        OVERFLOW_BLOCK,
+        /**
+         * Discard the new record.
+         */
+        OVERFLOW_DROP,
+        /**
+         * Discard the new record and report the number of discarded records
+         * with the next batch that is written.
+         */
+        OVERFLOW_COUNT
+    };
+
+    /**
+     * Default capacity of the ring buffer in records.
+     */
+    static const unsigned int DEFAULT_CAPACITY;
+
+    /**
+     * Maximum number of records written in one batch.
+     */
+    static const unsigned int MAX_BATCH_SIZE;
+
+    /**
+     * Maximum time in milliseconds written records stay in the sink before
+     * it is flushed.
+     */
+    static const unsigned int FLUSH_INTERVAL_MS;
+
+    /**
+     * Creates a new writer and starts its background thread.
+     *
+     * @param sink sink to write records to
+     * @param capacity capacity of the ring buffer in records, at least 2
+     * @param policy behavior if the ring buffer is full
+     * @throw std::invalid_argument capacity smaller than 2
+     */
+    AsyncLogWriter(LogRecordSinkPtr sink, const unsigned int& capacity =
+            DEFAULT_CAPACITY,
+            const OverflowPolicy& policy = OVERFLOW_BLOCK);
+
+    /**
+     * Writes all pending records and stops the background thread.
+     */
+    virtual ~AsyncLogWriter();
+
+    /**
+     * Appends a new record for writing. Depending on the overflow policy,
+     * this call may block or discard the record if the buffer is full.
+     *
+     * @param record the record to write
+     * @return @c true if the record will be written, @c false if it was
+     *         discarded
+     */
+    bool append(const LogRecord& record);
+
+    /**
+     * Blocks until all records appended before this call have been written
+     * and flushes the sink.
+     */
+    void flush();
+
+    /**
+     * Changes the overflow policy. Can be called at any time.
+     *
+     * @param policy new policy
+     */
+    void setOverflowPolicy(const OverflowPolicy& policy);
+
+    /**
+     * Returns the current overflow policy.
+     *
+     * @return overflow policy
+     */
+    OverflowPolicy getOverflowPolicy() const;
+
+    /**
+     * Returns the number of records discarded because the buffer was full.
+     *
+     * @return number of discarded records since creation
+     */
+    boost::uint64_t getDroppedRecords() const;
+
+    /**
+     * Registers a writer to be flushed on normal process termination. This
+     * is required for writers of logging systems in the registry, as these
+     * are never destructed.
+     *
+     * @param writer the writer to flush, only weakly referenced
+     */
+    static void flushAtExit(boost::shared_ptr<AsyncLogWriter> writer);
+
+private:
+
+    void writerLoop();
+
+    /**
+     * Writes a batch taken from the buffer to the sink and wakes up blocked
+     * and flushing clients.
+     */
+    void writeBatch(std::vector<LogRecord>& batch);
+
+    void flushSink();
+
+    LogRecordSinkPtr sink;
+    /**
+     * Serializes writing and flushing the sink.
+     */
+    boost::mutex sinkMutex;
+    rsc::threading::RingBufferQueue<LogRecord> buffer;
+    boost::atomic<int> policy;
+
+    boost::atomic<boost::uint64_t> dropped;
+    boost::atomic<boost::uint64_t> unreportedDrops;
+
+    /**
+     * Number of successfully appended records.
+     */
+    boost::atomic<boost::uint64_t> appended;
+
+    boost::mutex mutex;
+    /**
+     * Signaled after each written batch.
+     */
+    boost::condition writtenCondition;
+    /**
+     * Number of records written to the sink, guarded by mutex.
+     */
+    boost::uint64_t written;
+    boost::atomic<unsigned int> blockedAppenders;
+    bool stopping;
+
+    boost::thread writerThread;
+
+};
+
+typedef boost::shared_ptr<AsyncLogWriter> AsyncLogWriterPtr;
+
+}
+}
@@ -0,0 +1,88 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "AsyncLogger.h"
+
+#include "../misc/Clock.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+AsyncLogger::AsyncLogger(const string& name, AsyncLogWriterPtr writer) :
+        writer(writer), level(LEVEL_INFO), name(new string(name)) {
+}
+
+AsyncLogger::~AsyncLogger() {
+}
+
+Logger::Level AsyncLogger::getLevel() const {
+    return (Level) level.load(boost::memory_order_relaxed);
+}
+
+void AsyncLogger::setLevel(const Logger::Level& level) {
+    this->level.store(level, boost::memory_order_relaxed);
+}
+
+string AsyncLogger::getName() const {
+    return *boost::atomic_load(&name);
+}
+
+void AsyncLogger::setName(const string& name) {
+    boost::atomic_store(&this->name,
+            boost::shared_ptr<const string>(new string(name)));
+}
+
+void AsyncLogger::log(const Level& level, const string& msg) {
+    if (!isEnabledFor(level)) {
+        return;
+    }
+    LogRecord record;
+    record.level = level;
+    record.timestamp = rsc::misc::coarseTimeMillis();
+    record.threadId = currentLogThreadId();
+    record.loggerName = boost::atomic_load(&name);
+    record.message = msg;
+    writer->append(record);
+}
+
+void AsyncLogger::logDeferred(const Level& level, const DeferredMessage& msg) {
+    if (!isEnabledFor(level)) {
+        return;
+    }
+    LogRecord record;
+    record.level = level;
+    record.timestamp = rsc::misc::coarseTimeMillis();
+    record.threadId = currentLogThreadId();
+    record.loggerName = boost::atomic_load(&name);
+    record.deferredMessage = msg;
+    writer->append(record);
+}
+
+}
+}
@@ -0,0 +1,88 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <string>
+
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "AsyncLogWriter.h"
+#include "Logger.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A logger which hands its messages to an AsyncLogWriter instead of writing
+ * them in the calling thread. Level checks and logging do not acquire any
+ * lock.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT AsyncLogger: public Logger {
+public:
+
+    /**
+     * Creates a new logger with level INFO.
+     *
+     * @param name name of the logger
+     * @param writer writer to pass messages to
+     */
+    AsyncLogger(const std::string& name, AsyncLogWriterPtr writer);
+    virtual ~AsyncLogger();
+
+    Level getLevel() const;
+    void setLevel(const Level& level);
+    std::string getName() const;
+    void setName(const std::string& name);
+
+    void log(const Level& level, const std::string& msg);
+
+    /**
+     * Passes the message on to the writer thread without formatting it and
+     * without allocating memory.
+     */
+    void logDeferred(const Level& level, const DeferredMessage& msg);
+
+private:
+
+    AsyncLogWriterPtr writer;
+    boost::atomic<int> level;
+
+    /**
+     * The current name, only accessed through the atomic shared pointer
+     * operations.
+     */
+    boost::shared_ptr<const std::string> name;
+
+};
+
+}
+}
@@ -0,0 +1,172 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "BinaryLogReader.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/format.hpp>
+
+#include "BinaryLogRecordSink.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+BinaryLogReader::BinaryLogReader(istream& stream) :
+        stream(stream) {
+    readHeader(false);
+}
+
+BinaryLogReader::~BinaryLogReader() {
+}
+
+template<class T>
+bool BinaryLogReader::read(T& value) {
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (stream.gcount() == 0 && stream.eof()) {
+        return false;
+    }
+    if (stream.gcount() != (streamsize) sizeof(T)) {
+        throw runtime_error("Binary log is truncated.");
+    }
+    return true;
+}
+
+template<class T>
+void BinaryLogReader::require(T& value) {
+    if (!read(value)) {
+        throw runtime_error("Binary log is truncated.");
+    }
+}
+
+void BinaryLogReader::requireString(string& value) {
+    boost::uint32_t size;
+    require(size);
+    value.resize(size);
+    if (size > 0) {
+        stream.read(&value[0], size);
+        if (stream.gcount() != (streamsize) size) {
+            throw runtime_error("Binary log is truncated.");
+        }
+    }
+}
+
+void BinaryLogReader::readHeader(const bool& magicStarted) {
+
+    char magic[sizeof(BinaryLogRecordSink::MAGIC)];
+    size_t offset = 0;
+    if (magicStarted) {
+        magic[0] = BinaryLogRecordSink::MAGIC[0];
+        offset = 1;
+    }
+    stream.read(magic + offset, sizeof(magic) - offset);
+    if (stream.gcount() != (streamsize) (sizeof(magic) - offset)
+            || !equal(magic, magic + sizeof(magic),
+                    BinaryLogRecordSink::MAGIC)) {
+        throw runtime_error("Not a binary log.");
+    }
+
+    boost::uint32_t version;
+    boost::uint32_t byteOrderMark;
+    require(version);
+    require(byteOrderMark);
+    if (byteOrderMark != BinaryLogRecordSink::BYTE_ORDER_MARK) {
+        throw runtime_error(
+                "Binary log was written on a host with a different byte order.");
+    }
+    if (version != BinaryLogRecordSink::VERSION) {
+        throw runtime_error(
+                boost::str(
+                        boost::format("Unsupported binary log version %d.")
+                                % version));
+    }
+
+    // ids are only valid within one file
+    names.clear();
+
+}
+
+bool BinaryLogReader::next(LogRecord& record) {
+
+    while (true) {
+
+        boost::uint8_t type;
+        if (!read(type)) {
+            return false;
+        }
+
+        if (type == BinaryLogRecordSink::ENTRY_NAME) {
+
+            boost::uint32_t id;
+            require(id);
+            boost::shared_ptr<string> name(new string);
+            requireString(*name);
+            names[id] = name;
+
+        } else if (type == BinaryLogRecordSink::ENTRY_RECORD) {
+
+            boost::uint32_t loggerId;
+            boost::int32_t level;
+            require(record.timestamp);
+            require(loggerId);
+            require(level);
+            require(record.threadId);
+            requireString(record.message);
+
+            map<boost::uint32_t, boost::shared_ptr<const string> >::const_iterator
+                    nameIt = names.find(loggerId);
+            if (nameIt == names.end()) {
+                throw runtime_error(
+                        boost::str(
+                                boost::format(
+                                        "Binary log references unknown logger id %d.")
+                                        % loggerId));
+            }
+            record.loggerName = nameIt->second;
+            record.level = (Logger::Level) level;
+            record.deferredMessage.clear();
+            return true;
+
+        } else if (type == (boost::uint8_t) BinaryLogRecordSink::MAGIC[0]) {
+            // header of a concatenated file
+            readHeader(true);
+        } else {
+            throw runtime_error(
+                    boost::str(
+                            boost::format("Invalid entry type %d in binary log.")
+                                    % (int) type));
+        }
+
+    }
+
+}
+
+}
+}
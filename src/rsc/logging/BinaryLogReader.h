@@ -0,0 +1,95 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <istream>
+#include <map>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "AsyncLogWriter.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * Reads records from files written by BinaryLogRecordSink. Logger names are
+ * resolved, hence the records can be formatted with StreamLogRecordSink.
+ * Several concatenated files can be read from one stream.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT BinaryLogReader: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a reader and reads the file header.
+     *
+     * @param stream stream to read from, opened in binary mode
+     * @throw std::runtime_error the stream does not contain a binary log
+     *                           written with the byte order and format
+     *                           version of this host
+     */
+    explicit BinaryLogReader(std::istream& stream);
+
+    virtual ~BinaryLogReader();
+
+    /**
+     * Reads the next record.
+     *
+     * @param record record to fill, the message is always set to
+     *               LogRecord#message
+     * @return @c true if a record was read, @c false at the end of the
+     *         stream
+     * @throw std::runtime_error corrupt or truncated data
+     */
+    bool next(LogRecord& record);
+
+private:
+
+    void readHeader(const bool& magicStarted);
+
+    template<class T>
+    bool read(T& value);
+
+    template<class T>
+    void require(T& value);
+
+    void requireString(std::string& value);
+
+    std::istream& stream;
+    std::map<boost::uint32_t, boost::shared_ptr<const std::string> > names;
+
+};
+
+}
+}
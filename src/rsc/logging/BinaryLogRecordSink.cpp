@@ -0,0 +1,126 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "BinaryLogRecordSink.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+namespace {
+
+template<class T>
+void append(string& block, const T& value) {
+    block.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void appendString(string& block, const char* data, const size_t& size) {
+    append(block, (boost::uint32_t) size);
+    block.append(data, size);
+}
+
+}
+
+const char BinaryLogRecordSink::MAGIC[8] = { 'R', 'S', 'C', 'B', 'L', 'O',
+        'G', '\n' };
+const boost::uint32_t BinaryLogRecordSink::VERSION = 1;
+const boost::uint32_t BinaryLogRecordSink::BYTE_ORDER_MARK = 0x01020304;
+
+BinaryLogRecordSink::BinaryLogRecordSink(const Options& options) :
+        FileLogRecordSink(options), messageBuffer(message), messageStream(
+                &messageBuffer) {
+}
+
+BinaryLogRecordSink::~BinaryLogRecordSink() {
+}
+
+FileLogRecordSink::Options BinaryLogRecordSink::defaultOptions() {
+    Options options;
+    options.path = "rsc.binlog";
+    return options;
+}
+
+void BinaryLogRecordSink::beginFile(const bool& empty, string& block) {
+    // names have to be repeated in each file
+    nameObjects.clear();
+    names.clear();
+    if (empty) {
+        block.append(MAGIC, sizeof(MAGIC));
+        append(block, VERSION);
+        append(block, BYTE_ORDER_MARK);
+    }
+}
+
+boost::uint32_t BinaryLogRecordSink::intern(
+        const boost::shared_ptr<const string>& name, string& block) {
+
+    map<boost::shared_ptr<const string>, boost::uint32_t>::const_iterator objectIt =
+            nameObjects.find(name);
+    if (objectIt != nameObjects.end()) {
+        return objectIt->second;
+    }
+
+    const string& value = name ? *name : string();
+    boost::uint32_t id;
+    map<string, boost::uint32_t>::const_iterator nameIt = names.find(value);
+    if (nameIt != names.end()) {
+        id = nameIt->second;
+    } else {
+        id = names.size();
+        names[value] = id;
+        append(block, (boost::uint8_t) ENTRY_NAME);
+        append(block, id);
+        appendString(block, value.data(), value.size());
+    }
+    nameObjects[name] = id;
+    return id;
+
+}
+
+void BinaryLogRecordSink::encode(const LogRecord& record, string& block) {
+
+    const boost::uint32_t loggerId = intern(record.loggerName, block);
+
+    append(block, (boost::uint8_t) ENTRY_RECORD);
+    append(block, record.timestamp);
+    append(block, loggerId);
+    append(block, (boost::int32_t) record.level);
+    append(block, record.threadId);
+
+    if (record.message.empty()) {
+        message.clear();
+        record.deferredMessage.format(messageStream);
+        appendString(block, message.data(), message.size());
+    } else {
+        appendString(block, record.message.data(), record.message.size());
+    }
+
+}
+
+}
+}
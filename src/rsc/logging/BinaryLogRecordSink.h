@@ -0,0 +1,139 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "FileLogRecordSink.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A FileLogRecordSink writing records in a compact binary format instead of
+ * text. Encoding a record only copies its fields into the memory block, the
+ * name of a logger is written only once per file and then referenced by a
+ * numeric id. Use BinaryLogReader or the @c rsc-binlog-decode tool to
+ * convert files back to the text layout.
+ *
+ * A new file starts with a header:
+ *  - 8 bytes #MAGIC
+ *  - uint32 #VERSION
+ *  - uint32 #BYTE_ORDER_MARK
+ *
+ * The header is followed by entries, each starting with a uint8 EntryType:
+ *  - ENTRY_NAME: uint32 id, uint32 length, name bytes
+ *  - ENTRY_RECORD: uint64 timestamp, uint32 logger id, int32 level,
+ *    uint32 thread id, uint32 length, message bytes
+ *
+ * All numbers are stored in the byte order of the writing host, which is
+ * detected by readers through the byte-order mark. A name entry precedes the
+ * first record referencing its id in each file. If records are appended to
+ * an existing file, ids may be redefined by later name entries.
+ *
+ * Rotation and all other options are handled as in FileLogRecordSink.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT BinaryLogRecordSink: public FileLogRecordSink {
+public:
+
+    /**
+     * Types of entries in a file.
+     */
+    enum EntryType {
+        ENTRY_NAME = 1, ENTRY_RECORD = 2
+    };
+
+    /**
+     * Bytes at the beginning of each file.
+     */
+    static const char MAGIC[8];
+
+    /**
+     * Version of the format written by this class.
+     */
+    static const boost::uint32_t VERSION;
+
+    /**
+     * Value written in the header to detect the byte order.
+     */
+    static const boost::uint32_t BYTE_ORDER_MARK;
+
+    /**
+     * Creates a new sink. The file is opened with the first written record.
+     *
+     * @param options initial options
+     * @throw std::invalid_argument compression requested but not supported
+     */
+    explicit BinaryLogRecordSink(const Options& options = defaultOptions());
+
+    virtual ~BinaryLogRecordSink();
+
+    /**
+     * Returns the default options for binary files, which only differ from
+     * the defaults of FileLogRecordSink in the path @c rsc.binlog.
+     *
+     * @return default options
+     */
+    static Options defaultOptions();
+
+protected:
+
+    void encode(const LogRecord& record, std::string& block);
+    void beginFile(const bool& empty, std::string& block);
+
+private:
+
+    /**
+     * Returns the id of a logger name in the current file and appends a name
+     * entry to the block if the name is new.
+     */
+    boost::uint32_t intern(const boost::shared_ptr<const std::string>& name,
+            std::string& block);
+
+    // the same name object is passed with every record of a logger, hence
+    // names are first looked up by identity and only then by value
+    std::map<boost::shared_ptr<const std::string>, boost::uint32_t> nameObjects;
+    std::map<std::string, boost::uint32_t> names;
+
+    // deferred messages are formatted here to determine their length
+    std::string message;
+    BlockBuffer messageBuffer;
+    std::ostream messageStream;
+
+};
+
+}
+}
@@ -0,0 +1,70 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "BinaryLoggingSystem.h"
+
+#include "BinaryLogRecordSink.h"
+#include "../misc/Registry.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+string BinaryLoggingSystem::getName() {
+    return "BinaryLoggingSystem";
+}
+
+BinaryLoggingSystem::BinaryLoggingSystem() :
+        FileLoggingSystem(BinaryLogRecordSink::defaultOptions()) {
+}
+
+BinaryLoggingSystem::BinaryLoggingSystem(
+        const FileLogRecordSink::Options& options,
+        const unsigned int& capacity,
+        const AsyncLogWriter::OverflowPolicy& policy) :
+        FileLoggingSystem(options, capacity, policy) {
+}
+
+BinaryLoggingSystem::~BinaryLoggingSystem() {
+}
+
+string BinaryLoggingSystem::getRegistryKey() const {
+    return getName();
+}
+
+boost::shared_ptr<FileLogRecordSink> BinaryLoggingSystem::createSink(
+        const FileLogRecordSink::Options& options) {
+    return boost::shared_ptr<FileLogRecordSink>(
+            new BinaryLogRecordSink(options));
+}
+
+CREATE_GLOBAL_REGISTREE_MSG(loggingSystemRegistry(), new BinaryLoggingSystem, BinaryLoggingSystem, "Could it be that you have linked two different versions of RSC in your program?")
+;
+
+}
+}
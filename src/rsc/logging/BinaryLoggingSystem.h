@@ -0,0 +1,80 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <string>
+
+#include "FileLoggingSystem.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A FileLoggingSystem writing the compact binary format of
+ * BinaryLogRecordSink instead of text. The default path is @c rsc.binlog.
+ * Options are the same as for FileLoggingSystem and can be set by
+ * OptionBasedConfigurator below @c rsc.logging.binary.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT BinaryLoggingSystem: public FileLoggingSystem {
+public:
+
+    /**
+     * Creates a system with default options.
+     */
+    BinaryLoggingSystem();
+
+    /**
+     * Creates a system with the given options.
+     *
+     * @param options options of the file sink
+     * @param capacity capacity of the message buffer
+     * @param policy behavior if the message buffer is full
+     */
+    BinaryLoggingSystem(const FileLogRecordSink::Options& options,
+            const unsigned int& capacity = AsyncLogWriter::DEFAULT_CAPACITY,
+            const AsyncLogWriter::OverflowPolicy& policy =
+                    AsyncLogWriter::OVERFLOW_BLOCK);
+
+    virtual ~BinaryLoggingSystem();
+
+    std::string getRegistryKey() const;
+
+    static std::string getName();
+
+protected:
+
+    boost::shared_ptr<FileLogRecordSink> createSink(
+            const FileLogRecordSink::Options& options);
+
+};
+
+}
+}
@@ -28,7 +28,7 @@
 
 #include <iostream>
 
-#include "../misc/langutils.h"
+#include "../misc/Clock.h"
 
 using namespace std;
 
@@ -48,13 +48,11 @@ ConsoleLogger::~ConsoleLogger() {
 }
 
 Logger::Level ConsoleLogger::getLevel() const {
-    boost::recursive_mutex::scoped_lock lock(mutex);
-    return level;
+    return (Level) level.load(boost::memory_order_relaxed);
 }
 
 void ConsoleLogger::setLevel(const Logger::Level& level) {
-    boost::recursive_mutex::scoped_lock lock(mutex);
-    this->level = level;
+    this->level.store(level, boost::memory_order_relaxed);
 }
 
 string ConsoleLogger::getName() const {
@@ -68,16 +66,27 @@ void ConsoleLogger::setName(const string& name) {
 }
 
 ostream& ConsoleLogger::printHeader(ostream& stream, const Level& level) {
-    return stream << rsc::misc::currentTimeMillis() << " " << this->name
+    return stream << rsc::misc::coarseTimeMillis() << " " << this->name
             << " [" << level << "]: ";
 }
 
 void ConsoleLogger::log(const Level& level, const string& msg) {
+    if (!isEnabledFor(level)) {
+        return;
+    }
     boost::recursive_mutex::scoped_lock lock(mutex);
-    if (isEnabledFor(level)) {
-        printHeader(cerr, level);
-        cerr << msg << endl;
+    printHeader(cerr, level);
+    cerr << msg << endl;
+}
+
+void ConsoleLogger::logDeferred(const Level& level,
+        const DeferredMessage& msg) {
+    if (!isEnabledFor(level)) {
+        return;
     }
+    boost::recursive_mutex::scoped_lock lock(mutex);
+    printHeader(cerr, level);
+    msg.format(cerr) << endl;
 }
 
 }
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <boost/atomic.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 
 #include "Logger.h"
@@ -57,6 +58,7 @@ public:
     void setName(const std::string& name);
 
     void log(const Level& level, const std::string& msg);
+    void logDeferred(const Level& level, const DeferredMessage& msg);
 
 private:
 
@@ -71,7 +73,12 @@ private:
     std::ostream& printHeader(std::ostream& stream, const Level& level);
 
     std::string name;
-    Level level;
+
+    /**
+     * The level is kept outside of #mutex so that level checks do not need
+     * to acquire a lock.
+     */
+    boost::atomic<int> level;
 
     mutable boost::recursive_mutex mutex;
 
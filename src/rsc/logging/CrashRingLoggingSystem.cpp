@@ -0,0 +1,716 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "CrashRingLoggingSystem.h"
+
+#include <errno.h>
+#include <fcntl.h>
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef DEBUGTOOLS_LINUX
+#include <execinfo.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/atomic.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+#include "AsyncLogWriter.h"
+#include "../debug/DebugTools.h"
+#include "../misc/Clock.h"
+#include "../misc/CrashHandler.h"
+#include "../misc/Registry.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+namespace {
+
+/**
+ * A single record in a ring. All data is stored inline so that recording
+ * does not allocate memory.
+ */
+struct CrashRecord {
+
+    CrashRecord() :
+            timestamp(0), level(Logger::LEVEL_OFF), threadId(0) {
+        name[0] = '\0';
+        message[0] = '\0';
+    }
+
+    boost::uint64_t timestamp;
+    Logger::Level level;
+    boost::uint32_t threadId;
+    char name[CrashRingLoggingSystem::MAX_NAME_LENGTH + 1];
+
+    /**
+     * Formatted message, empty if #deferredMessage is used.
+     */
+    char message[CrashRingLoggingSystem::MAX_MESSAGE_LENGTH + 1];
+    DeferredMessage deferredMessage;
+
+};
+
+void copyTruncated(char* target, const std::size_t& maxLength,
+        const string& source) {
+    const std::size_t length = min(maxLength, source.size());
+    memcpy(target, source.data(), length);
+    target[length] = '\0';
+}
+
+const char* levelName(const Logger::Level& level) {
+    switch (level) {
+    case Logger::LEVEL_ALL:
+        return "ALL";
+    case Logger::LEVEL_TRACE:
+        return "TRACE";
+    case Logger::LEVEL_DEBUG:
+        return "DEBUG";
+    case Logger::LEVEL_INFO:
+        return "INFO";
+    case Logger::LEVEL_WARN:
+        return "WARN";
+    case Logger::LEVEL_ERROR:
+        return "ERROR";
+    case Logger::LEVEL_FATAL:
+        return "FATAL";
+    case Logger::LEVEL_OFF:
+        return "OFF";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * Writes all bytes to a file descriptor using only async-signal-safe calls.
+ */
+void writeFully(const int& fd, const char* data, std::size_t length) {
+    while (length > 0) {
+        const int written = ::write(fd, data, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        length -= written;
+    }
+}
+
+/**
+ * Buffers for dumping from a signal handler, which must not allocate memory.
+ * The crash handler runs only one handler at a time.
+ */
+const std::size_t SIGNAL_LINE_LENGTH = 2 * DeferredMessage::CAPACITY
+        + CrashRingLoggingSystem::MAX_NAME_LENGTH
+        + CrashRingLoggingSystem::MAX_MESSAGE_LENGTH + 64;
+char signalLine[SIGNAL_LINE_LENGTH];
+CrashRecord signalRecord;
+
+/**
+ * Records of a single thread. Only the owning thread writes, dumping threads
+ * and signal handlers only read. Each slot carries a sequence number which is
+ * odd while the slot is written, so that readers can copy a record out and
+ * detect whether it was modified concurrently (a seqlock).
+ */
+class Ring {
+public:
+
+    explicit Ring(const unsigned int& capacity) :
+            nextRing(0), slots(new Slot[capacity]), capacity(capacity), written(
+                    0) {
+    }
+
+    /**
+     * Returns the record to fill next. The record becomes visible to dumps
+     * with #commit.
+     */
+    CrashRecord& next() {
+        const boost::uint64_t index = written.load(boost::memory_order_relaxed);
+        Slot& slot = slots[index % capacity];
+        slot.sequence.store(2 * index + 1, boost::memory_order_relaxed);
+        boost::atomic_thread_fence(boost::memory_order_release);
+        return slot.record;
+    }
+
+    void commit() {
+        const boost::uint64_t index = written.load(boost::memory_order_relaxed);
+        slots[index % capacity].sequence.store(2 * index + 2,
+                boost::memory_order_release);
+        written.store(index + 1, boost::memory_order_release);
+    }
+
+    void dump(ostream& stream) const {
+        CrashRecord record;
+        const boost::uint64_t count = written.load(boost::memory_order_acquire);
+        for (boost::uint64_t i = first(count); i < count; ++i) {
+            if (!read(i, record)) {
+                continue;
+            }
+            stream << record.timestamp << " [thread " << record.threadId
+                    << "] " << record.name << " [" << record.level << "]: ";
+            if (record.message[0] == '\0') {
+                record.deferredMessage.format(stream);
+            } else {
+                stream << record.message;
+            }
+            stream << '\n';
+        }
+    }
+
+    /**
+     * Writes the records to a file descriptor using only async-signal-safe
+     * calls.
+     */
+    void dumpSignalSafe(const int& fd) const {
+        const boost::uint64_t count = written.load(boost::memory_order_acquire);
+        for (boost::uint64_t i = first(count); i < count; ++i) {
+            if (!read(i, signalRecord)) {
+                continue;
+            }
+            DeferredMessage header;
+            header << signalRecord.timestamp << " [thread "
+                    << signalRecord.threadId << "] " << signalRecord.name
+                    << " [" << levelName(signalRecord.level) << "]: ";
+            std::size_t length = header.formatSignalSafe(signalLine,
+                    SIGNAL_LINE_LENGTH - 1);
+            if (signalRecord.message[0] == '\0') {
+                length += signalRecord.deferredMessage.formatSignalSafe(
+                        signalLine + length, SIGNAL_LINE_LENGTH - 1 - length);
+            } else {
+                const std::size_t messageLength = min(
+                        strlen(signalRecord.message),
+                        SIGNAL_LINE_LENGTH - 1 - length);
+                memcpy(signalLine + length, signalRecord.message,
+                        messageLength);
+                length += messageLength;
+            }
+            signalLine[length++] = '\n';
+            writeFully(fd, signalLine, length);
+        }
+    }
+
+    /**
+     * Next ring in the list of CrashRings which is traversed without locking.
+     */
+    Ring* nextRing;
+
+private:
+
+    struct Slot {
+        Slot() :
+                sequence(0) {
+        }
+        boost::atomic<boost::uint64_t> sequence;
+        CrashRecord record;
+    };
+
+    boost::uint64_t first(const boost::uint64_t& count) const {
+        return count > capacity ? count - capacity : 0;
+    }
+
+    /**
+     * Copies the record with the given index. Fails if the record has been
+     * overwritten or is modified while copying.
+     */
+    bool read(const boost::uint64_t& index, CrashRecord& copy) const {
+        const Slot& slot = slots[index % capacity];
+        const boost::uint64_t sequence = 2 * index + 2;
+        if (slot.sequence.load(boost::memory_order_acquire) != sequence) {
+            return false;
+        }
+        memcpy(static_cast<void*>(&copy), &slot.record, sizeof(CrashRecord));
+        boost::atomic_thread_fence(boost::memory_order_acquire);
+        if (slot.sequence.load(boost::memory_order_relaxed) != sequence) {
+            return false;
+        }
+        return true;
+    }
+
+    boost::scoped_array<Slot> slots;
+    const boost::uint64_t capacity;
+    boost::atomic<boost::uint64_t> written;
+
+};
+
+}
+
+/**
+ * Shared state of a CrashRingLoggingSystem and its loggers.
+ *
+ * @author jwienke
+ */
+class CrashRings: public boost::enable_shared_from_this<CrashRings> {
+public:
+
+    CrashRings(const string& path, const unsigned int& records,
+            const bool& signals) :
+            records(records), signals(signals), signalsRegistered(false), signalRings(
+                    0) {
+        if (records == 0) {
+            throw invalid_argument("At least one record per thread required.");
+        }
+        signalPaths[0][0] = '\0';
+        signalPaths[1][0] = '\0';
+        signalPath.store(signalPaths[0]);
+        setPath(path);
+    }
+
+    ~CrashRings() {
+        if (signalsRegistered) {
+            rsc::misc::removeCrashCallback(&CrashRings::onCrash, this);
+        }
+    }
+
+    /**
+     * Returns the ring of the calling thread, acquiring one on first use.
+     */
+    Ring& current();
+
+    /**
+     * Makes the ring of a terminated thread available for reuse.
+     */
+    void release(Ring* ring) {
+        boost::mutex::scoped_lock lock(mutex);
+        free.push_back(ring);
+    }
+
+    /**
+     * Registers the crash callback if requested and not done yet.
+     */
+    void registerSignals() {
+        boost::mutex::scoped_lock lock(mutex);
+        if (signals && !signalsRegistered) {
+#ifdef DEBUGTOOLS_LINUX
+            // loads the unwinder now, which is not possible in the handler
+            void* frame;
+            ::backtrace(&frame, 1);
+#endif
+            rsc::misc::addCrashCallback(&CrashRings::onCrash, this);
+            signalsRegistered = true;
+        }
+    }
+
+    /**
+     * Changes the path of the dump file. Requires #mutex to be locked.
+     */
+    void setPath(const string& path) {
+        this->path = path;
+        // write to the buffer not used by signal handlers, paths which do not
+        // fit disable dumping on signals
+        char* target = signalPath.load(boost::memory_order_relaxed)
+                == signalPaths[0] ? signalPaths[1] : signalPaths[0];
+        if (path.size() < sizeof(signalPaths[0])) {
+            memcpy(target, path.c_str(), path.size() + 1);
+        } else {
+            target[0] = '\0';
+        }
+        signalPath.store(target, boost::memory_order_release);
+    }
+
+    void dump(ostream& stream) const {
+        boost::mutex::scoped_lock lock(mutex);
+        for (vector<boost::shared_ptr<Ring> >::const_iterator it =
+                rings.begin(); it != rings.end(); ++it) {
+            (*it)->dump(stream);
+        }
+    }
+
+    void dumpToFile(const string& reason, const bool& backtrace) {
+        boost::mutex::scoped_lock lock(dumpMutex);
+        string target;
+        {
+            boost::mutex::scoped_lock pathLock(mutex);
+            target = path;
+        }
+        ofstream stream(target.c_str(), ios_base::out | ios_base::app);
+        if (!stream) {
+            throw runtime_error("Unable to open crash dump file " + target);
+        }
+        stream << "=== Crash ring dump at " << rsc::misc::coarseTimeMillis()
+                << ": " << reason << " ===\n";
+        dump(stream);
+        if (backtrace) {
+            debug::DebugToolsPtr tools = debug::DebugTools::newInstance();
+            stream << "Backtrace:\n"
+                    << tools->formatBacktrace(tools->createBacktrace(64));
+        }
+        stream.flush();
+        if (!stream) {
+            throw runtime_error("Unable to write crash dump file " + target);
+        }
+    }
+
+    /**
+     * Appends all rings and a backtrace to the dump file using only
+     * async-signal-safe calls. No lock is taken, the crashed thread may hold
+     * any of them.
+     */
+    void dumpOnSignal(const int& signal) const {
+        const int savedErrno = errno;
+        const char* target = signalPath.load(boost::memory_order_acquire);
+        const int fd =
+                target[0] == '\0' ?
+                        -1 : ::open(target, O_WRONLY | O_APPEND | O_CREAT, 0644);
+        if (fd >= 0) {
+            DeferredMessage header;
+            header << "=== Crash ring dump at " << rsc::misc::coarseTimeMillis()
+                    << ": signal " << signal << " ===\n";
+            writeFully(fd, signalLine,
+                    header.formatSignalSafe(signalLine, SIGNAL_LINE_LENGTH));
+            for (const Ring* ring = signalRings.load(
+                    boost::memory_order_acquire); ring; ring = ring->nextRing) {
+                ring->dumpSignalSafe(fd);
+            }
+#ifdef DEBUGTOOLS_LINUX
+            const char* const backtraceHeader = "Backtrace:\n";
+            writeFully(fd, backtraceHeader, strlen(backtraceHeader));
+            void* frames[64];
+            ::backtrace_symbols_fd(frames, ::backtrace(frames, 64), fd);
+#endif
+            ::close(fd);
+        }
+        errno = savedErrno;
+    }
+
+    static void onCrash(int signal, void* context) {
+        static_cast<const CrashRings*>(context)->dumpOnSignal(signal);
+    }
+
+    mutable boost::mutex mutex;
+    unsigned int records;
+    bool signals;
+
+    /**
+     * Path of the dump file, only changed through #setPath.
+     */
+    string path;
+
+private:
+
+    bool signalsRegistered;
+    vector<boost::shared_ptr<Ring> > rings;
+    vector<Ring*> free;
+
+    /**
+     * Copies of #path for signal handlers, which read the current one without
+     * locking.
+     */
+    char signalPaths[2][4096];
+    boost::atomic<char*> signalPath;
+
+    /**
+     * Head of the list of all rings linked through Ring::nextRing, which
+     * signal handlers traverse without locking.
+     */
+    boost::atomic<Ring*> signalRings;
+
+    boost::mutex dumpMutex;
+
+};
+
+namespace {
+
+/**
+ * The ring a thread uses for one system.
+ */
+struct ThreadRing {
+
+    ThreadRing(boost::shared_ptr<CrashRings> owner,
+            Ring* ring) :
+            owner(owner), ring(ring) {
+    }
+
+    boost::shared_ptr<CrashRings> owner;
+    Ring* ring;
+
+};
+
+/**
+ * All rings of a thread, released when the thread terminates.
+ */
+class ThreadRings: public vector<ThreadRing> {
+public:
+    ~ThreadRings() {
+        for (iterator it = begin(); it != end(); ++it) {
+            it->owner->release(it->ring);
+        }
+    }
+};
+
+boost::thread_specific_ptr<ThreadRings>& threadRings() {
+    static boost::thread_specific_ptr<ThreadRings> rings;
+    return rings;
+}
+
+}
+
+Ring& CrashRings::current() {
+
+    ThreadRings* local = threadRings().get();
+    if (!local) {
+        local = new ThreadRings;
+        threadRings().reset(local);
+    }
+    for (ThreadRings::const_iterator it = local->begin(); it != local->end();
+            ++it) {
+        if (it->owner.get() == this) {
+            return *it->ring;
+        }
+    }
+
+    Ring* ring;
+    bool installStack;
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        installStack = signals;
+        if (free.empty()) {
+            rings.push_back(boost::shared_ptr<Ring>(new Ring(records)));
+            ring = rings.back().get();
+            ring->nextRing = signalRings.load(boost::memory_order_relaxed);
+            signalRings.store(ring, boost::memory_order_release);
+        } else {
+            ring = free.back();
+            free.pop_back();
+        }
+    }
+    local->push_back(ThreadRing(shared_from_this(), ring));
+
+    if (installStack) {
+        // dump on stack overflows of this thread as well
+        try {
+            rsc::misc::installCrashStack();
+        } catch (const std::exception& e) {
+            cerr << "Unable to install crash stack: " << e.what() << endl;
+        }
+    }
+
+    return *ring;
+
+}
+
+namespace {
+
+/**
+ * Logger recording into the ring of the calling thread.
+ *
+ * @author jwienke
+ */
+class CrashRingLogger: public Logger {
+public:
+
+    CrashRingLogger(const string& name,
+            boost::shared_ptr<CrashRings> rings) :
+            rings(rings), level(LEVEL_INFO), name(new string(name)) {
+    }
+
+    Level getLevel() const {
+        return (Level) level.load(boost::memory_order_relaxed);
+    }
+
+    void setLevel(const Level& level) {
+        this->level.store(level, boost::memory_order_relaxed);
+    }
+
+    string getName() const {
+        return *boost::atomic_load(&name);
+    }
+
+    void setName(const string& name) {
+        boost::atomic_store(&this->name,
+                boost::shared_ptr<const string>(new string(name)));
+    }
+
+    void log(const Level& level, const string& msg) {
+        if (!isEnabledFor(level)) {
+            return;
+        }
+        Ring& ring = rings->current();
+        CrashRecord& record = begin(ring, level);
+        copyTruncated(record.message, CrashRingLoggingSystem::MAX_MESSAGE_LENGTH,
+                msg);
+        record.deferredMessage.clear();
+        commit(ring, level);
+    }
+
+    void logDeferred(const Level& level, const DeferredMessage& msg) {
+        if (!isEnabledFor(level)) {
+            return;
+        }
+        Ring& ring = rings->current();
+        CrashRecord& record = begin(ring, level);
+        record.message[0] = '\0';
+        record.deferredMessage = msg;
+        commit(ring, level);
+    }
+
+private:
+
+    CrashRecord& begin(Ring& ring, const Level& level) {
+        CrashRecord& record = ring.next();
+        record.timestamp = rsc::misc::coarseTimeMillis();
+        record.level = level;
+        record.threadId = currentLogThreadId();
+        copyTruncated(record.name, CrashRingLoggingSystem::MAX_NAME_LENGTH,
+                *boost::atomic_load(&name));
+        return record;
+    }
+
+    void commit(Ring& ring, const Level& level) {
+        ring.commit();
+        if (level == LEVEL_FATAL) {
+            try {
+                rings->dumpToFile("fatal message", true);
+            } catch (const std::exception& e) {
+                cerr << "Unable to dump crash ring: " << e.what() << endl;
+            }
+        }
+    }
+
+    boost::shared_ptr<CrashRings> rings;
+    boost::atomic<int> level;
+    boost::shared_ptr<const string> name;
+
+};
+
+}
+
+const unsigned int CrashRingLoggingSystem::DEFAULT_RECORDS;
+const unsigned int CrashRingLoggingSystem::MAX_MESSAGE_LENGTH;
+const unsigned int CrashRingLoggingSystem::MAX_NAME_LENGTH;
+
+string CrashRingLoggingSystem::getName() {
+    return "CrashRingLoggingSystem";
+}
+
+CrashRingLoggingSystem::CrashRingLoggingSystem() :
+        rings(new CrashRings("rsc-crash.log", DEFAULT_RECORDS, true)) {
+}
+
+CrashRingLoggingSystem::CrashRingLoggingSystem(const string& path,
+        const unsigned int& records, const bool& signals) :
+        rings(new CrashRings(path, records, signals)) {
+}
+
+CrashRingLoggingSystem::~CrashRingLoggingSystem() {
+}
+
+string CrashRingLoggingSystem::getRegistryKey() const {
+    return getName();
+}
+
+LoggerPtr CrashRingLoggingSystem::createLogger(const string& name) {
+    rings->registerSignals();
+    return LoggerPtr(new CrashRingLogger(name, rings));
+}
+
+void CrashRingLoggingSystem::setOption(const string& name,
+        const string& value) {
+
+    const string key = boost::algorithm::to_lower_copy(name);
+    const string trimmed = boost::algorithm::trim_copy(value);
+
+    boost::mutex::scoped_lock lock(rings->mutex);
+    if (key == "path") {
+        rings->setPath(trimmed);
+    } else if (key == "records") {
+        unsigned int records = 0;
+        try {
+            records = boost::lexical_cast<unsigned int>(trimmed);
+        } catch (const boost::bad_lexical_cast&) {
+        }
+        if (records == 0) {
+            throw invalid_argument(
+                    "Invalid number '" + value + "' for option " + name
+                            + ".");
+        }
+        rings->records = records;
+    } else if (key == "signals") {
+        const string normalized = boost::algorithm::to_lower_copy(trimmed);
+        if (normalized == "true" || normalized == "1" || normalized == "yes"
+                || normalized == "on") {
+            rings->signals = true;
+        } else if (normalized == "false" || normalized == "0"
+                || normalized == "no" || normalized == "off") {
+            rings->signals = false;
+        } else {
+            throw invalid_argument(
+                    "Invalid boolean '" + value + "' for option " + name
+                            + ".");
+        }
+    } else {
+        throw invalid_argument(
+                "Unknown option " + name + " for " + getRegistryKey() + ".");
+    }
+
+}
+
+bool CrashRingLoggingSystem::isOption(const string& name) {
+    const string key = boost::algorithm::to_lower_copy(name);
+    return key == "path" || key == "records" || key == "signals";
+}
+
+string CrashRingLoggingSystem::getPath() const {
+    boost::mutex::scoped_lock lock(rings->mutex);
+    return rings->path;
+}
+
+unsigned int CrashRingLoggingSystem::getRecords() const {
+    boost::mutex::scoped_lock lock(rings->mutex);
+    return rings->records;
+}
+
+void CrashRingLoggingSystem::dump(const string& reason) {
+    rings->dumpToFile(reason, false);
+}
+
+void CrashRingLoggingSystem::dump(ostream& stream) const {
+    rings->dump(stream);
+}
+
+CREATE_GLOBAL_REGISTREE_MSG(loggingSystemRegistry(), new CrashRingLoggingSystem, CrashRingLoggingSystem, "Could it be that you have linked two different versions of RSC in your program?")
+;
+
+}
+}
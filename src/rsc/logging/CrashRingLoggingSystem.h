@@ -0,0 +1,168 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LoggingSystem.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+class CrashRings;
+
+/**
+ * A logging system which keeps the most recent records of each thread in
+ * preallocated in-memory rings instead of writing them. Logging a record only
+ * copies it into the ring of the calling thread without locking or
+ * allocating memory, hence this system can be used with level @c TRACE in
+ * production to have the full history available when a process crashes.
+ *
+ * The rings are dumped in text form, oldest records first, by appending to
+ * the dump file:
+ *  - when a message with level @c FATAL is logged
+ *  - when the process receives a fatal signal, if enabled
+ *  - on demand through #dump
+ *
+ * Rings of terminated threads are reused for new threads, so that their
+ * records remain available until they are overwritten. Records which are
+ * overwritten by their thread while being dumped are skipped. Dumps on
+ * signals only use async-signal-safe functions and take no locks.
+ *
+ * The system can be configured through #setOption, which is used by
+ * OptionBasedConfigurator for the keys below @c rsc.logging.crashring:
+ *  - @c path: path of the dump file
+ *  - @c records: number of records kept per thread, applies to threads
+ *    logging for the first time after the change
+ *  - @c signals: dump on fatal signals (true or false), takes effect with
+ *    the first logger created by this system. Threads logging to the system
+ *    get an alternate signal stack, so that stack overflows are dumped as
+ *    well.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT CrashRingLoggingSystem: public LoggingSystem {
+public:
+
+    /**
+     * Default number of records kept per thread.
+     */
+    static const unsigned int DEFAULT_RECORDS = 512;
+
+    /**
+     * Maximum number of characters of a formatted message and of a logger
+     * name which are kept. Longer ones are truncated.
+     */
+    static const unsigned int MAX_MESSAGE_LENGTH = 255;
+    static const unsigned int MAX_NAME_LENGTH = 63;
+
+    /**
+     * Creates a system dumping to @c rsc-crash.log with default options.
+     */
+    CrashRingLoggingSystem();
+
+    /**
+     * Creates a system with the given options.
+     *
+     * @param path path of the dump file
+     * @param records number of records kept per thread
+     * @param signals dump on fatal signals
+     * @throw std::invalid_argument records is 0
+     */
+    CrashRingLoggingSystem(const std::string& path,
+            const unsigned int& records = DEFAULT_RECORDS,
+            const bool& signals = true);
+
+    virtual ~CrashRingLoggingSystem();
+
+    std::string getRegistryKey() const;
+
+    LoggerPtr createLogger(const std::string& name);
+
+    /**
+     * Changes a single option.
+     *
+     * @param name name of the option, case-insensitive
+     * @param value new value
+     * @throw std::invalid_argument unknown option or invalid value
+     */
+    void setOption(const std::string& name, const std::string& value);
+
+    /**
+     * Tells whether #setOption accepts an option.
+     *
+     * @param name name of the option, case-insensitive
+     * @return @c true if the option is known
+     */
+    static bool isOption(const std::string& name);
+
+    /**
+     * Returns the path of the dump file.
+     *
+     * @return path
+     */
+    std::string getPath() const;
+
+    /**
+     * Returns the number of records kept for threads logging for the first
+     * time.
+     *
+     * @return number of records
+     */
+    unsigned int getRecords() const;
+
+    /**
+     * Appends the contents of all rings to the dump file.
+     *
+     * @param reason description of the reason for the dump, written to the
+     *               header of the dump
+     * @throw std::runtime_error the file cannot be written
+     */
+    void dump(const std::string& reason = "requested");
+
+    /**
+     * Writes the contents of all rings to a stream.
+     *
+     * @param stream stream to write to
+     */
+    void dump(std::ostream& stream) const;
+
+    static std::string getName();
+
+private:
+
+    boost::shared_ptr<CrashRings> rings;
+
+};
+
+}
+}
@@ -0,0 +1,641 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "DeferredMessage.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <sstream>
+
+#include <boost/thread/tss.hpp>
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+namespace {
+
+/**
+ * Length prefix of string arguments.
+ */
+typedef boost::uint16_t StringLength;
+
+/**
+ * The stream reused for formatting arguments of arbitrary types in one
+ * thread.
+ */
+struct ThreadStream {
+    ThreadStream() :
+            stream(0), busy(false) {
+    }
+    ostream stream;
+    bool busy;
+};
+
+boost::thread_specific_ptr<ThreadStream>& threadStreams() {
+    static boost::thread_specific_ptr<ThreadStream> streams;
+    return streams;
+}
+
+const char* const NULL_STRING = "(null)";
+const char* const ELLIPSIS = "...";
+
+/**
+ * Formats values into a fixed buffer without allocating memory or using
+ * streams. Everything which does not fit is dropped.
+ */
+class SignalSafeWriter {
+public:
+
+    SignalSafeWriter(char* buffer, const size_t& size) :
+            buffer(buffer), size(size), used(0) {
+    }
+
+    size_t getUsed() const {
+        return used;
+    }
+
+    void write(const char* data, const size_t& length) {
+        const size_t count = min(length, size - used);
+        memcpy(buffer + used, data, count);
+        used += count;
+    }
+
+    void write(const char* data) {
+        write(data, strlen(data));
+    }
+
+    void write(const char& c) {
+        write(&c, 1);
+    }
+
+    void writeUnsigned(boost::ulong_long_type value,
+            const unsigned int& base = 10) {
+        char digits[64];
+        size_t pos = sizeof(digits);
+        do {
+            digits[--pos] = "0123456789abcdef"[value % base];
+            value /= base;
+        } while (value != 0);
+        write(digits + pos, sizeof(digits) - pos);
+    }
+
+    void writeSigned(const boost::long_long_type& value) {
+        if (value < 0) {
+            write('-');
+            // negate unsigned to handle the minimum value
+            writeUnsigned(0 - (boost::ulong_long_type) value);
+        } else {
+            writeUnsigned(value);
+        }
+    }
+
+    void writeFloating(long double value) {
+        if (value != value) {
+            write("nan");
+            return;
+        }
+        if (value < 0) {
+            write('-');
+            value = -value;
+        }
+        if (value > numeric_limits<long double>::max()) {
+            write("inf");
+            return;
+        }
+        // the integral part has to fit into an integer
+        unsigned int exponent = 0;
+        if (value >= 1e18L) {
+            while (value >= 10) {
+                value /= 10;
+                ++exponent;
+            }
+        }
+        boost::ulong_long_type integral = (boost::ulong_long_type) value;
+        boost::ulong_long_type fraction = (boost::ulong_long_type) ((value
+                - integral) * 1e6L + 0.5L);
+        if (fraction >= 1000000) {
+            ++integral;
+            fraction -= 1000000;
+        }
+        writeUnsigned(integral);
+        if (fraction != 0) {
+            char digits[6];
+            for (int i = 5; i >= 0; --i) {
+                digits[i] = '0' + fraction % 10;
+                fraction /= 10;
+            }
+            size_t length = sizeof(digits);
+            while (digits[length - 1] == '0') {
+                --length;
+            }
+            write('.');
+            write(digits, length);
+        }
+        if (exponent != 0) {
+            write("e+");
+            writeUnsigned(exponent);
+        }
+    }
+
+private:
+
+    char* buffer;
+    size_t size;
+    size_t used;
+
+};
+
+}
+
+const size_t DeferredMessage::CAPACITY;
+
+DeferredMessage::ArgumentBuffer::ArgumentBuffer(char* begin, char* end) :
+        overflowed(false) {
+    setp(begin, end);
+}
+
+size_t DeferredMessage::ArgumentBuffer::size() const {
+    return pptr() - pbase();
+}
+
+bool DeferredMessage::ArgumentBuffer::isOverflowed() const {
+    return overflowed;
+}
+
+DeferredMessage::ArgumentBuffer::int_type DeferredMessage::ArgumentBuffer::overflow(
+        int_type /*c*/) {
+    overflowed = true;
+    return traits_type::eof();
+}
+
+DeferredMessage::FormattedArgument::FormattedArgument(DeferredMessage& message) :
+        message(message), reserved(
+                !message.truncated
+                        && message.used + 1 + sizeof(StringLength)
+                                <= DeferredMessage::CAPACITY), buffer(
+                reinterpret_cast<char*>(message.data)
+                        + min(DeferredMessage::CAPACITY,
+                                message.used + 1 + sizeof(StringLength)),
+                reinterpret_cast<char*>(message.data)
+                        + DeferredMessage::CAPACITY), stream(0), ownStream(
+                false) {
+
+    ThreadStream* threadStream = threadStreams().get();
+    if (!threadStream) {
+        threadStream = new ThreadStream;
+        threadStreams().reset(threadStream);
+    }
+
+    if (threadStream->busy) {
+        // an argument's stream operator logs a deferred message itself
+        stream = new ostream(&buffer);
+        ownStream = true;
+    } else {
+        threadStream->busy = true;
+        stream = &threadStream->stream;
+        stream->rdbuf(&buffer);
+    }
+
+}
+
+DeferredMessage::FormattedArgument::~FormattedArgument() {
+
+    if (ownStream) {
+        delete stream;
+    } else {
+        // restore defaults for the next argument
+        stream->rdbuf(0);
+        stream->flags(ios_base::dec | ios_base::skipws);
+        stream->precision(6);
+        stream->width(0);
+        stream->fill(' ');
+        threadStreams()->busy = false;
+    }
+
+    if (!reserved || buffer.isOverflowed()) {
+        message.truncated = true;
+    }
+    if (reserved && buffer.size() > 0) {
+        const StringLength length = buffer.size();
+        message.data[message.used] = (unsigned char) TAG_STRING;
+        memcpy(message.data + message.used + 1, &length, sizeof(length));
+        message.used += 1 + sizeof(length) + length;
+    }
+
+}
+
+ostream& DeferredMessage::FormattedArgument::getStream() {
+    return *stream;
+}
+
+DeferredMessage::DeferredMessage() :
+        used(0), truncated(false) {
+}
+
+DeferredMessage::DeferredMessage(const DeferredMessage& other) :
+        used(other.used), truncated(other.truncated) {
+    memcpy(data, other.data, used);
+}
+
+DeferredMessage& DeferredMessage::operator=(const DeferredMessage& other) {
+    if (this != &other) {
+        used = other.used;
+        truncated = other.truncated;
+        memcpy(data, other.data, used);
+    }
+    return *this;
+}
+
+void DeferredMessage::clear() {
+    used = 0;
+    truncated = false;
+}
+
+bool DeferredMessage::empty() const {
+    return used == 0 && !truncated;
+}
+
+bool DeferredMessage::isTruncated() const {
+    return truncated;
+}
+
+ostream& DeferredMessage::format(ostream& stream) const {
+
+    // captured manipulators must not change the stream for other clients
+    const ios_base::fmtflags flags = stream.flags();
+    const streamsize precision = stream.precision();
+    const char fill = stream.fill();
+
+    size_t pos = 0;
+    while (pos < used) {
+
+        const Tag tag = (Tag) data[pos];
+        const unsigned char* value = data + pos + 1;
+
+        switch (tag) {
+        case TAG_BOOL:
+            stream << read<bool>(value);
+            pos += 1 + sizeof(bool);
+            break;
+        case TAG_CHAR:
+            stream << read<char>(value);
+            pos += 1 + sizeof(char);
+            break;
+        case TAG_SIGNED_CHAR:
+            stream << read<signed char>(value);
+            pos += 1 + sizeof(signed char);
+            break;
+        case TAG_UNSIGNED_CHAR:
+            stream << read<unsigned char>(value);
+            pos += 1 + sizeof(unsigned char);
+            break;
+        case TAG_SHORT:
+            stream << read<short>(value);
+            pos += 1 + sizeof(short);
+            break;
+        case TAG_UNSIGNED_SHORT:
+            stream << read<unsigned short>(value);
+            pos += 1 + sizeof(unsigned short);
+            break;
+        case TAG_INT:
+            stream << read<int>(value);
+            pos += 1 + sizeof(int);
+            break;
+        case TAG_UNSIGNED_INT:
+            stream << read<unsigned int>(value);
+            pos += 1 + sizeof(unsigned int);
+            break;
+        case TAG_LONG:
+            stream << read<long>(value);
+            pos += 1 + sizeof(long);
+            break;
+        case TAG_UNSIGNED_LONG:
+            stream << read<unsigned long>(value);
+            pos += 1 + sizeof(unsigned long);
+            break;
+        case TAG_LONG_LONG:
+            stream << read<boost::long_long_type>(value);
+            pos += 1 + sizeof(boost::long_long_type);
+            break;
+        case TAG_UNSIGNED_LONG_LONG:
+            stream << read<boost::ulong_long_type>(value);
+            pos += 1 + sizeof(boost::ulong_long_type);
+            break;
+        case TAG_FLOAT:
+            stream << read<float>(value);
+            pos += 1 + sizeof(float);
+            break;
+        case TAG_DOUBLE:
+            stream << read<double>(value);
+            pos += 1 + sizeof(double);
+            break;
+        case TAG_LONG_DOUBLE:
+            stream << read<long double>(value);
+            pos += 1 + sizeof(long double);
+            break;
+        case TAG_POINTER:
+            stream << read<const void*>(value);
+            pos += 1 + sizeof(const void*);
+            break;
+        case TAG_STRING: {
+            const StringLength length = read<StringLength>(value);
+            stream.write(reinterpret_cast<const char*>(value + sizeof(length)),
+                    length);
+            pos += 1 + sizeof(length) + length;
+            break;
+        }
+        case TAG_STREAM_MANIPULATOR:
+            stream << read<StreamManipulator>(value);
+            pos += 1 + sizeof(StreamManipulator);
+            break;
+        case TAG_BASE_MANIPULATOR:
+            stream << read<BaseManipulator>(value);
+            pos += 1 + sizeof(BaseManipulator);
+            break;
+        default:
+            assert(false);
+            pos = used;
+        }
+
+    }
+
+    if (truncated) {
+        stream << ELLIPSIS;
+    }
+
+    stream.flags(flags);
+    stream.precision(precision);
+    stream.fill(fill);
+
+    return stream;
+
+}
+
+size_t DeferredMessage::formatSignalSafe(char* buffer, const size_t& size) const {
+
+    SignalSafeWriter writer(buffer, size);
+
+    size_t pos = 0;
+    while (pos < used) {
+
+        const Tag tag = (Tag) data[pos];
+        const unsigned char* value = data + pos + 1;
+
+        switch (tag) {
+        case TAG_BOOL:
+            writer.write(read<bool>(value) ? '1' : '0');
+            pos += 1 + sizeof(bool);
+            break;
+        case TAG_CHAR:
+            writer.write(read<char>(value));
+            pos += 1 + sizeof(char);
+            break;
+        case TAG_SIGNED_CHAR:
+            writer.write((char) read<signed char>(value));
+            pos += 1 + sizeof(signed char);
+            break;
+        case TAG_UNSIGNED_CHAR:
+            writer.write((char) read<unsigned char>(value));
+            pos += 1 + sizeof(unsigned char);
+            break;
+        case TAG_SHORT:
+            writer.writeSigned(read<short>(value));
+            pos += 1 + sizeof(short);
+            break;
+        case TAG_UNSIGNED_SHORT:
+            writer.writeUnsigned(read<unsigned short>(value));
+            pos += 1 + sizeof(unsigned short);
+            break;
+        case TAG_INT:
+            writer.writeSigned(read<int>(value));
+            pos += 1 + sizeof(int);
+            break;
+        case TAG_UNSIGNED_INT:
+            writer.writeUnsigned(read<unsigned int>(value));
+            pos += 1 + sizeof(unsigned int);
+            break;
+        case TAG_LONG:
+            writer.writeSigned(read<long>(value));
+            pos += 1 + sizeof(long);
+            break;
+        case TAG_UNSIGNED_LONG:
+            writer.writeUnsigned(read<unsigned long>(value));
+            pos += 1 + sizeof(unsigned long);
+            break;
+        case TAG_LONG_LONG:
+            writer.writeSigned(read<boost::long_long_type>(value));
+            pos += 1 + sizeof(boost::long_long_type);
+            break;
+        case TAG_UNSIGNED_LONG_LONG:
+            writer.writeUnsigned(read<boost::ulong_long_type>(value));
+            pos += 1 + sizeof(boost::ulong_long_type);
+            break;
+        case TAG_FLOAT:
+            writer.writeFloating(read<float>(value));
+            pos += 1 + sizeof(float);
+            break;
+        case TAG_DOUBLE:
+            writer.writeFloating(read<double>(value));
+            pos += 1 + sizeof(double);
+            break;
+        case TAG_LONG_DOUBLE:
+            writer.writeFloating(read<long double>(value));
+            pos += 1 + sizeof(long double);
+            break;
+        case TAG_POINTER: {
+            const void* pointer = read<const void*>(value);
+            if (pointer) {
+                writer.write("0x");
+                writer.writeUnsigned((size_t) pointer, 16);
+            } else {
+                writer.write('0');
+            }
+            pos += 1 + sizeof(const void*);
+            break;
+        }
+        case TAG_STRING: {
+            const StringLength length = read<StringLength>(value);
+            writer.write(reinterpret_cast<const char*>(value + sizeof(length)),
+                    length);
+            pos += 1 + sizeof(length) + length;
+            break;
+        }
+        case TAG_STREAM_MANIPULATOR: {
+            const StreamManipulator manipulator = read<StreamManipulator>(
+                    value);
+            if (manipulator
+                    == static_cast<StreamManipulator>(&std::endl<char,
+                            char_traits<char> >)) {
+                writer.write('\n');
+            }
+            pos += 1 + sizeof(StreamManipulator);
+            break;
+        }
+        case TAG_BASE_MANIPULATOR:
+            pos += 1 + sizeof(BaseManipulator);
+            break;
+        default:
+            pos = used;
+        }
+
+    }
+
+    if (truncated) {
+        writer.write(ELLIPSIS);
+    }
+
+    return writer.getUsed();
+
+}
+
+string DeferredMessage::str() const {
+    stringstream stream;
+    format(stream);
+    return stream.str();
+}
+
+DeferredMessage& DeferredMessage::operator<<(bool value) {
+    return append(TAG_BOOL, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(char value) {
+    return append(TAG_CHAR, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(signed char value) {
+    return append(TAG_SIGNED_CHAR, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(unsigned char value) {
+    return append(TAG_UNSIGNED_CHAR, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(short value) {
+    return append(TAG_SHORT, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(unsigned short value) {
+    return append(TAG_UNSIGNED_SHORT, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(int value) {
+    return append(TAG_INT, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(unsigned int value) {
+    return append(TAG_UNSIGNED_INT, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(long value) {
+    return append(TAG_LONG, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(unsigned long value) {
+    return append(TAG_UNSIGNED_LONG, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(boost::long_long_type value) {
+    return append(TAG_LONG_LONG, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(boost::ulong_long_type value) {
+    return append(TAG_UNSIGNED_LONG_LONG, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(float value) {
+    return append(TAG_FLOAT, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(double value) {
+    return append(TAG_DOUBLE, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(long double value) {
+    return append(TAG_LONG_DOUBLE, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(const void* value) {
+    return append(TAG_POINTER, value);
+}
+
+DeferredMessage& DeferredMessage::operator<<(const char* value) {
+    if (!value) {
+        value = NULL_STRING;
+    }
+    return appendString(value, strlen(value));
+}
+
+DeferredMessage& DeferredMessage::operator<<(char* value) {
+    return *this << (const char*) value;
+}
+
+DeferredMessage& DeferredMessage::operator<<(const string& value) {
+    return appendString(value.data(), value.size());
+}
+
+DeferredMessage& DeferredMessage::operator<<(StreamManipulator manipulator) {
+    return append(TAG_STREAM_MANIPULATOR, manipulator);
+}
+
+DeferredMessage& DeferredMessage::operator<<(BaseManipulator manipulator) {
+    return append(TAG_BASE_MANIPULATOR, manipulator);
+}
+
+DeferredMessage& DeferredMessage::appendString(const char* value,
+        const size_t& length) {
+
+    const size_t header = 1 + sizeof(StringLength);
+    if (truncated || used + header >= CAPACITY) {
+        truncated = true;
+        return *this;
+    }
+
+    size_t stored = length;
+    if (used + header + length > CAPACITY) {
+        stored = CAPACITY - used - header;
+        truncated = true;
+    }
+
+    const StringLength storedLength = stored;
+    data[used] = (unsigned char) TAG_STRING;
+    memcpy(data + used + 1, &storedLength, sizeof(storedLength));
+    memcpy(data + used + header, value, stored);
+    used += header + stored;
+
+    return *this;
+
+}
+
+ostream& operator<<(ostream& stream, const DeferredMessage& message) {
+    return message.format(stream);
+}
+
+}
+}
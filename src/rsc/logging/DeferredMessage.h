@@ -0,0 +1,257 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A log message whose arguments are captured in binary form into a
+ * fixed-size buffer and which is formatted only when it is written. Capturing
+ * built-in types, strings and stream manipulators neither allocates memory
+ * nor constructs a stream, hence this class can be used on the stack in
+ * performance-critical code through the RSCDEBUG_DEFERRED family of macros.
+ *
+ * Arguments of other types are formatted immediately with their stream
+ * operator into the buffer using a stream which is reused per thread.
+ * Manipulators only affect the captured built-in types and strings, not
+ * these pre-formatted arguments. Parameterized manipulators like
+ * @c std::setw are not supported.
+ *
+ * If the arguments do not fit into the buffer, the message is truncated and
+ * an ellipsis is appended when formatting.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT DeferredMessage {
+public:
+
+    /**
+     * Number of bytes available for captured arguments including their type
+     * tags.
+     */
+    static const std::size_t CAPACITY = 232;
+
+    typedef std::ostream& (*StreamManipulator)(std::ostream&);
+    typedef std::ios_base& (*BaseManipulator)(std::ios_base&);
+
+    DeferredMessage();
+    DeferredMessage(const DeferredMessage& other);
+    DeferredMessage& operator=(const DeferredMessage& other);
+
+    /**
+     * Removes all captured arguments.
+     */
+    void clear();
+
+    /**
+     * Indicates whether any argument has been captured.
+     *
+     * @return @c true if no argument was captured
+     */
+    bool empty() const;
+
+    /**
+     * Indicates whether arguments had to be discarded because the buffer was
+     * full.
+     *
+     * @return @c true if the message is truncated
+     */
+    bool isTruncated() const;
+
+    /**
+     * Formats the captured arguments on a stream in the order they were
+     * captured.
+     *
+     * @param stream stream to format on
+     * @return the stream passed in
+     */
+    std::ostream& format(std::ostream& stream) const;
+
+    /**
+     * Formats the captured arguments into a character buffer without
+     * allocating memory or using streams, hence this method can be called
+     * from signal handlers. Manipulators except @c std::endl are ignored,
+     * pointers are formatted in hexadecimal and floating point numbers with
+     * at most six decimals.
+     *
+     * @param buffer buffer to format into, the result is not terminated
+     * @param size size of the buffer, longer results are truncated
+     * @return number of characters written
+     */
+    std::size_t formatSignalSafe(char* buffer, const std::size_t& size) const;
+
+    /**
+     * Returns the formatted message.
+     *
+     * @return formatted message
+     */
+    std::string str() const;
+
+    /**
+     * @name argument capturing
+     */
+    //@{
+    DeferredMessage& operator<<(bool value);
+    DeferredMessage& operator<<(char value);
+    DeferredMessage& operator<<(signed char value);
+    DeferredMessage& operator<<(unsigned char value);
+    DeferredMessage& operator<<(short value);
+    DeferredMessage& operator<<(unsigned short value);
+    DeferredMessage& operator<<(int value);
+    DeferredMessage& operator<<(unsigned int value);
+    DeferredMessage& operator<<(long value);
+    DeferredMessage& operator<<(unsigned long value);
+    DeferredMessage& operator<<(boost::long_long_type value);
+    DeferredMessage& operator<<(boost::ulong_long_type value);
+    DeferredMessage& operator<<(float value);
+    DeferredMessage& operator<<(double value);
+    DeferredMessage& operator<<(long double value);
+    DeferredMessage& operator<<(const void* value);
+    DeferredMessage& operator<<(const char* value);
+    DeferredMessage& operator<<(char* value);
+    DeferredMessage& operator<<(const std::string& value);
+    DeferredMessage& operator<<(StreamManipulator manipulator);
+    DeferredMessage& operator<<(BaseManipulator manipulator);
+
+    /**
+     * Captures an argument of an arbitrary type by formatting it immediately.
+     *
+     * @param value value to format
+     * @tparam T type with a stream operator
+     */
+    template<class T>
+    DeferredMessage& operator<<(const T& value) {
+        FormattedArgument argument(*this);
+        argument.getStream() << value;
+        return *this;
+    }
+    //@}
+
+private:
+
+    enum Tag {
+        TAG_BOOL,
+        TAG_CHAR,
+        TAG_SIGNED_CHAR,
+        TAG_UNSIGNED_CHAR,
+        TAG_SHORT,
+        TAG_UNSIGNED_SHORT,
+        TAG_INT,
+        TAG_UNSIGNED_INT,
+        TAG_LONG,
+        TAG_UNSIGNED_LONG,
+        TAG_LONG_LONG,
+        TAG_UNSIGNED_LONG_LONG,
+        TAG_FLOAT,
+        TAG_DOUBLE,
+        TAG_LONG_DOUBLE,
+        TAG_POINTER,
+        TAG_STRING,
+        TAG_STREAM_MANIPULATOR,
+        TAG_BASE_MANIPULATOR
+    };
+
+    /**
+     * A stream buffer writing into a fixed memory region.
+     *
+     * @author jwienke
+     */
+    class RSC_EXPORT ArgumentBuffer: public std::streambuf {
+    public:
+        ArgumentBuffer(char* begin, char* end);
+        std::size_t size() const;
+        bool isOverflowed() const;
+    protected:
+        int_type overflow(int_type c);
+    private:
+        bool overflowed;
+    };
+
+    /**
+     * Formats a single argument into the buffer of a message as a string
+     * argument using the stream of the current thread.
+     *
+     * @author jwienke
+     */
+    class RSC_EXPORT FormattedArgument {
+    public:
+        explicit FormattedArgument(DeferredMessage& message);
+        ~FormattedArgument();
+        std::ostream& getStream();
+    private:
+        DeferredMessage& message;
+        bool reserved;
+        ArgumentBuffer buffer;
+        std::ostream* stream;
+        bool ownStream;
+    };
+
+    template<class T>
+    DeferredMessage& append(const Tag& tag, const T& value) {
+        // do not capture anything after the first discarded argument
+        if (truncated || used + 1 + sizeof(T) > CAPACITY) {
+            truncated = true;
+            return *this;
+        }
+        data[used] = (unsigned char) tag;
+        std::memcpy(data + used + 1, &value, sizeof(T));
+        used += 1 + sizeof(T);
+        return *this;
+    }
+
+    template<class T>
+    static T read(const unsigned char* data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    DeferredMessage& appendString(const char* value, const std::size_t& length);
+
+    unsigned char data[CAPACITY];
+    boost::uint16_t used;
+    bool truncated;
+
+};
+
+RSC_EXPORT std::ostream& operator<<(std::ostream& stream,
+        const DeferredMessage& message);
+
+}
+}
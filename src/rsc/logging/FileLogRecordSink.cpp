@@ -0,0 +1,427 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "FileLogRecordSink.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/format.hpp>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "StreamLogRecordSink.h"
+#include "../misc/langutils.h"
+
+using namespace std;
+namespace fs = boost::filesystem;
+
+namespace rsc {
+namespace logging {
+
+namespace {
+
+void reportError(const string& message) {
+    cerr << "rsc.logging.FileLogRecordSink: " << message << endl;
+}
+
+/**
+ * Creates the suffix for a rotated file from the time of rotation.
+ */
+string rotationSuffix(const boost::uint64_t& timestamp) {
+    const boost::posix_time::ptime time = boost::posix_time::from_time_t(
+            timestamp / 1000);
+    const boost::gregorian::date date = time.date();
+    const boost::posix_time::time_duration timeOfDay = time.time_of_day();
+    return boost::str(
+            boost::format("%04d%02d%02dT%02d%02d%02d.%03d")
+                    % (int) date.year() % (int) date.month()
+                    % (int) date.day() % timeOfDay.hours()
+                    % timeOfDay.minutes() % timeOfDay.seconds()
+                    % (timestamp % 1000));
+}
+
+}
+
+FileLogRecordSink::Options::Options() :
+        path("rsc.log"), maxSize(10 * 1024 * 1024), maxAge(0), maxFiles(5), compress(
+                false), bufferSize(64 * 1024) {
+}
+
+FileLogRecordSink::BlockBuffer::BlockBuffer(string& block) :
+        block(block) {
+}
+
+FileLogRecordSink::BlockBuffer::int_type FileLogRecordSink::BlockBuffer::overflow(
+        int_type c) {
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        block.push_back(traits_type::to_char_type(c));
+    }
+    return traits_type::not_eof(c);
+}
+
+streamsize FileLogRecordSink::BlockBuffer::xsputn(const char* s, streamsize n) {
+    block.append(s, n);
+    return n;
+}
+
+FileLogRecordSink::FileLogRecordSink(const Options& options) :
+        options(options), requestedOptions(options), optionsChanged(false), blockBuffer(
+                block), blockStream(&blockBuffer), fileFailed(false), fileSize(
+                0), fileOpened(0), lastRotation(0), rotationSequence(0), maintenanceRunning(
+                false), stopping(false) {
+    if (options.compress && !isCompressionSupported()) {
+        throw invalid_argument(
+                "Compression of log files is not supported by this build.");
+    }
+    block.reserve(options.bufferSize);
+    maintenanceThread = boost::thread(
+            boost::bind(&FileLogRecordSink::maintenanceLoop, this));
+}
+
+FileLogRecordSink::~FileLogRecordSink() {
+    flush();
+    close();
+    {
+        boost::mutex::scoped_lock lock(maintenanceMutex);
+        stopping = true;
+        maintenanceCondition.notify_all();
+    }
+    maintenanceThread.join();
+}
+
+bool FileLogRecordSink::isCompressionSupported() {
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+void FileLogRecordSink::setOptions(const Options& options) {
+    if (options.compress && !isCompressionSupported()) {
+        throw invalid_argument(
+                "Compression of log files is not supported by this build.");
+    }
+    boost::mutex::scoped_lock lock(optionsMutex);
+    requestedOptions = options;
+    optionsChanged.store(true, boost::memory_order_release);
+}
+
+FileLogRecordSink::Options FileLogRecordSink::getOptions() const {
+    boost::mutex::scoped_lock lock(optionsMutex);
+    return requestedOptions;
+}
+
+void FileLogRecordSink::applyOptions() {
+
+    Options newOptions;
+    {
+        boost::mutex::scoped_lock lock(optionsMutex);
+        newOptions = requestedOptions;
+        optionsChanged.store(false, boost::memory_order_relaxed);
+    }
+
+    if (newOptions.path != options.path) {
+        writeBlock();
+        close();
+        fileFailed = false;
+    }
+    options = newOptions;
+    block.reserve(options.bufferSize);
+
+}
+
+void FileLogRecordSink::write(const vector<LogRecord>& records) {
+
+    if (optionsChanged.load(boost::memory_order_acquire)) {
+        applyOptions();
+    }
+
+    for (vector<LogRecord>::const_iterator it = records.begin();
+            it != records.end(); ++it) {
+
+        if (!file.is_open() && !fileFailed) {
+            open(it->timestamp);
+        } else if (needsRotation(it->timestamp)) {
+            rotate(it->timestamp);
+        }
+
+        const size_t sizeBefore = block.size();
+        encode(*it, block);
+        fileSize += block.size() - sizeBefore;
+
+        if (block.size() >= options.bufferSize) {
+            writeBlock();
+        }
+
+    }
+
+}
+
+void FileLogRecordSink::encode(const LogRecord& record, string& /*block*/) {
+    // blockStream appends to the memory block
+    StreamLogRecordSink::format(blockStream, record);
+}
+
+void FileLogRecordSink::beginFile(const bool& /*empty*/, string& /*block*/) {
+}
+
+void FileLogRecordSink::flush() {
+    writeBlock();
+    if (file.is_open()) {
+        file.flush();
+    }
+}
+
+void FileLogRecordSink::open(const boost::uint64_t& now) {
+
+    try {
+        const fs::path parent = options.path.parent_path();
+        if (!parent.empty() && !fs::exists(parent)) {
+            fs::create_directories(parent);
+        }
+        fileSize = fs::exists(options.path) ? fs::file_size(options.path) : 0;
+    } catch (const fs::filesystem_error& e) {
+        reportError(e.what());
+        fileFailed = true;
+        return;
+    }
+
+    file.open(options.path, ios::out | ios::app | ios::binary);
+    if (!file.is_open()) {
+        reportError("Unable to open log file " + options.path.string());
+        fileFailed = true;
+        return;
+    }
+    fileOpened = now;
+
+    const size_t sizeBefore = block.size();
+    beginFile(fileSize == 0, block);
+    fileSize += block.size() - sizeBefore;
+
+}
+
+void FileLogRecordSink::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+}
+
+bool FileLogRecordSink::needsRotation(const boost::uint64_t& timestamp) const {
+    if (!file.is_open() || fileSize == 0) {
+        return false;
+    }
+    return (options.maxSize > 0 && fileSize >= options.maxSize)
+            || (options.maxAge > 0
+                    && timestamp
+                            >= fileOpened
+                                    + (boost::uint64_t) options.maxAge * 1000);
+}
+
+void FileLogRecordSink::rotate(const boost::uint64_t& timestamp) {
+
+    writeBlock();
+    close();
+
+    // a fixed-width sequence number keeps names in order if several
+    // rotations happen within one millisecond
+    const string baseName = options.path.string() + "."
+            + rotationSuffix(timestamp);
+    // rotated files might already be removed again in the background, hence
+    // the sequence cannot only be derived from existing files
+    if (timestamp != lastRotation) {
+        rotationSequence = 0;
+        lastRotation = timestamp;
+    }
+    fs::path rotatedFile;
+    do {
+        rotatedFile = baseName
+                + boost::str(boost::format("-%04d") % rotationSequence++);
+    } while (fs::exists(rotatedFile)
+            || fs::exists(rotatedFile.string() + ".gz"));
+
+    try {
+        fs::rename(options.path, rotatedFile);
+    } catch (const fs::filesystem_error& e) {
+        reportError(e.what());
+        // continue in the current file instead of retrying for each record
+        open(timestamp);
+        fileSize = 0;
+        return;
+    }
+
+    MaintenanceJob job;
+    job.rotatedFile = rotatedFile;
+    job.logFile = options.path;
+    job.compress = options.compress;
+    job.maxFiles = options.maxFiles;
+    {
+        boost::mutex::scoped_lock lock(maintenanceMutex);
+        maintenanceJobs.push_back(job);
+        maintenanceCondition.notify_all();
+    }
+
+    open(timestamp);
+
+}
+
+void FileLogRecordSink::writeBlock() {
+    if (block.empty()) {
+        return;
+    }
+    if (file.is_open()) {
+        file.write(block.data(), block.size());
+        if (!file) {
+            reportError("Unable to write to log file " + options.path.string());
+            file.clear();
+        }
+    }
+    block.clear();
+}
+
+void FileLogRecordSink::waitForMaintenance() {
+    boost::mutex::scoped_lock lock(maintenanceMutex);
+    while (!maintenanceJobs.empty() || maintenanceRunning) {
+        maintenanceCondition.wait(lock);
+    }
+}
+
+void FileLogRecordSink::maintenanceLoop() {
+
+    while (true) {
+
+        MaintenanceJob job;
+        {
+            boost::mutex::scoped_lock lock(maintenanceMutex);
+            while (maintenanceJobs.empty() && !stopping) {
+                maintenanceCondition.wait(lock);
+            }
+            if (maintenanceJobs.empty()) {
+                return;
+            }
+            job = maintenanceJobs.front();
+            maintenanceJobs.pop_front();
+            maintenanceRunning = true;
+        }
+
+        try {
+            if (job.compress) {
+                compressFile(job.rotatedFile);
+            }
+            removeOldFiles(job.logFile, job.maxFiles);
+        } catch (const exception& e) {
+            reportError(e.what());
+        }
+
+        boost::mutex::scoped_lock lock(maintenanceMutex);
+        maintenanceRunning = false;
+        maintenanceCondition.notify_all();
+
+    }
+
+}
+
+void FileLogRecordSink::compressFile(const fs::path& file) {
+#ifdef HAVE_ZLIB
+    const string target = file.string() + ".gz";
+
+    fs::ifstream in(file, ios::in | ios::binary);
+    if (!in) {
+        throw runtime_error("Unable to read rotated file " + file.string());
+    }
+    gzFile out = gzopen(target.c_str(), "wb");
+    if (!out) {
+        throw runtime_error("Unable to create " + target);
+    }
+
+    vector<char> buffer(64 * 1024);
+    bool failed = false;
+    while (!failed && in) {
+        in.read(&buffer[0], buffer.size());
+        const streamsize count = in.gcount();
+        if (count > 0 && gzwrite(out, &buffer[0], (unsigned) count) == 0) {
+            failed = true;
+        }
+    }
+    if (gzclose(out) != Z_OK || failed || in.bad()) {
+        fs::remove(target);
+        throw runtime_error("Unable to compress " + file.string());
+    }
+    in.close();
+
+    fs::remove(file);
+#else
+    (void) file;
+#endif
+}
+
+void FileLogRecordSink::removeOldFiles(const fs::path& logFile,
+        const unsigned int& maxFiles) {
+
+    if (maxFiles == 0) {
+        return;
+    }
+
+    fs::path directory = logFile.parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    const string prefix = logFile.filename().string() + ".";
+
+    // the suffix starts with the date, hence name order is temporal order
+    vector<fs::path> rotatedFiles;
+    for (fs::directory_iterator it(directory); it != fs::directory_iterator();
+            ++it) {
+        const string name = it->path().filename().string();
+        if (name.size() > prefix.size()
+                && name.compare(0, prefix.size(), prefix) == 0
+                && isdigit(name[prefix.size()])) {
+            rotatedFiles.push_back(it->path());
+        }
+    }
+    if (rotatedFiles.size() <= maxFiles) {
+        return;
+    }
+
+    sort(rotatedFiles.begin(), rotatedFiles.end());
+    for (size_t i = 0; i < rotatedFiles.size() - maxFiles; ++i) {
+        fs::remove(rotatedFiles[i]);
+    }
+
+}
+
+}
+}
@@ -0,0 +1,255 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <deque>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "AsyncLogWriter.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A LogRecordSink writing records to a file in the layout of ConsoleLogger.
+ * Formatted records are collected in a large memory block which is written
+ * to the file when it is full or when the sink is flushed.
+ *
+ * The file is rotated once it exceeds a maximum size or a maximum age. The
+ * current file is renamed to the file name with the UTC time of the rotation
+ * and a sequence number appended, e.g. @c rsc.log.20130101T120000.000-0000.
+ * Compression of rotated
+ * files and removal of the oldest rotated files is performed in a background
+ * thread so that writing only waits for the rename.
+ *
+ * Errors while writing are reported on @c std::cerr and the affected records
+ * are discarded.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT FileLogRecordSink: public LogRecordSink {
+public:
+
+    /**
+     * Settings of the sink.
+     *
+     * @author jwienke
+     */
+    struct RSC_EXPORT Options {
+
+        /**
+         * Creates options with default values.
+         */
+        Options();
+
+        /**
+         * Path of the log file. Default: @c rsc.log
+         */
+        boost::filesystem::path path;
+
+        /**
+         * Size in bytes after which the file is rotated, 0 disables size-based
+         * rotation. Default: 10 MiB
+         */
+        boost::uint64_t maxSize;
+
+        /**
+         * Age in seconds after which the file is rotated, 0 disables
+         * time-based rotation. Default: 0
+         */
+        boost::uint32_t maxAge;
+
+        /**
+         * Number of rotated files to keep, 0 keeps all files. Default: 5
+         */
+        unsigned int maxFiles;
+
+        /**
+         * If @c true, rotated files are compressed with gzip. Default:
+         * @c false
+         */
+        bool compress;
+
+        /**
+         * Size of the memory block in bytes. Default: 64 KiB
+         */
+        std::size_t bufferSize;
+
+    };
+
+    /**
+     * Creates a new sink. The file is opened with the first written record.
+     *
+     * @param options initial options
+     * @throw std::invalid_argument compression requested but not supported
+     */
+    explicit FileLogRecordSink(const Options& options = Options());
+
+    /**
+     * Writes pending data, closes the file and waits for pending
+     * compressions.
+     */
+    virtual ~FileLogRecordSink();
+
+    void write(const std::vector<LogRecord>& records);
+    void flush();
+
+    /**
+     * Changes the options of the sink. Can be called from any thread. The
+     * options are applied before the next records are written. A changed
+     * path takes effect without rotating the previous file.
+     *
+     * @param options new options
+     * @throw std::invalid_argument compression requested but not supported
+     */
+    void setOptions(const Options& options);
+
+    /**
+     * Returns the options which are currently requested.
+     *
+     * @return options
+     */
+    Options getOptions() const;
+
+    /**
+     * Blocks until all compressions and removals of rotated files scheduled
+     * so far have been performed.
+     */
+    void waitForMaintenance();
+
+    /**
+     * Indicates whether RSC was built with support for compressing rotated
+     * files.
+     *
+     * @return @c true if compression is available
+     */
+    static bool isCompressionSupported();
+
+protected:
+
+    /**
+     * A stream buffer appending to a string.
+     *
+     * @author jwienke
+     */
+    class RSC_EXPORT BlockBuffer: public std::streambuf {
+    public:
+        explicit BlockBuffer(std::string& block);
+    protected:
+        int_type overflow(int_type c);
+        std::streamsize xsputn(const char* s, std::streamsize n);
+    private:
+        std::string& block;
+    };
+
+    /**
+     * Appends the representation of a record to the memory block. The
+     * default implementation uses the layout of StreamLogRecordSink.
+     *
+     * @param record record to encode
+     * @param block memory block to append to
+     */
+    virtual void encode(const LogRecord& record, std::string& block);
+
+    /**
+     * Called after a log file has been opened and before the first record
+     * is encoded for it. Allows subclasses to append a file header to the
+     * memory block. The default implementation does nothing.
+     *
+     * @param empty @c true if the file is new or empty, @c false if records
+     *              are appended to an existing file
+     * @param block memory block to append to
+     */
+    virtual void beginFile(const bool& empty, std::string& block);
+
+private:
+
+    void applyOptions();
+    void open(const boost::uint64_t& now);
+    void close();
+    bool needsRotation(const boost::uint64_t& timestamp) const;
+    void rotate(const boost::uint64_t& timestamp);
+    void writeBlock();
+
+    /**
+     * Work to do for a rotated file in the background.
+     *
+     * @author jwienke
+     */
+    struct MaintenanceJob {
+        boost::filesystem::path rotatedFile;
+        boost::filesystem::path logFile;
+        bool compress;
+        unsigned int maxFiles;
+    };
+
+    void maintenanceLoop();
+    static void compressFile(const boost::filesystem::path& file);
+    static void removeOldFiles(const boost::filesystem::path& logFile,
+            const unsigned int& maxFiles);
+
+    // options as used by the writer thread
+    Options options;
+
+    mutable boost::mutex optionsMutex;
+    Options requestedOptions;
+    boost::atomic<bool> optionsChanged;
+
+    std::string block;
+    BlockBuffer blockBuffer;
+    std::ostream blockStream;
+
+    boost::filesystem::ofstream file;
+    bool fileFailed;
+    boost::uint64_t fileSize;
+    boost::uint64_t fileOpened;
+    boost::uint64_t lastRotation;
+    unsigned int rotationSequence;
+
+    boost::mutex maintenanceMutex;
+    boost::condition maintenanceCondition;
+    std::deque<MaintenanceJob> maintenanceJobs;
+    bool maintenanceRunning;
+    bool stopping;
+    boost::thread maintenanceThread;
+
+};
+
+}
+}
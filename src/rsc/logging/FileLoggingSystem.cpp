@@ -0,0 +1,220 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "FileLoggingSystem.h"
+
+#include <cctype>
+#include <stdexcept>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "AsyncLogger.h"
+#include "../misc/Registry.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+namespace {
+
+/**
+ * Parses a number of bytes with an optional binary unit suffix.
+ */
+boost::uint64_t parseSize(const string& name, const string& value) {
+    string number = boost::algorithm::trim_copy(value);
+    boost::uint64_t factor = 1;
+    if (!number.empty()) {
+        switch (tolower(number[number.size() - 1])) {
+        case 'k':
+            factor = 1024;
+            break;
+        case 'm':
+            factor = 1024 * 1024;
+            break;
+        case 'g':
+            factor = 1024 * 1024 * 1024;
+            break;
+        }
+        if (factor != 1) {
+            number.erase(number.size() - 1);
+        }
+    }
+    try {
+        return boost::lexical_cast<boost::uint64_t>(number) * factor;
+    } catch (const boost::bad_lexical_cast&) {
+        throw invalid_argument(
+                "Invalid size '" + value + "' for option " + name + ".");
+    }
+}
+
+template<class T>
+T parseNumber(const string& name, const string& value) {
+    try {
+        return boost::lexical_cast<T>(boost::algorithm::trim_copy(value));
+    } catch (const boost::bad_lexical_cast&) {
+        throw invalid_argument(
+                "Invalid number '" + value + "' for option " + name + ".");
+    }
+}
+
+bool parseBool(const string& name, const string& value) {
+    const string normalized = boost::algorithm::to_lower_copy(
+            boost::algorithm::trim_copy(value));
+    if (normalized == "true" || normalized == "1" || normalized == "yes"
+            || normalized == "on") {
+        return true;
+    } else if (normalized == "false" || normalized == "0" || normalized == "no"
+            || normalized == "off") {
+        return false;
+    }
+    throw invalid_argument(
+            "Invalid boolean '" + value + "' for option " + name + ".");
+}
+
+AsyncLogWriter::OverflowPolicy parsePolicy(const string& name,
+        const string& value) {
+    const string normalized = boost::algorithm::to_lower_copy(
+            boost::algorithm::trim_copy(value));
+    if (normalized == "block") {
+        return AsyncLogWriter::OVERFLOW_BLOCK;
+    } else if (normalized == "drop") {
+        return AsyncLogWriter::OVERFLOW_DROP;
+    } else if (normalized == "count") {
+        return AsyncLogWriter::OVERFLOW_COUNT;
+    }
+    throw invalid_argument(
+            "Invalid overflow policy '" + value + "' for option " + name
+                    + ".");
+}
+
+}
+
+string FileLoggingSystem::getName() {
+    return "FileLoggingSystem";
+}
+
+FileLoggingSystem::FileLoggingSystem() :
+        capacity(AsyncLogWriter::DEFAULT_CAPACITY), policy(
+                AsyncLogWriter::OVERFLOW_BLOCK) {
+}
+
+FileLoggingSystem::FileLoggingSystem(const FileLogRecordSink::Options& options,
+        const unsigned int& capacity,
+        const AsyncLogWriter::OverflowPolicy& policy) :
+        capacity(capacity), options(options), policy(policy) {
+}
+
+FileLoggingSystem::~FileLoggingSystem() {
+}
+
+string FileLoggingSystem::getRegistryKey() const {
+    return getName();
+}
+
+LoggerPtr FileLoggingSystem::createLogger(const string& name) {
+    return LoggerPtr(new AsyncLogger(name, getWriter()));
+}
+
+void FileLoggingSystem::setOption(const string& name, const string& value) {
+
+    const string option = boost::algorithm::to_lower_copy(name);
+
+    boost::mutex::scoped_lock lock(mutex);
+
+    FileLogRecordSink::Options newOptions = options;
+    AsyncLogWriter::OverflowPolicy newPolicy = policy;
+    if (option == "path") {
+        newOptions.path = value;
+    } else if (option == "maxsize") {
+        newOptions.maxSize = parseSize(name, value);
+    } else if (option == "maxage") {
+        newOptions.maxAge = parseNumber<boost::uint32_t>(name, value);
+    } else if (option == "maxfiles") {
+        newOptions.maxFiles = parseNumber<unsigned int>(name, value);
+    } else if (option == "compress") {
+        newOptions.compress = parseBool(name, value);
+        if (newOptions.compress && !FileLogRecordSink::isCompressionSupported()) {
+            throw invalid_argument(
+                    "Compression of log files is not supported by this build.");
+        }
+    } else if (option == "buffersize") {
+        newOptions.bufferSize = parseSize(name, value);
+    } else if (option == "overflow") {
+        newPolicy = parsePolicy(name, value);
+    } else {
+        throw invalid_argument(
+                "Unknown option '" + name + "' for " + getRegistryKey() + ".");
+    }
+
+    options = newOptions;
+    policy = newPolicy;
+    if (sink) {
+        sink->setOptions(options);
+        writer->setOverflowPolicy(policy);
+    }
+
+}
+
+bool FileLoggingSystem::isOption(const string& name) {
+    const string option = boost::algorithm::to_lower_copy(name);
+    return option == "path" || option == "maxsize" || option == "maxage"
+            || option == "maxfiles" || option == "compress"
+            || option == "buffersize" || option == "overflow";
+}
+
+FileLogRecordSink::Options FileLoggingSystem::getOptions() const {
+    boost::mutex::scoped_lock lock(mutex);
+    return options;
+}
+
+AsyncLogWriterPtr FileLoggingSystem::getWriter() {
+    boost::mutex::scoped_lock lock(mutex);
+    if (!writer) {
+        sink = createSink(options);
+        writer.reset(new AsyncLogWriter(sink, capacity, policy));
+        AsyncLogWriter::flushAtExit(writer);
+    }
+    return writer;
+}
+
+boost::shared_ptr<FileLogRecordSink> FileLoggingSystem::createSink(
+        const FileLogRecordSink::Options& options) {
+    return boost::shared_ptr<FileLogRecordSink>(new FileLogRecordSink(options));
+}
+
+boost::shared_ptr<FileLogRecordSink> FileLoggingSystem::getSink() const {
+    boost::mutex::scoped_lock lock(mutex);
+    return sink;
+}
+
+CREATE_GLOBAL_REGISTREE_MSG(loggingSystemRegistry(), new FileLoggingSystem, FileLoggingSystem, "Could it be that you have linked two different versions of RSC in your program?")
+;
+
+}
+}
@@ -0,0 +1,160 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "AsyncLogWriter.h"
+#include "FileLogRecordSink.h"
+#include "LoggingSystem.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A logging system writing to a rotating log file. Messages are written
+ * asynchronously by an AsyncLogWriter to a FileLogRecordSink, hence logging
+ * threads are never blocked by file operations or rotation.
+ *
+ * The system can be configured through #setOption, which is used by
+ * OptionBasedConfigurator for the keys below @c rsc.logging.file:
+ *  - @c path: path of the log file
+ *  - @c maxsize: size after which the file is rotated, in bytes or with a
+ *    suffix k, m or g
+ *  - @c maxage: age in seconds after which the file is rotated
+ *  - @c maxfiles: number of rotated files to keep, 0 for all
+ *  - @c compress: compress rotated files with gzip (true or false)
+ *  - @c buffersize: size of the write buffer, like @c maxsize
+ *  - @c overflow: behavior if messages are logged faster than written,
+ *    either @c block, @c drop or @c count
+ *
+ * Options can be changed at any time, the writer thread is started with the
+ * first logger created by this system.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT FileLoggingSystem: public LoggingSystem {
+public:
+
+    /**
+     * Creates a system with default options.
+     */
+    FileLoggingSystem();
+
+    /**
+     * Creates a system with the given options.
+     *
+     * @param options options of the file sink
+     * @param capacity capacity of the message buffer
+     * @param policy behavior if the message buffer is full
+     */
+    FileLoggingSystem(const FileLogRecordSink::Options& options,
+            const unsigned int& capacity = AsyncLogWriter::DEFAULT_CAPACITY,
+            const AsyncLogWriter::OverflowPolicy& policy =
+                    AsyncLogWriter::OVERFLOW_BLOCK);
+
+    virtual ~FileLoggingSystem();
+
+    std::string getRegistryKey() const;
+
+    LoggerPtr createLogger(const std::string& name);
+
+    /**
+     * Changes a single option.
+     *
+     * @param name name of the option, case-insensitive
+     * @param value new value
+     * @throw std::invalid_argument unknown option or invalid value
+     */
+    void setOption(const std::string& name, const std::string& value);
+
+    /**
+     * Tells whether #setOption accepts an option.
+     *
+     * @param name name of the option, case-insensitive
+     * @return @c true if the option is known
+     */
+    static bool isOption(const std::string& name);
+
+    /**
+     * Returns the current options of the file sink.
+     *
+     * @return options
+     */
+    FileLogRecordSink::Options getOptions() const;
+
+    /**
+     * Returns the writer used by all loggers of this system, starting it if
+     * required.
+     *
+     * @return the writer
+     */
+    AsyncLogWriterPtr getWriter();
+
+    /**
+     * Returns the sink of the writer or an empty pointer if the writer has
+     * not been started.
+     *
+     * @return the sink
+     */
+    boost::shared_ptr<FileLogRecordSink> getSink() const;
+
+    static std::string getName();
+
+protected:
+
+    /**
+     * Creates the sink of the writer. Called once when the writer is
+     * started.
+     *
+     * @param options current options of the system
+     * @return new sink
+     */
+    virtual boost::shared_ptr<FileLogRecordSink> createSink(
+            const FileLogRecordSink::Options& options);
+
+private:
+
+    const unsigned int capacity;
+
+    mutable boost::mutex mutex;
+    FileLogRecordSink::Options options;
+    AsyncLogWriter::OverflowPolicy policy;
+
+    // the writer uses the sink, hence it needs to be destructed first
+    boost::shared_ptr<FileLogRecordSink> sink;
+    AsyncLogWriterPtr writer;
+
+};
+
+}
+}
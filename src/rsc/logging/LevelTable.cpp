@@ -0,0 +1,125 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "LevelTable.h"
+
+#include <boost/algorithm/string.hpp>
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+Logger::Level LevelTable::Snapshot::effectiveLevel(
+        const vector<string>& prefixes) const {
+    for (vector<string>::const_iterator it = prefixes.begin();
+            it != prefixes.end(); ++it) {
+        Assignments::const_iterator levelIt = levels.find(*it);
+        if (levelIt != levels.end()) {
+            return levelIt->second;
+        }
+    }
+    // the root logger is always assigned
+    return levels.find("")->second;
+}
+
+LevelTable::LevelTable(const Logger::Level& rootLevel) :
+        epoch(0) {
+    boost::shared_ptr<Snapshot> initial(new Snapshot);
+    initial->levels[""] = rootLevel;
+    publish(initial);
+}
+
+boost::uint64_t LevelTable::getEpoch() const {
+    return epoch.load(boost::memory_order_acquire);
+}
+
+LevelTable::SnapshotPtr LevelTable::getSnapshot() const {
+    return boost::atomic_load(&snapshot);
+}
+
+void LevelTable::assign(const Assignments& changes) {
+    boost::mutex::scoped_lock lock(writeMutex);
+    boost::shared_ptr<Snapshot> next(new Snapshot(*snapshot));
+    for (Assignments::const_iterator it = changes.begin(); it != changes.end();
+            ++it) {
+        next->levels[normalizeName(it->first)] = it->second;
+    }
+    publish(next);
+}
+
+void LevelTable::assign(const string& name, const Logger::Level& level) {
+    Assignments changes;
+    changes[name] = level;
+    assign(changes);
+}
+
+void LevelTable::reassignAll(const Logger::Level& level) {
+    boost::mutex::scoped_lock lock(writeMutex);
+    boost::shared_ptr<Snapshot> next(new Snapshot(*snapshot));
+    for (Assignments::iterator it = next->levels.begin();
+            it != next->levels.end(); ++it) {
+        it->second = level;
+    }
+    publish(next);
+}
+
+void LevelTable::clear() {
+    boost::mutex::scoped_lock lock(writeMutex);
+    boost::shared_ptr<Snapshot> next(new Snapshot);
+    next->levels[""] = snapshot->levels.find("")->second;
+    publish(next);
+}
+
+void LevelTable::publish(boost::shared_ptr<Snapshot> next) {
+    // readers load the epoch first, hence the snapshot has to be stored
+    // before so that they never see an epoch without its snapshot
+    next->epoch = epoch.load(boost::memory_order_relaxed) + 1;
+    boost::atomic_store(&snapshot, SnapshotPtr(next));
+    epoch.store(next->epoch, boost::memory_order_release);
+}
+
+vector<string> LevelTable::prefixNames(const string& name) {
+    const string normalized = normalizeName(name);
+    vector<string> prefixes;
+    prefixes.push_back(normalized);
+    for (string::size_type end = normalized.rfind('.'); end != string::npos;
+            end = end == 0 ? string::npos : normalized.rfind('.', end - 1)) {
+        prefixes.push_back(normalized.substr(0, end));
+    }
+    if (!normalized.empty()) {
+        prefixes.push_back("");
+    }
+    return prefixes;
+}
+
+string LevelTable::normalizeName(const string& name) {
+    return boost::algorithm::to_lower_copy(name);
+}
+
+}
+}
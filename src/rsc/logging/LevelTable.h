@@ -0,0 +1,178 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "Logger.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * Holds the levels assigned to loggers in the logger tree as immutable
+ * snapshots in the style of read-copy-update. Changes copy the current
+ * snapshot, modify the copy and publish it atomically together with a new
+ * epoch number. Loggers compare the epoch they have seen last with the
+ * current one on each level check and only derive their effective level
+ * from the current snapshot if it has changed. Hence, level changes never
+ * block logging threads and loggers never block level changes.
+ *
+ * Writers are serialized by an internal mutex which is not used by readers.
+ *
+ * @author jwienke
+ */
+class LevelTable: private boost::noncopyable {
+public:
+
+    /**
+     * Assigned levels by full logger name in lower case, the empty name
+     * being the root logger.
+     */
+    typedef std::map<std::string, Logger::Level> Assignments;
+
+    /**
+     * An immutable state of the assigned levels.
+     *
+     * @author jwienke
+     */
+    struct Snapshot {
+
+        /**
+         * Assigned levels, always containing the root logger.
+         */
+        Assignments levels;
+
+        /**
+         * Epoch in which this snapshot was published.
+         */
+        boost::uint64_t epoch;
+
+        /**
+         * Returns the effective level of a logger, which is the level
+         * assigned to the logger itself or to its closest ancestor.
+         *
+         * @param prefixes names of the logger and all its ancestors starting
+         *                 with the logger itself, see #prefixNames
+         * @return effective level
+         */
+        Logger::Level effectiveLevel(
+                const std::vector<std::string>& prefixes) const;
+
+    };
+    typedef boost::shared_ptr<const Snapshot> SnapshotPtr;
+
+    /**
+     * Creates a table with only the root logger assigned.
+     *
+     * @param rootLevel level of the root logger
+     */
+    explicit LevelTable(const Logger::Level& rootLevel);
+
+    /**
+     * Returns the number of the current epoch.
+     *
+     * @return current epoch, starts with 1
+     */
+    boost::uint64_t getEpoch() const;
+
+    /**
+     * Returns the current snapshot. Its epoch is at least as new as an epoch
+     * returned by #getEpoch before.
+     *
+     * @return current snapshot
+     */
+    SnapshotPtr getSnapshot() const;
+
+    /**
+     * Assigns levels to loggers and publishes the result as one new
+     * snapshot.
+     *
+     * @param changes levels to assign
+     */
+    void assign(const Assignments& changes);
+
+    /**
+     * Assigns a level to one logger.
+     *
+     * @param name name of the logger
+     * @param level level to assign
+     */
+    void assign(const std::string& name, const Logger::Level& level);
+
+    /**
+     * Replaces the levels of all loggers with an assigned level.
+     *
+     * @param level new level
+     */
+    void reassignAll(const Logger::Level& level);
+
+    /**
+     * Removes all assignments apart from the one of the root logger.
+     */
+    void clear();
+
+    /**
+     * Returns the normalized names of a logger and all of its ancestors in
+     * the order required by Snapshot#effectiveLevel.
+     *
+     * @param name name of the logger
+     * @return names of the logger and its ancestors up to the root logger
+     */
+    static std::vector<std::string> prefixNames(const std::string& name);
+
+    /**
+     * Normalizes a logger name for use in Assignments.
+     *
+     * @param name logger name
+     * @return normalized name
+     */
+    static std::string normalizeName(const std::string& name);
+
+private:
+
+    void publish(boost::shared_ptr<Snapshot> snapshot);
+
+    boost::mutex writeMutex;
+    SnapshotPtr snapshot;
+    boost::atomic<boost::uint64_t> epoch;
+
+};
+
+typedef boost::shared_ptr<LevelTable> LevelTablePtr;
+
+}
+}
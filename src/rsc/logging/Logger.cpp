@@ -64,6 +64,12 @@ void Logger::fatal(const string& msg) {
     this->log(LEVEL_FATAL, msg);
 }
 
+void Logger::logDeferred(const Level& level, const DeferredMessage& msg) {
+    if (isEnabledFor(level)) {
+        this->log(level, msg.str());
+    }
+}
+
 bool Logger::isTraceEnabled() const {
     return isEnabledFor(LEVEL_TRACE);
 }
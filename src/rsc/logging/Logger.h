@@ -33,6 +33,7 @@
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include "DeferredMessage.h"
 #include "rsc/rscexports.h"
 
 namespace rsc {
@@ -180,6 +181,18 @@ public:
      */
     virtual void log(const Level& level, const std::string& msg) = 0;
 
+    /**
+     * Logs a message with deferred formatting with the given level if it is
+     * enabled. Implementations which hand messages to another thread should
+     * pass on the message in its binary form so that it is formatted there.
+     *
+     * The default implementation formats the message and calls #log.
+     *
+     * @param level level for the message
+     * @param msg message to log
+     */
+    virtual void logDeferred(const Level& level, const DeferredMessage& msg);
+
     /**
      * @name level checks
      *
@@ -251,6 +264,62 @@ RSC_EXPORT std::ostream& operator<<(std::ostream& stream, const Logger::Level& l
 
 //@}
 
+/**
+ * @name logging utility macros with deferred formatting
+ *
+ * These macros have the same stream semantics as the ones above but capture
+ * the streamed values into a DeferredMessage on the stack instead of
+ * formatting them. For built-in types and strings neither memory is
+ * allocated nor is a stream constructed in the calling thread. Formatting
+ * happens when the logger writes the message, which may be another thread
+ * for asynchronous logging systems.
+ */
+//@{
+
+#define RSCTRACE_DEFERRED(logger, msg) \
+    if (logger->isTraceEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_TRACE, iShouldNeverBeMatchedByClientCode); \
+    }
+
+#define RSCDEBUG_DEFERRED(logger, msg) \
+    if (logger->isDebugEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_DEBUG, iShouldNeverBeMatchedByClientCode); \
+    }
+
+#define RSCINFO_DEFERRED(logger, msg) \
+    if (logger->isInfoEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_INFO, iShouldNeverBeMatchedByClientCode); \
+    }
+
+#define RSCWARN_DEFERRED(logger, msg) \
+    if (logger->isWarnEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_WARN, iShouldNeverBeMatchedByClientCode); \
+    }
+
+#define RSCERROR_DEFERRED(logger, msg) \
+    if (logger->isErrorEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_ERROR, iShouldNeverBeMatchedByClientCode); \
+    }
+
+#define RSCFATAL_DEFERRED(logger, msg) \
+    if (logger->isFatalEnabled()) { \
+        rsc::logging::DeferredMessage iShouldNeverBeMatchedByClientCode; \
+        iShouldNeverBeMatchedByClientCode << msg; \
+        logger->logDeferred(rsc::logging::Logger::LEVEL_FATAL, iShouldNeverBeMatchedByClientCode); \
+    }
+
+//@}
+
 /**
  * @name expectation logging utility macros with stream semantics
  *
@@ -34,8 +34,15 @@
 #include <boost/format.hpp>
 #include <boost/function.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/atomic.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/scoped_array.hpp>
 
+#include "AsyncConsoleLoggingSystem.h"
+#include "BinaryLoggingSystem.h"
 #include "ConsoleLoggingSystem.h"
+#include "CrashRingLoggingSystem.h"
+#include "FileLoggingSystem.h"
 #include "LoggerProxy.h"
 #include "OptionBasedConfigurator.h"
 #include "../config/ConfigFileSource.h"
@@ -52,86 +59,179 @@ const string LoggerFactory::DEFAULT_LOGGING_SYSTEM =
 const Logger::Level LoggerFactory::DEFAULT_LEVEL = Logger::LEVEL_WARN;
 
 /**
+ * Assigns levels set through a LoggerProxy in the LevelTable. Proxies pick up
+ * the change with their next level check, hence neither the factory nor the
+ * logger tree need to be locked.
+ *
  * @author jwienke
  */
 class TreeLevelUpdater: public LoggerProxy::SetLevelCallback {
 public:
 
-    /**
-     * A Visitor that propagates a logging level down the logger tree but stops
-     * if a logger already as a level assigned.
-     *
-     * @author jwienke
-     */
-    class LevelSetter: public LoggerTreeNode::Visitor {
-    public:
+    TreeLevelUpdater(LevelTablePtr levels, const string& name) :
+            levels(levels), name(name) {
+    }
 
-        LevelSetter(const Logger::Level& level) :
-                level(level) {
-        }
+    virtual ~TreeLevelUpdater() {
+    }
 
-        virtual ~LevelSetter() {
-        }
+    void call(LoggerProxyPtr /*proxy*/, const Logger::Level& level) {
+        levels->assign(name, level);
+    }
 
-        bool visit(const LoggerTreeNode::NamePath& /*path*/,
-                LoggerTreeNodePtr node, const Logger::Level& /*parentLevel*/) {
+private:
+    LevelTablePtr levels;
+    string name;
 
-            if (node->getAssignedLevel()) {
-                return false;
-            }
+};
 
-            node->getLoggerProxy()->getLogger()->setLevel(level);
+/**
+ * A hash table from full logger names to the proxies of the logger tree
+ * which can be read without locking. Readers probe a table of atomic
+ * pointers to immutable entries. Writers need to be serialized externally.
+ * If the table becomes too full, a larger copy is published. Replaced tables
+ * and all entries are only deleted with the cache itself, as concurrent
+ * readers might still access them. This is acceptable because loggers are
+ * never removed apart from testing.
+ *
+ * @author jwienke
+ */
+class LoggerFactory::LoggerCache: private boost::noncopyable {
+public:
 
-            return true;
+    LoggerCache() :
+            table(new Table(INITIAL_CAPACITY)) {
+    }
 
+    ~LoggerCache() {
+        delete table.load();
+        for (vector<Table*>::iterator it = retiredTables.begin();
+                it != retiredTables.end(); ++it) {
+            delete *it;
         }
+        for (vector<Entry*>::iterator it = entries.begin();
+                it != entries.end(); ++it) {
+            delete *it;
+        }
+    }
 
-    private:
-        Logger::Level level;
-    };
-
-    TreeLevelUpdater(LoggerTreeNodeWeakPtr treeNode,
-            boost::recursive_mutex& mutex) :
-            treeNode(treeNode), mutex(mutex) {
+    /**
+     * Looks up a logger.
+     *
+     * @param name name the logger was requested with
+     * @return the logger or an empty pointer if the name is unknown
+     */
+    LoggerPtr find(const string& name) const {
+        const size_t hash = boost::hash<string>()(name);
+        const Table* current = table.load(boost::memory_order_acquire);
+        for (size_t i = hash & current->mask;; i = (i + 1) & current->mask) {
+            const Entry* entry = current->slots[i].load(
+                    boost::memory_order_acquire);
+            if (!entry) {
+                return LoggerPtr();
+            }
+            if (entry->hash == hash && entry->name == name) {
+                return entry->logger;
+            }
+        }
     }
 
-    virtual ~TreeLevelUpdater() {
+    /**
+     * Adds a logger for a name which is not yet contained.
+     *
+     * @param name name the logger was requested with
+     * @param logger the logger
+     */
+    void insert(const string& name, LoggerPtr logger) {
+        Entry* entry = new Entry;
+        entry->hash = boost::hash<string>()(name);
+        entry->name = name;
+        entry->logger = logger;
+        entries.push_back(entry);
+
+        Table* current = table.load(boost::memory_order_relaxed);
+        if (2 * (current->size + 1) > current->mask + 1) {
+            // keep the load factor at most 0.5 to keep probe sequences short
+            Table* larger = new Table(2 * (current->mask + 1));
+            for (size_t i = 0; i <= current->mask; ++i) {
+                const Entry* existing = current->slots[i].load(
+                        boost::memory_order_relaxed);
+                if (existing) {
+                    larger->add(existing);
+                }
+            }
+            larger->add(entry);
+            table.store(larger, boost::memory_order_release);
+            retiredTables.push_back(current);
+        } else {
+            current->add(entry);
+        }
     }
 
-    // TODO jwienke: maybe it would be better to make this signature contain the node instead of the proxy? Can this work?
-    void call(LoggerProxyPtr /*proxy*/, const Logger::Level& level) {
-        boost::recursive_mutex::scoped_lock lock(mutex);
-        LoggerTreeNodePtr node = treeNode.lock();
-        node->getLoggerProxy()->getLogger()->setLevel(level);
-        node->setAssignedLevel(level);
-        // TODO we ignore the path anyways... Can this be done by the tree itself?
-        node->visit(LoggerTreeNode::VisitorPtr(new LevelSetter(level)),
-                LoggerTreeNode::NamePath());
+    /**
+     * Forgets all names.
+     */
+    void clear() {
+        retiredTables.push_back(table.load(boost::memory_order_relaxed));
+        table.store(new Table(INITIAL_CAPACITY), boost::memory_order_release);
     }
 
 private:
-    LoggerTreeNodeWeakPtr treeNode;
-    boost::recursive_mutex& mutex;
+
+    static const size_t INITIAL_CAPACITY = 64;
+
+    struct Entry {
+        size_t hash;
+        string name;
+        LoggerPtr logger;
+    };
+
+    struct Table {
+
+        /**
+         * @param capacity number of slots, must be a power of two
+         */
+        explicit Table(const size_t& capacity) :
+                mask(capacity - 1), size(0), slots(
+                        new boost::atomic<const Entry*>[capacity]) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].store(0, boost::memory_order_relaxed);
+            }
+        }
+
+        void add(const Entry* entry) {
+            size_t i = entry->hash & mask;
+            while (slots[i].load(boost::memory_order_relaxed)) {
+                i = (i + 1) & mask;
+            }
+            slots[i].store(entry, boost::memory_order_release);
+            ++size;
+        }
+
+        const size_t mask;
+        size_t size;
+        boost::scoped_array<boost::atomic<const Entry*> > slots;
+
+    };
+
+    boost::atomic<Table*> table;
+    vector<Table*> retiredTables;
+    vector<Entry*> entries;
 
 };
 
-LoggerFactory::LoggerFactory() {
+const size_t LoggerFactory::LoggerCache::INITIAL_CAPACITY;
+
+LoggerFactory::LoggerFactory() :
+        levels(new LevelTable(DEFAULT_LEVEL)), cache(new LoggerCache) {
     reselectLoggingSystem();
     loggerTree.reset(new LoggerTreeNode("", LoggerTreeNodePtr()));
     LoggerPtr logger(loggingSystem->createLogger(""));
     LoggerProxyPtr proxy(
-            new LoggerProxy(
-                    logger,
+            new LoggerProxy(logger,
                     LoggerProxy::SetLevelCallbackPtr(
-                            new TreeLevelUpdater(
-                                    LoggerTreeNodeWeakPtr(loggerTree),
-                                    mutex))));
+                            new TreeLevelUpdater(levels, "")), levels, ""));
     loggerTree->setLoggerProxy(proxy);
-    // assign the initial level to the only logger available, which is the root logger
-    // by directly assigning the level to the proxied logger we prevent the
-    // callback mechanism from working uselessly
-    logger->setLevel(DEFAULT_LEVEL);
-    loggerTree->setAssignedLevel(DEFAULT_LEVEL);
 }
 
 LoggerFactory::~LoggerFactory() {
@@ -146,11 +246,9 @@ public:
 
     bool visit(const LoggerTreeNode::NamePath& path, LoggerTreeNodePtr node,
             const Logger::Level& /*parentLevel*/) {
-        const Logger::Level oldLevel =
-                node->getLoggerProxy()->getLogger()->getLevel();
+        // the proxy assigns its level to the new logger
         node->getLoggerProxy()->setLogger(
                 newSystem->createLogger(LoggerTreeNode::pathToName(path)));
-        node->getLoggerProxy()->getLogger()->setLevel(oldLevel);
         return true;
     }
 private:
@@ -176,6 +274,11 @@ void LoggerFactory::reselectLoggingSystem(const std::string& nameHint) {
     } else {
         // auto-select fallback
 
+        // systems shipped with RSC are only used on explicit request
+        keys.erase(AsyncConsoleLoggingSystem::getName());
+        keys.erase(FileLoggingSystem::getName());
+        keys.erase(BinaryLoggingSystem::getName());
+        keys.erase(CrashRingLoggingSystem::getName());
         if (keys.size() > 1) {
             // do not use default if other options are available
             keys.erase(DEFAULT_LOGGING_SYSTEM);
@@ -190,10 +293,8 @@ void LoggerFactory::reselectLoggingSystem(const std::string& nameHint) {
 
     // update existing loggers to use the new logging system
     if (loggerTree) {
-        const Logger::Level oldLevel = loggerTree->getLoggerProxy()->getLevel();
         loggerTree->getLoggerProxy()->setLogger(
                 loggingSystem->createLogger(""));
-        loggerTree->getLoggerProxy()->getLogger()->setLevel(oldLevel);
         loggerTree->visit(
                 LoggerTreeNode::VisitorPtr(new ReselectVisitor(loggingSystem)));
     }
@@ -202,57 +303,111 @@ void LoggerFactory::reselectLoggingSystem(const std::string& nameHint) {
 
 LoggerProxyPtr LoggerFactory::createLogger(const LoggerTreeNode::NamePath& path,
         LoggerTreeNodePtr node) {
-    LoggerPtr logger(
-            loggingSystem->createLogger(LoggerTreeNode::pathToName(path)));
+    const string name = LoggerTreeNode::pathToName(path);
+    LoggerPtr logger(loggingSystem->createLogger(name));
+    // the level is derived from the level table by the proxy
     LoggerProxyPtr proxy(
-            new LoggerProxy(
-                    logger,
+            new LoggerProxy(logger,
                     LoggerProxy::SetLevelCallbackPtr(
-                            new TreeLevelUpdater(LoggerTreeNodeWeakPtr(node),
-                                    mutex))));
-    // new level can be derived from parent logger
-    logger->setLevel(
-            node->getParent()->getLoggerProxy()->getLogger()->getLevel());
+                            new TreeLevelUpdater(levels, name)), levels, name));
+    // the rate limit is inherited from the parent logger
+    proxy->setRateLimit(node->getParent()->getLoggerProxy()->getRateLimit());
     return proxy;
 }
 
 LoggerPtr LoggerFactory::getLogger(const string& name) {
+
+    LoggerPtr logger = cache->find(name);
+    if (logger) {
+        return logger;
+    }
+
     boost::recursive_mutex::scoped_lock lock(mutex);
+    // another thread might have created the logger in the meantime
+    logger = cache->find(name);
+    if (logger) {
+        return logger;
+    }
+
     LoggerTreeNode::NamePath path = LoggerTreeNode::nameToPath(name);
     if (path.empty()) {
-        return loggerTree->getLoggerProxy();
+        logger = loggerTree->getLoggerProxy();
+    } else {
+        LoggerTreeNodePtr node = loggerTree->addChildren(path,
+                boost::bind(&LoggerFactory::createLogger, this, _1, _2));
+        logger = node->getLoggerProxy();
     }
-    LoggerTreeNodePtr node = loggerTree->addChildren(path,
-            boost::bind(&LoggerFactory::createLogger, this, _1, _2));
-    return node->getLoggerProxy();
+    cache->insert(name, logger);
+    return logger;
+
+}
+
+void LoggerFactory::reconfigure(const Logger::Level& level) {
+    levels->reassignAll(level);
 }
 
-class LoggerFactory::ReconfigurationVisitor: public LoggerTreeNode::Visitor {
+void LoggerFactory::setLevel(const string& name, const Logger::Level& level) {
+    levels->assign(name, level);
+}
+
+void LoggerFactory::setLevels(const map<string, Logger::Level>& levels) {
+    this->levels->assign(levels);
+}
+
+/**
+ * Propagates a rate limit down the logger tree but stops at loggers with an
+ * assigned limit.
+ *
+ * @author jwienke
+ */
+class LoggerFactory::RateLimitVisitor: public LoggerTreeNode::Visitor {
 public:
 
-    ReconfigurationVisitor(const Logger::Level &newLevel) :
-            newLevel(newLevel) {
+    RateLimitVisitor(const RateLimit& limit) :
+            limit(limit) {
     }
 
     bool visit(const LoggerTreeNode::NamePath& /*path*/, LoggerTreeNodePtr node,
             const Logger::Level& /*parentLevel*/) {
-        if (node->hasAssignedLevel()) {
-            node->setAssignedLevel(newLevel);
+        if (node->hasAssignedRateLimit()) {
+            return false;
         }
-        node->getLoggerProxy()->getLogger()->setLevel(newLevel);
+        node->getLoggerProxy()->setRateLimit(limit);
         return true;
-
     }
+
 private:
-    Logger::Level newLevel;
+    RateLimit limit;
 };
 
-void LoggerFactory::reconfigure(const Logger::Level& level) {
+LoggerProxyPtr LoggerFactory::getLoggerProxy(const string& name) {
+    // all loggers handed out by the factory are proxies of the tree
+    return boost::static_pointer_cast<LoggerProxy>(getLogger(name));
+}
+
+void LoggerFactory::setRateLimit(const string& name, const RateLimit& limit) {
+
     boost::recursive_mutex::scoped_lock lock(mutex);
-    loggerTree->getLoggerProxy()->getLogger()->setLevel(level);
-    loggerTree->setAssignedLevel(level);
-    loggerTree->visit(
-            LoggerTreeNode::VisitorPtr(new ReconfigurationVisitor(level)));
+
+    LoggerProxyPtr proxy = getLoggerProxy(name);
+    // validates the limit before modifying the tree
+    proxy->setRateLimit(limit);
+
+    const LoggerTreeNode::NamePath path = LoggerTreeNode::nameToPath(name);
+    LoggerTreeNodePtr node =
+            path.empty() ? loggerTree : loggerTree->getChild(path);
+    node->setAssignedRateLimit(limit);
+    node->visit(LoggerTreeNode::VisitorPtr(new RateLimitVisitor(limit)),
+            path);
+
+}
+
+RateLimit LoggerFactory::getRateLimit(const string& name) {
+    return getLoggerProxy(name)->getRateLimit();
+}
+
+boost::uint64_t LoggerFactory::getSuppressedMessages(const string& name) {
+    return getLoggerProxy(name)->getSuppressedMessages();
 }
 
 string LoggerFactory::getLoggingSystemName() {
@@ -263,15 +418,21 @@ string LoggerFactory::getLoggingSystemName() {
 void LoggerFactory::clearKnownLoggers() {
     boost::recursive_mutex::scoped_lock lock(mutex);
     loggerTree->clearChildren();
+    cache->clear();
+    levels->clear();
 }
 
 void LoggerFactory::reconfigureFromFile(const string& fileName) {
-    OptionBasedConfigurator configurator;
+    OptionBasedConfigurator configurator(*this);
     boost::filesystem::ifstream stream(fileName);
     if (!stream) {
         throw invalid_argument("Unable to open file " + fileName);
     }
-    config::ConfigFileSource(stream).provideOptions(configurator);
+    stream.close();
+    config::ConfigFileSource source((boost::filesystem::path(fileName)));
+    configurator.beginBatch();
+    source.provideOptions(configurator);
+    configurator.commitBatch();
 }
 
 }
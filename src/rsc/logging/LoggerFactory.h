@@ -30,6 +30,7 @@
 #include <vector>
 
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/thread/recursive_mutex.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -37,6 +38,7 @@
 #include "LoggerTreeNode.h"
 #include "LoggerProxy.h"
 #include "LoggingSystem.h"
+#include "RateLimiter.h"
 #include "../patterns/Singleton.h"
 #include "../misc/langutils.h"
 #include "rsc/rscexports.h"
@@ -60,11 +62,17 @@ namespace rsc {
  *
  * In detail, the logger names have the following conventions and rules:
  *  - name are handled case-insensitive
- *  - the part after the last . must not be called "system" or "level"
- *    (case-insensitive)
+ *  - the part after the last . must not be called "system", "level",
+ *    "ratelimit" or "sampling" (case-insensitive)
  *  - you should not include = characters and any kind of line breaks as they
  *    might interfere with configuration system
  *
+ * Similar to levels, a RateLimit can be assigned to a logger, which is then
+ * inherited by all child loggers without an own assigned limit. Each logger
+ * applies the limit on its own, so a flooding logger does not suppress the
+ * messages of its siblings. Messages suppressed by a limit are counted per
+ * logger.
+ *
  * To install new LoggingSystem instances, register them in #loggingSystemRegistry.
  * The selection of a logging system can be triggered through
  * LoggerFactory#reselectLoggingSystem using a string as a hint.
@@ -96,7 +104,9 @@ public:
      *
      * Receiving a logger is a quite expensive operation if a logger with the
      * specified name did not exist before at runtime. Hence, do not use
-     * constantly changing names for loggers with a short lifetime.
+     * constantly changing names for loggers with a short lifetime. Once a
+     * name has been requested, subsequent lookups with exactly the same name
+     * are served from a cache without acquiring a lock.
      *
      * @param name name of the logger, empty string means root logger
      * @return logger instance
@@ -116,7 +126,55 @@ public:
     void reconfigure(const Logger::Level& level);
 
     /**
-     * Reconfigures the logging system from a configuration file.
+     * Assigns a rate limit to a logger and all of its children which do not
+     * have an own limit assigned. The logger is created if it does not
+     * exist.
+     *
+     * @param name name of the logger, empty string means root logger
+     * @param limit new limit, a default-constructed RateLimit disables
+     *              limiting
+     * @throw std::invalid_argument invalid limit
+     */
+    void setRateLimit(const std::string& name, const RateLimit& limit);
+
+    /**
+     * Returns the rate limit which is effectively applied to a logger, i.e.
+     * the assigned one or the one inherited from the closest parent.
+     *
+     * @param name name of the logger, empty string means root logger
+     * @return effective limit
+     */
+    RateLimit getRateLimit(const std::string& name);
+
+    /**
+     * Returns the number of messages of a logger which were suppressed by
+     * its rate limit.
+     *
+     * @param name name of the logger, empty string means root logger
+     * @return number of suppressed messages
+     */
+    boost::uint64_t getSuppressedMessages(const std::string& name);
+
+    /**
+     * Assigns a level to a logger. Equivalent to Logger#setLevel but does not
+     * require the logger to exist.
+     *
+     * @param name name of the logger, empty string means root logger
+     * @param level new level
+     */
+    void setLevel(const std::string& name, const Logger::Level& level);
+
+    /**
+     * Assigns levels to several loggers at once. Loggers either observe all
+     * or none of the new levels.
+     *
+     * @param levels map from logger names to new levels
+     */
+    void setLevels(const std::map<std::string, Logger::Level>& levels);
+
+    /**
+     * Reconfigures the logging system from a configuration file. All level
+     * settings of the file are applied at once.
      *
      * @param fileName name of the configuration file
      * @throw std::invalid_argument invalid file path
@@ -129,7 +187,10 @@ public:
      * select.
      *
      * If no hint is given the first found logging system which is not the
-     * default will be selected. If no such system exists, the default is used.
+     * default will be selected. Alternative logging systems shipped with RSC,
+     * e.g. AsyncConsoleLoggingSystem, FileLoggingSystem or
+     * BinaryLoggingSystem, are not considered in this case. If no
+     * such system exists, the default is used.
      * The name hint overrides these settings if a logging system matching the
      * hint is found.
      *
@@ -167,17 +228,35 @@ public:
 
 private:
 
-    class ReconfigurationVisitor;
     class ReselectVisitor;
+    class RateLimitVisitor;
+    class LoggerCache;
 
     LoggerProxyPtr createLogger(const LoggerTreeNode::NamePath& path,
             LoggerTreeNodePtr node);
 
+    /**
+     * Returns the proxy of a logger, creating the logger if required.
+     */
+    LoggerProxyPtr getLoggerProxy(const std::string& name);
+
     boost::shared_ptr<LoggingSystem> loggingSystem;
 
     boost::recursive_mutex mutex;
     LoggerTreeNodePtr loggerTree;
 
+    /**
+     * Levels assigned to the loggers of #loggerTree. Changes are published
+     * without #mutex.
+     */
+    LevelTablePtr levels;
+
+    /**
+     * Maps requested names to the proxies from #loggerTree. Modifications
+     * require #mutex.
+     */
+    boost::scoped_ptr<LoggerCache> cache;
+
 };
 
 }
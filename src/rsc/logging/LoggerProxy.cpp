@@ -29,18 +29,58 @@
 namespace rsc {
 namespace logging {
 
+namespace {
+
+const boost::uint64_t LEVEL_MASK = 0xffffffffULL;
+
+boost::uint64_t packLevel(const boost::uint64_t& epoch,
+        const Logger::Level& level) {
+    return ((epoch & LEVEL_MASK) << 32) | (boost::uint32_t) level;
+}
+
+Logger::Level unpackLevel(const boost::uint64_t& state) {
+    return (Logger::Level) (boost::uint32_t) (state & LEVEL_MASK);
+}
+
+boost::uint64_t unpackEpoch(const boost::uint64_t& state) {
+    return state >> 32;
+}
+
+/**
+ * Replaces the level of a packed state and keeps its epoch.
+ */
+void replaceLevel(boost::atomic<boost::uint64_t>& levelState,
+        const Logger::Level& level) {
+    boost::uint64_t state = levelState.load(boost::memory_order_relaxed);
+    while (!levelState.compare_exchange_weak(state,
+            packLevel(unpackEpoch(state), level), boost::memory_order_relaxed)) {
+    }
+}
+
+}
+
 LoggerProxy::SetLevelCallback::~SetLevelCallback() {
 }
 
 LoggerProxy::LoggerProxy(LoggerPtr logger, SetLevelCallbackPtr callback) :
-        logger(logger), callback(callback) {
+        logger(logger), levelState(packLevel(0, logger->getLevel())), limited(
+                false), suppressed(0), callback(callback) {
+}
+
+LoggerProxy::LoggerProxy(LoggerPtr logger, SetLevelCallbackPtr callback,
+        LevelTablePtr levels, const std::string& name) :
+        logger(logger), levelState(packLevel(0, logger->getLevel())), levels(
+                levels), levelNames(LevelTable::prefixNames(name)), limited(
+                false), suppressed(
+                0), callback(callback) {
+    refreshLevel();
 }
 
 LoggerProxy::~LoggerProxy() {
 }
 
 Logger::Level LoggerProxy::getLevel() const {
-    return logger->getLevel();
+    return currentLevel();
 }
 
 void LoggerProxy::setLevel(const Logger::Level& level) {
@@ -48,6 +88,47 @@ void LoggerProxy::setLevel(const Logger::Level& level) {
     callback->call(shared_from_this(), level);
 }
 
+bool LoggerProxy::isEnabledFor(const Logger::Level& level) const {
+    return level <= currentLevel();
+}
+
+Logger::Level LoggerProxy::currentLevel() const {
+    const boost::uint64_t state = levelState.load(boost::memory_order_relaxed);
+    if (levels
+            && (levels->getEpoch() & LEVEL_MASK) != unpackEpoch(state)) {
+        return refreshLevel();
+    }
+    return unpackLevel(state);
+}
+
+Logger::Level LoggerProxy::refreshLevel() const {
+
+    LevelTable::SnapshotPtr snapshot = levels->getSnapshot();
+    const Logger::Level newLevel = snapshot->effectiveLevel(levelNames);
+    const boost::uint64_t newState = packLevel(snapshot->epoch, newLevel);
+
+    boost::uint64_t state = levelState.load(boost::memory_order_relaxed);
+    do {
+        if (unpackEpoch(state) >= unpackEpoch(newState)) {
+            // a concurrent refresh applied this or a newer snapshot
+            return unpackLevel(state);
+        }
+    } while (!levelState.compare_exchange_weak(state, newState,
+            boost::memory_order_relaxed));
+
+    // Only the refresh publishing a state updates the hidden logger. If a
+    // newer refresh overtook this one in between, its level is applied
+    // again so that the hidden logger ends up with the newest level.
+    boost::uint64_t applied = newState;
+    logger->setLevel(newLevel);
+    while ((state = levelState.load(boost::memory_order_relaxed)) != applied) {
+        applied = state;
+        logger->setLevel(unpackLevel(state));
+    }
+    return newLevel;
+
+}
+
 std::string LoggerProxy::getName() const {
     return logger->getName();
 }
@@ -57,15 +138,69 @@ void LoggerProxy::setName(const std::string& name) {
 }
 
 void LoggerProxy::log(const Logger::Level& level, const std::string& msg) {
+    // disabled messages must not use up the rate limit
+    if (!isEnabledFor(level) || !acceptMessage()) {
+        return;
+    }
     logger->log(level, msg);
 }
 
+void LoggerProxy::logDeferred(const Logger::Level& level,
+        const DeferredMessage& msg) {
+    if (!isEnabledFor(level) || !acceptMessage()) {
+        return;
+    }
+    logger->logDeferred(level, msg);
+}
+
+bool LoggerProxy::acceptMessage() {
+    if (!limited.load(boost::memory_order_acquire)) {
+        return true;
+    }
+    RateLimiterPtr currentLimiter = boost::atomic_load(&limiter);
+    if (!currentLimiter || currentLimiter->accept()) {
+        return true;
+    }
+    suppressed.fetch_add(1, boost::memory_order_relaxed);
+    return false;
+}
+
 LoggerPtr LoggerProxy::getLogger() const {
     return logger;
 }
 
 void LoggerProxy::setLogger(LoggerPtr logger) {
     this->logger = logger;
+    if (levels) {
+        logger->setLevel(currentLevel());
+    } else {
+        replaceLevel(levelState, logger->getLevel());
+    }
+}
+
+void LoggerProxy::setLoggerLevel(const Logger::Level& level) {
+    logger->setLevel(level);
+    replaceLevel(levelState, level);
+}
+void LoggerProxy::setRateLimit(const RateLimit& limit) {
+    // also validates the limit if it does not limit anything
+    RateLimiterPtr newLimiter(new RateLimiter(limit));
+    if (limit.isLimited()) {
+        boost::atomic_store(&limiter, newLimiter);
+        limited.store(true, boost::memory_order_release);
+    } else {
+        limited.store(false, boost::memory_order_release);
+        boost::atomic_store(&limiter, RateLimiterPtr());
+    }
+}
+
+RateLimit LoggerProxy::getRateLimit() const {
+    RateLimiterPtr currentLimiter = boost::atomic_load(&limiter);
+    return currentLimiter ? currentLimiter->getLimit() : RateLimit();
+}
+
+boost::uint64_t LoggerProxy::getSuppressedMessages() const {
+    return suppressed.load(boost::memory_order_relaxed);
 }
 
 }
@@ -26,10 +26,16 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include <boost/atomic.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include "LevelTable.h"
 #include "Logger.h"
+#include "RateLimiter.h"
 
 namespace rsc {
 namespace logging {
@@ -38,6 +44,16 @@ namespace logging {
  * A proxy to an instance of Logger, which provides the same interface but
  * allows to exchange the underlying logger at runtime.
  *
+ * The proxy caches the level of the hidden logger so that level checks only
+ * require a single atomic load. Hence, the level of the hidden logger must
+ * only be changed through #setLoggerLevel. If the proxy is attached to a
+ * LevelTable, it additionally compares the epoch of the table with the one
+ * of its cached level on each check and updates the cached level and the
+ * hidden logger from the current snapshot of the table if required.
+ *
+ * Additionally, the proxy can suppress messages according to a RateLimit
+ * before they reach the hidden logger and counts the suppressed messages.
+ *
  * @author jwienke
  */
 class LoggerProxy: public Logger, public boost::enable_shared_from_this<
@@ -68,6 +84,18 @@ public:
      * @param callback callback invoked when #setLevel is called
      */
     LoggerProxy(LoggerPtr logger, SetLevelCallbackPtr callback);
+
+    /**
+     * Constructor for a proxy which takes its level from a LevelTable. The
+     * level of @p logger is immediately set from the table.
+     *
+     * @param logger the initial logger to hide behind this proxy
+     * @param callback callback invoked when #setLevel is called
+     * @param levels table with the assigned levels
+     * @param name full name of the logger in the table
+     */
+    LoggerProxy(LoggerPtr logger, SetLevelCallbackPtr callback,
+            LevelTablePtr levels, const std::string& name);
     virtual ~LoggerProxy();
 
     /**
@@ -77,9 +105,12 @@ public:
 
     virtual Logger::Level getLevel() const;
     virtual void setLevel(const Logger::Level& level);
+    virtual bool isEnabledFor(const Logger::Level& level) const;
     virtual std::string getName() const;
     virtual void setName(const std::string& name);
     virtual void log(const Logger::Level& level, const std::string& msg);
+    virtual void logDeferred(const Logger::Level& level,
+            const DeferredMessage& msg);
 
     //@}
 
@@ -97,14 +128,88 @@ public:
      */
     void setLogger(LoggerPtr logger);
 
+    /**
+     * Sets the level of the hidden logger without invoking the callback.
+     *
+     * @param level new level of the hidden logger
+     */
+    void setLoggerLevel(const Logger::Level& level);
+
+    /**
+     * Changes the limit for messages passed to the hidden logger. The state
+     * of a previous limit is discarded. Can be called from any thread.
+     *
+     * @param limit new limit
+     * @throw std::invalid_argument invalid limit
+     */
+    void setRateLimit(const RateLimit& limit);
+
+    /**
+     * Returns the current limit for messages passed to the hidden logger.
+     *
+     * @return current limit
+     */
+    RateLimit getRateLimit() const;
+
+    /**
+     * Returns the number of messages which were enabled by the level but
+     * suppressed by the rate limit.
+     *
+     * @return number of suppressed messages since creation
+     */
+    boost::uint64_t getSuppressedMessages() const;
+
 private:
 
+    /**
+     * Decides whether an enabled message passes the rate limit.
+     */
+    bool acceptMessage();
+
+    /**
+     * Returns the cached level after updating it if the level table has
+     * changed.
+     */
+    Logger::Level currentLevel() const;
+
+    /**
+     * Updates the cached level and the hidden logger from the level table
+     * unless a concurrent refresh already applied the same or a newer
+     * snapshot.
+     *
+     * @return the cached level after the refresh
+     */
+    Logger::Level refreshLevel() const;
+
     /**
      * The hidden logger. We rely on the locking of boost::shared_ptr for access
      * to this instance, even on reselection.
      */
     LoggerPtr logger;
 
+    /**
+     * Cached level of #logger in the lower 32 bits and the epoch of #levels
+     * it has been derived from in the upper 32 bits. Both are updated with a
+     * single atomic operation so that concurrent refreshes cannot combine a
+     * stale level with a newer epoch.
+     */
+    mutable boost::atomic<boost::uint64_t> levelState;
+
+    LevelTablePtr levels;
+
+    /**
+     * Names of this logger and its ancestors in #levels.
+     */
+    std::vector<std::string> levelNames;
+
+    /**
+     * Indicates whether #limiter is set so that unlimited loggers do not
+     * need to load it atomically.
+     */
+    boost::atomic<bool> limited;
+    RateLimiterPtr limiter;
+    boost::atomic<boost::uint64_t> suppressed;
+
     SetLevelCallbackPtr callback;
 
 };
@@ -107,7 +107,7 @@ void LoggerTreeNode::visit(VisitorPtr visitor, const NamePath& thisPath) {
         childPath.push_back(it->first);
 
         bool descend = visitor->visit(childPath, it->second,
-                loggerProxy->getLogger()->getLevel());
+                loggerProxy->getLevel());
         if (descend) {
             it->second->visit(visitor, childPath);
         }
@@ -129,6 +129,9 @@ bool LoggerTreeNode::hasChild(const NamePath& path) const {
     if (childIt == children.end()) {
         return false;
     }
+    if (path.size() == 1) {
+        return true;
+    }
     NamePath subPath = path;
     subPath.erase(subPath.begin());
     return childIt->second->hasChild(subPath);
@@ -139,7 +142,7 @@ LoggerTreeNodePtr LoggerTreeNode::getChild(const string& name) const {
     if (it == children.end()) {
         throw invalid_argument(
                 boost::str(
-                        boost::format("No direct child with name %1 exists.")
+                        boost::format("No direct child with name %1% exists.")
                                 % name));
     }
     return it->second;
@@ -154,8 +157,11 @@ LoggerTreeNodePtr LoggerTreeNode::getChild(const NamePath& path) const {
     if (childIt == children.end()) {
         throw invalid_argument(
                 boost::str(
-                        boost::format("No direct child with name %1 exists.")
-                                % name));
+                        boost::format("No direct child with name %1% exists.")
+                                % path.front()));
+    }
+    if (path.size() == 1) {
+        return childIt->second;
     }
     NamePath subPath = path;
     subPath.erase(subPath.begin());
@@ -206,20 +212,16 @@ string LoggerTreeNode::pathToName(const NamePath& path) {
     return s.str();
 }
 
-boost::shared_ptr<Logger::Level> LoggerTreeNode::getAssignedLevel() const {
-    return assignedLevel;
-}
-
-void LoggerTreeNode::setAssignedLevel(boost::shared_ptr<Logger::Level> level) {
-    this->assignedLevel = level;
+boost::shared_ptr<RateLimit> LoggerTreeNode::getAssignedRateLimit() const {
+    return assignedRateLimit;
 }
 
-void LoggerTreeNode::setAssignedLevel(const Logger::Level& level) {
-    assignedLevel.reset(new Logger::Level(level));
+void LoggerTreeNode::setAssignedRateLimit(const RateLimit& limit) {
+    assignedRateLimit.reset(new RateLimit(limit));
 }
 
-bool LoggerTreeNode::hasAssignedLevel() const {
-    return assignedLevel.get() != NULL;
+bool LoggerTreeNode::hasAssignedRateLimit() const {
+    return assignedRateLimit.get() != NULL;
 }
 
 }
@@ -35,6 +35,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include "LoggerProxy.h"
+#include "RateLimiter.h"
 
 namespace rsc {
 namespace logging {
@@ -161,10 +162,9 @@ public:
     static NamePath nameToPath(const std::string& name);
     static std::string pathToName(const NamePath& path);
 
-    boost::shared_ptr<Logger::Level> getAssignedLevel() const;
-    void setAssignedLevel(boost::shared_ptr<Logger::Level> level);
-    void setAssignedLevel(const Logger::Level& level);
-    bool hasAssignedLevel() const;
+    boost::shared_ptr<RateLimit> getAssignedRateLimit() const;
+    void setAssignedRateLimit(const RateLimit& limit);
+    bool hasAssignedRateLimit() const;
 
 private:
 
@@ -178,7 +178,7 @@ private:
     LoggerTreeNodeWeakPtr parent;
     std::map<std::string, LoggerTreeNodePtr> children;
 
-    boost::shared_ptr<Logger::Level> assignedLevel;
+    boost::shared_ptr<RateLimit> assignedRateLimit;
 
 };
 
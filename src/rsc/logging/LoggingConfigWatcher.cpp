@@ -0,0 +1,56 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "LoggingConfigWatcher.h"
+
+#include <vector>
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+LoggingConfigWatcher::LoggingConfigWatcher(const string& fileName,
+        const unsigned int& pollInterval) :
+        fileName(fileName), watcher(fileName, "", 0, 0, pollInterval, true,
+                "/", vector<string>(1, fileName)) {
+    watcher.addHandler(configurator, true);
+}
+
+LoggingConfigWatcher::~LoggingConfigWatcher() {
+}
+
+string LoggingConfigWatcher::getFileName() const {
+    return fileName;
+}
+
+unsigned int LoggingConfigWatcher::getReloads() const {
+    return watcher.getReloads();
+}
+
+}
+}
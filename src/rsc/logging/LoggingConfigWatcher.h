@@ -0,0 +1,93 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <string>
+
+#include <boost/noncopyable.hpp>
+
+#include "OptionBasedConfigurator.h"
+#include "../config/ConfigWatcher.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * Reconfigures the logging system from a configuration file whenever the
+ * file changes. The file is watched by a config::ConfigWatcher which passes
+ * the changed options to an OptionBasedConfigurator as one batch. Hence, all
+ * levels changed by a reload are published at once and logging threads are
+ * never blocked by a reload. A removed file keeps the current
+ * configuration.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT LoggingConfigWatcher: private boost::noncopyable {
+public:
+
+    /**
+     * Applies the file if it exists and starts watching it.
+     *
+     * @param fileName name of the configuration file
+     * @param pollInterval interval between checks in milliseconds if the
+     *                     file cannot be watched with inotify
+     */
+    explicit LoggingConfigWatcher(const std::string& fileName,
+            const unsigned int& pollInterval = 1000);
+
+    /**
+     * Stops watching the file.
+     */
+    virtual ~LoggingConfigWatcher();
+
+    /**
+     * Returns the name of the watched file.
+     *
+     * @return file name
+     */
+    std::string getFileName() const;
+
+    /**
+     * Returns the number of reloads since construction which changed an
+     * option, excluding the initial application of the file.
+     *
+     * @return number of reloads
+     */
+    unsigned int getReloads() const;
+
+private:
+
+    const std::string fileName;
+    OptionBasedConfigurator configurator;
+    config::ConfigWatcher watcher;
+
+};
+
+}
+}
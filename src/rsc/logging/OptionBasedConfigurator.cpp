@@ -26,8 +26,16 @@
 
 #include "OptionBasedConfigurator.h"
 
+#include <iostream>
+#include <stdexcept>
+
 #include <boost/algorithm/string.hpp>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
 
+#include "BinaryLoggingSystem.h"
+#include "CrashRingLoggingSystem.h"
+#include "FileLoggingSystem.h"
 #include "Logger.h"
 #include "LoggerFactory.h"
 #include "../runtime/ContainerIO.h"
@@ -38,9 +46,58 @@ using namespace rsc::config;
 namespace rsc {
 namespace logging {
 
+namespace {
+
+template<class T>
+T parseNumber(const string& setting, const string& value) {
+    try {
+        return boost::lexical_cast<T>(boost::algorithm::trim_copy(value));
+    } catch (const boost::bad_lexical_cast&) {
+        throw invalid_argument(
+                "Invalid number '" + value + "' for setting " + setting + ".");
+    }
+}
+
+/**
+ * Parses a rate limit of the form rate[:burst] into the given limit. "off"
+ * disables the token bucket.
+ */
+void parseRateLimit(const string& value, RateLimit& limit) {
+    const string normalized = boost::algorithm::to_lower_copy(
+            boost::algorithm::trim_copy(value));
+    if (normalized == "off") {
+        limit.rate = 0;
+        limit.burst = 0;
+        return;
+    }
+    const string::size_type separator = normalized.find(':');
+    limit.rate = parseNumber<double>("ratelimit",
+            normalized.substr(0, separator));
+    limit.burst =
+            separator == string::npos ?
+                    0 :
+                    parseNumber<unsigned int>("ratelimit",
+                            normalized.substr(separator + 1));
+    if (limit.rate < 0) {
+        throw invalid_argument(
+                "Invalid rate '" + value + "' for setting ratelimit.");
+    }
+}
+
+}
+
 OptionBasedConfigurator::OptionBasedConfigurator(
         const vector<string>& rootOption) :
-        rootOption(normalizeKey(rootOption)) {
+        rootOption(normalizeKey(rootOption)), factory(NULL), batch(false),
+        schema(false) {
+    declareOptions(schema);
+}
+
+OptionBasedConfigurator::OptionBasedConfigurator(LoggerFactory& factory,
+        const vector<string>& rootOption) :
+        rootOption(normalizeKey(rootOption)), factory(&factory), batch(false),
+        schema(false) {
+    declareOptions(schema);
 }
 
 OptionBasedConfigurator::~OptionBasedConfigurator() {
@@ -57,25 +114,6 @@ vector<string> OptionBasedConfigurator::getRootOption() const {
     return rootOption;
 }
 
-bool OptionBasedConfigurator::keyStartWithRoot(
-        const vector<string>& key) const {
-
-    if (key.size() < rootOption.size()) {
-        return false;
-    }
-
-    for (size_t i = 0; i < rootOption.size(); ++i) {
-        string keyPart = key[i];
-        boost::algorithm::to_lower(keyPart);
-        if (rootOption[i] != keyPart) {
-            return false;
-        }
-    }
-
-    return true;
-
-}
-
 string OptionBasedConfigurator::loggerNameFromKey(
         const vector<string>& key) const {
     string name;
@@ -95,47 +133,163 @@ string OptionBasedConfigurator::loggerNameFromKey(
 
 void OptionBasedConfigurator::handleOption(const vector<string>& key,
         const string& value) {
+    schema.handleOption(key, value);
+}
+
+void OptionBasedConfigurator::declareOptions(OptionSchema& schema) {
+
+    // logger settings: <root>.<logger name>.<setting>
+    vector<string> pattern = rootOption;
+    pattern.push_back("**");
+    pattern.push_back("level");
+    schema.addOption<string>(this, pattern,
+            boost::bind(&OptionBasedConfigurator::handleLevel, this, _1, _2));
+    pattern.back() = "ratelimit";
+    schema.addOption<string>(this, pattern,
+            boost::bind(&OptionBasedConfigurator::handleRateLimit, this, _1,
+                    _2));
+    pattern.back() = "sampling";
+    schema.addOption<unsigned int>(this, pattern,
+            boost::bind(&OptionBasedConfigurator::handleSampling, this, _1,
+                    _2));
+    pattern.pop_back();
+    pattern.back() = "system";
+    schema.addOption<string>(this, pattern,
+            boost::bind(&OptionBasedConfigurator::handleSystem, this, _1, _2));
 
-    vector<string> normalizedKey = normalizeKey(key);
+    // options of the file and crash ring logging systems. level and system
+    // still refer to the loggers of the same name.
+    const char* systems[] = { "file", "binary", "crashring" };
+    for (size_t i = 0; i < sizeof(systems) / sizeof(systems[0]); ++i) {
+        pattern = rootOption;
+        pattern.push_back(systems[i]);
+        pattern.push_back("*");
+        schema.addOption<string>(this, pattern,
+                boost::bind(&OptionBasedConfigurator::handleSystemOption, this,
+                        _1, _2));
+        pattern.back() = "level";
+        schema.addOption<string>(this, pattern,
+                boost::bind(&OptionBasedConfigurator::handleLevel, this, _1,
+                        _2));
+        pattern.back() = "system";
+        schema.addOption<string>(this, pattern,
+                boost::bind(&OptionBasedConfigurator::handleSystem, this, _1,
+                        _2));
+    }
+
+}
 
-    if (!keyStartWithRoot(normalizedKey)) {
+void OptionBasedConfigurator::handleLevel(const vector<string>& key,
+        const string& value) {
+
+    Logger::Level level;
+    if (value == "ALL") {
+        level = Logger::LEVEL_ALL;
+    } else if (value == "TRACE") {
+        level = Logger::LEVEL_TRACE;
+    } else if (value == "DEBUG") {
+        level = Logger::LEVEL_DEBUG;
+    } else if (value == "INFO") {
+        level = Logger::LEVEL_INFO;
+    } else if (value == "WARN") {
+        level = Logger::LEVEL_WARN;
+    } else if (value == "ERROR") {
+        level = Logger::LEVEL_ERROR;
+    } else if (value == "FATAL") {
+        level = Logger::LEVEL_FATAL;
+    } else if (value == "OFF") {
+        level = Logger::LEVEL_OFF;
+    } else {
         return;
     }
 
-    // something can only be a valid key for the configuration if there is a
-    // chance that a special configuration key is at the end. Hence, sufficient
-    // length is required
-    if (normalizedKey.size() <= rootOption.size()) {
+    const string name = loggerNameFromKey(normalizeKey(key));
+    if (batch) {
+        batchLevels[name] = level;
+    } else {
+        getFactory().setLevel(name, level);
+    }
+
+}
+
+void OptionBasedConfigurator::handleSystem(const vector<string>& key,
+        const string& value) {
+    // only the root logger selects the logging system
+    if (key.size() == rootOption.size() + 1) {
+        getFactory().reselectLoggingSystem(value);
+    }
+}
+
+void OptionBasedConfigurator::handleRateLimit(const vector<string>& key,
+        const string& value) {
+    const string name = loggerNameFromKey(normalizeKey(key));
+    RateLimit limit = getFactory().getRateLimit(name);
+    parseRateLimit(value, limit);
+    getFactory().setRateLimit(name, limit);
+}
+
+void OptionBasedConfigurator::handleSampling(const vector<string>& key,
+        const unsigned int& sampling) {
+    const string name = loggerNameFromKey(normalizeKey(key));
+    RateLimit limit = getFactory().getRateLimit(name);
+    limit.sampling = sampling;
+    getFactory().setRateLimit(name, limit);
+}
+
+void OptionBasedConfigurator::handleSystemOption(const vector<string>& key,
+        const string& value) {
+
+    const vector<string> normalizedKey = normalizeKey(key);
+    const string& system = normalizedKey[rootOption.size()];
+    const string& setting = normalizedKey.back();
+
+    // Unknown settings are ignored like unknown logger settings, since they
+    // may stem from unrelated environment variables. Logging the warning
+    // could use the logging system being configured.
+    if ((system == "crashring" && !CrashRingLoggingSystem::isOption(setting))
+            || (system != "crashring"
+                    && !FileLoggingSystem::isOption(setting))) {
+        cerr << "rsc.logging.OptionBasedConfigurator: Ignoring unknown option "
+                << setting << " of the " << system << " logging system."
+                << endl;
+        return;
+    }
+
+    if (system == "crashring") {
+        boost::shared_ptr<CrashRingLoggingSystem> crashSystem =
+                boost::dynamic_pointer_cast<CrashRingLoggingSystem>(
+                        loggingSystemRegistry()->getRegistree(
+                                CrashRingLoggingSystem::getName()));
+        crashSystem->setOption(setting, value);
         return;
     }
 
-    LoggerPtr logger = Logger::getLogger(loggerNameFromKey(normalizedKey));
-
-    string setting = normalizedKey.back();
-    if (setting == "level") {
-
-        if (value == "ALL") {
-            logger->setLevel(Logger::LEVEL_ALL);
-        } else if (value == "TRACE") {
-            logger->setLevel(Logger::LEVEL_TRACE);
-        } else if (value == "DEBUG") {
-            logger->setLevel(Logger::LEVEL_DEBUG);
-        } else if (value == "INFO") {
-            logger->setLevel(Logger::LEVEL_INFO);
-        } else if (value == "WARN") {
-            logger->setLevel(Logger::LEVEL_WARN);
-        } else if (value == "ERROR") {
-            logger->setLevel(Logger::LEVEL_ERROR);
-        } else if (value == "FATAL") {
-            logger->setLevel(Logger::LEVEL_FATAL);
-        } else if (value == "OFF") {
-            logger->setLevel(Logger::LEVEL_OFF);
-        }
-
-    } else if (setting == "system" && logger->getName() == "") {
-        LoggerFactory::getInstance().reselectLoggingSystem(value);
+    const string systemName =
+            system == "file" ?
+                    FileLoggingSystem::getName() :
+                    BinaryLoggingSystem::getName();
+    boost::shared_ptr<FileLoggingSystem> fileSystem =
+            boost::dynamic_pointer_cast<FileLoggingSystem>(
+                    loggingSystemRegistry()->getRegistree(systemName));
+    fileSystem->setOption(setting, value);
+
+}
+
+void OptionBasedConfigurator::beginBatch() {
+    batch = true;
+}
+
+void OptionBasedConfigurator::commitBatch() {
+    map<string, Logger::Level> levels;
+    levels.swap(batchLevels);
+    batch = false;
+    if (!levels.empty()) {
+        getFactory().setLevels(levels);
     }
+}
 
+LoggerFactory& OptionBasedConfigurator::getFactory() const {
+    return factory ? *factory : LoggerFactory::getInstance();
 }
 
 vector<string> OptionBasedConfigurator::normalizeKey(
@@ -26,12 +26,22 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "Logger.h"
 #include "../config/OptionHandler.h"
+#include "../config/OptionSchema.h"
 #include "rsc/rscexports.h"
 
 namespace rsc {
 namespace logging {
 
+class LoggerFactory;
+
 /**
  * A class which configures the logging tree using configuration subsystem of
  * RSC. The usual logging hierarchy is mapped onto the hierarchy of options in
@@ -40,10 +50,30 @@ namespace logging {
  * @c rsc.logging. This is called the root option.
  *
  * This class can be used multiple times. Newer options override older ones.
+ * Level settings are applied immediately unless a batch has been started
+ * with #beginBatch. In this case they are collected and applied as one
+ * change by #commitBatch, so that loggers never observe a partially applied
+ * configuration.
+ *
+ * Rate limits are configured per logger with the settings @c ratelimit,
+ * either @c off or messages per second with an optional burst size
+ * separated by a colon, e.g. @c 100:20, and @c sampling, the n for keeping
+ * only every n-th message. Invalid values result in std::invalid_argument.
+ *
+ * Options of the form @c rsc.logging.file.<setting> apart from @c level and
+ * @c system are passed to FileLoggingSystem#setOption, options of the form
+ * @c rsc.logging.binary.<setting> to the BinaryLoggingSystem and options of
+ * the form @c rsc.logging.crashring.<setting> to
+ * CrashRingLoggingSystem#setOption. Hence, loggers named @c file, @c binary
+ * or @c crashring directly below the root logger can only be configured
+ * with @c level. Unknown settings of these systems are reported on
+ * @c std::cerr and ignored, invalid values of known settings result in
+ * std::invalid_argument.
  *
  * @author jwienke
  */
-class RSC_EXPORT OptionBasedConfigurator: public config::OptionHandler {
+class RSC_EXPORT OptionBasedConfigurator: public config::BatchOptionHandler,
+        private boost::noncopyable {
 public:
 
     /**
@@ -55,6 +85,18 @@ public:
     OptionBasedConfigurator(const std::vector<std::string>& rootOption =
             getDefaultRootOption());
 
+    /**
+     * Constructs a new configurator for a specific factory instead of the
+     * singleton instance.
+     *
+     * @param factory factory to configure, must outlive the configurator
+     * @param rootOption the root in the option namespace containing the logger
+     *                   configurations
+     */
+    explicit OptionBasedConfigurator(LoggerFactory& factory,
+            const std::vector<std::string>& rootOption =
+                    getDefaultRootOption());
+
     /**
      * Destructor.
      */
@@ -78,17 +120,59 @@ public:
     virtual void handleOption(const std::vector<std::string>& key,
             const std::string& value);
 
+    /**
+     * Declares the options processed by this configurator below its root
+     * option, allowing it to be configured together with other consumers
+     * of a shared schema. The schema should not be case-sensitive.
+     *
+     * @param schema schema to add the options to
+     */
+    void declareOptions(config::OptionSchema& schema);
+
+    /**
+     * Starts collecting level settings instead of applying them.
+     */
+    virtual void beginBatch();
+
+    /**
+     * Applies all level settings collected since #beginBatch at once and
+     * ends the batch.
+     */
+    virtual void commitBatch();
+
 private:
 
-    bool keyStartWithRoot(const std::vector<std::string>& key) const;
+    LoggerFactory& getFactory() const;
+
     std::string loggerNameFromKey(const std::vector<std::string>& key) const;
     std::string settingFromKey(const std::vector<std::string>& key) const;
 
     std::vector<std::string> normalizeKey(
             const std::vector<std::string>& key) const;
 
+    void handleLevel(const std::vector<std::string>& key,
+            const std::string& value);
+    void handleSystem(const std::vector<std::string>& key,
+            const std::string& value);
+    void handleRateLimit(const std::vector<std::string>& key,
+            const std::string& value);
+    void handleSampling(const std::vector<std::string>& key,
+            const unsigned int& sampling);
+    void handleSystemOption(const std::vector<std::string>& key,
+            const std::string& value);
+
     std::vector<std::string> rootOption;
 
+    /**
+     * Factory to configure or @c NULL for the singleton.
+     */
+    LoggerFactory* factory;
+
+    bool batch;
+    std::map<std::string, Logger::Level> batchLevels;
+
+    config::OptionSchema schema;
+
 };
 
 }
@@ -0,0 +1,111 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "RateLimiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "../misc/Clock.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+RateLimit::RateLimit() :
+        rate(0), burst(0), sampling(1) {
+}
+
+RateLimit::RateLimit(const double& rate, const unsigned int& burst,
+        const unsigned int& sampling) :
+        rate(rate), burst(burst), sampling(sampling) {
+}
+
+bool RateLimit::isLimited() const {
+    return rate > 0 || sampling > 1;
+}
+
+bool RateLimit::operator==(const RateLimit& other) const {
+    return rate == other.rate && burst == other.burst
+            && sampling == other.sampling;
+}
+
+bool RateLimit::operator!=(const RateLimit& other) const {
+    return !(*this == other);
+}
+
+RateLimiter::RateLimiter(const RateLimit& limit) :
+        limit(limit), interval(0), tolerance(0), nextArrival(0), samplingCounter(
+                0) {
+    if (limit.rate < 0) {
+        throw invalid_argument("The rate of a rate limit must not be negative.");
+    }
+    if (limit.rate > 0) {
+        interval = (boost::uint64_t) (1e9 / limit.rate);
+        const unsigned int burst =
+                limit.burst > 0 ?
+                        limit.burst :
+                        max(1u, (unsigned int) ceil(limit.rate));
+        tolerance = interval * (burst - 1);
+    }
+}
+
+const RateLimit& RateLimiter::getLimit() const {
+    return limit;
+}
+
+bool RateLimiter::accept() {
+
+    if (limit.sampling > 1
+            && samplingCounter.fetch_add(1, boost::memory_order_relaxed)
+                    % limit.sampling != 0) {
+        return false;
+    }
+
+    if (limit.rate <= 0) {
+        return true;
+    }
+
+    const boost::uint64_t now = rsc::misc::monotonicNanos();
+    boost::uint64_t expected = nextArrival.load(boost::memory_order_relaxed);
+    while (true) {
+        const boost::uint64_t arrival = max(expected, now);
+        if (arrival - now > tolerance) {
+            return false;
+        }
+        if (nextArrival.compare_exchange_weak(expected, arrival + interval,
+                boost::memory_order_relaxed)) {
+            return true;
+        }
+    }
+
+}
+
+}
+}
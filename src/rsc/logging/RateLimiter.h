@@ -0,0 +1,155 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * Settings for limiting the number of messages a logger emits. Messages can
+ * be sampled, i.e. only every n-th message is kept, and the remaining ones
+ * can be limited by a token bucket with a rate and a burst size. The default
+ * does not limit anything.
+ *
+ * @author jwienke
+ */
+struct RSC_EXPORT RateLimit {
+
+    /**
+     * Creates a limit that lets all messages pass.
+     */
+    RateLimit();
+
+    /**
+     * Creates a new limit.
+     *
+     * @param rate messages per second passing the token bucket, 0 disables
+     *             the token bucket
+     * @param burst number of messages that may pass at once, 0 to use the
+     *              rate rounded up
+     * @param sampling only keep every n-th message, 0 or 1 keep all
+     */
+    explicit RateLimit(const double& rate, const unsigned int& burst = 0,
+            const unsigned int& sampling = 1);
+
+    /**
+     * Messages per second, 0 for no limit.
+     */
+    double rate;
+
+    /**
+     * Size of the token bucket, 0 for the rate rounded up.
+     */
+    unsigned int burst;
+
+    /**
+     * Only every n-th message is kept, 0 or 1 for all.
+     */
+    unsigned int sampling;
+
+    /**
+     * Indicates whether this limit can suppress messages at all.
+     *
+     * @return @c true if messages are sampled or rate-limited
+     */
+    bool isLimited() const;
+
+    bool operator==(const RateLimit& other) const;
+    bool operator!=(const RateLimit& other) const;
+
+};
+
+/**
+ * Decides for each message whether it passes a RateLimit. The token bucket
+ * is implemented as a generic cell rate algorithm on a steady clock, hence
+ * deciding about a message only requires a few atomic operations and never
+ * blocks.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT RateLimiter: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a limiter with a full token bucket.
+     *
+     * @param limit limit to apply
+     * @throw std::invalid_argument negative rate
+     */
+    explicit RateLimiter(const RateLimit& limit);
+
+    /**
+     * Returns the applied limit.
+     *
+     * @return limit
+     */
+    const RateLimit& getLimit() const;
+
+    /**
+     * Decides whether a message passes. Can be called from any thread.
+     *
+     * @return @c true if the message shall be logged, @c false if it shall
+     *         be suppressed
+     */
+    bool accept();
+
+private:
+
+    const RateLimit limit;
+
+    /**
+     * Nanoseconds between two messages at the configured rate.
+     */
+    boost::uint64_t interval;
+
+    /**
+     * Nanoseconds by which messages may be early due to the burst size.
+     */
+    boost::uint64_t tolerance;
+
+    /**
+     * Time on the steady clock at which the next message would arrive if
+     * messages were logged exactly at the configured rate.
+     */
+    boost::atomic<boost::uint64_t> nextArrival;
+
+    boost::atomic<boost::uint64_t> samplingCounter;
+
+};
+
+typedef boost::shared_ptr<RateLimiter> RateLimiterPtr;
+
+}
+}
@@ -0,0 +1,60 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "StreamLogRecordSink.h"
+
+using namespace std;
+
+namespace rsc {
+namespace logging {
+
+StreamLogRecordSink::StreamLogRecordSink(ostream& stream) :
+        stream(stream) {
+}
+
+StreamLogRecordSink::~StreamLogRecordSink() {
+}
+
+void StreamLogRecordSink::write(const vector<LogRecord>& records) {
+    for (vector<LogRecord>::const_iterator it = records.begin();
+            it != records.end(); ++it) {
+        format(stream, *it);
+    }
+}
+
+void StreamLogRecordSink::flush() {
+    stream.flush();
+}
+
+ostream& StreamLogRecordSink::format(ostream& stream, const LogRecord& record) {
+    stream << record.timestamp << " " << *record.loggerName << " ["
+            << record.level << "]: ";
+    return record.formatMessage(stream) << '\n';
+}
+
+}
+}
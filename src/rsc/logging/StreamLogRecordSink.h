@@ -0,0 +1,76 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <ostream>
+
+#include "AsyncLogWriter.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace logging {
+
+/**
+ * A LogRecordSink writing records to an std::ostream in the same layout as
+ * ConsoleLogger.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT StreamLogRecordSink: public LogRecordSink {
+public:
+
+    /**
+     * Creates a new sink writing to the given stream. The stream must
+     * outlive the sink.
+     *
+     * @param stream stream to write to
+     */
+    explicit StreamLogRecordSink(std::ostream& stream);
+    virtual ~StreamLogRecordSink();
+
+    void write(const std::vector<LogRecord>& records);
+    void flush();
+
+    /**
+     * Formats a single record as a line of text including the terminating
+     * newline.
+     *
+     * @param stream stream to format the record on
+     * @param record the record to format
+     * @return the stream passed in
+     */
+    static std::ostream& format(std::ostream& stream, const LogRecord& record);
+
+private:
+
+    std::ostream& stream;
+
+};
+
+}
+}
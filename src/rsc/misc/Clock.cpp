@@ -0,0 +1,183 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "Clock.h"
+
+#include <time.h>
+
+#include <boost/chrono.hpp>
+#include <boost/thread/once.hpp>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define RSC_HAVE_TSC
+#include <cpuid.h>
+#endif
+
+#include "langutils.h"
+
+namespace rsc {
+namespace misc {
+
+namespace {
+
+#if defined(CLOCK_REALTIME_COARSE)
+const clockid_t COARSE_REALTIME = CLOCK_REALTIME_COARSE;
+#elif defined(CLOCK_REALTIME) && !defined(WIN32)
+const clockid_t COARSE_REALTIME = CLOCK_REALTIME;
+#endif
+
+#if defined(CLOCK_MONOTONIC_COARSE)
+const clockid_t COARSE_MONOTONIC = CLOCK_MONOTONIC_COARSE;
+#elif defined(CLOCK_MONOTONIC) && !defined(WIN32)
+const clockid_t COARSE_MONOTONIC = CLOCK_MONOTONIC;
+#endif
+
+#if defined(CLOCK_MONOTONIC) && !defined(WIN32)
+#define RSC_HAVE_CLOCK_GETTIME
+boost::uint64_t clockNanos(const clockid_t& clock) {
+    timespec time;
+    clock_gettime(clock, &time);
+    return ((boost::uint64_t) time.tv_sec) * 1000000000ull + time.tv_nsec;
+}
+#endif
+
+#ifdef RSC_HAVE_TSC
+
+inline boost::uint64_t readTsc() {
+    boost::uint32_t low, high;
+    __asm__ __volatile__ ("rdtsc" : "=a" (low), "=d" (high));
+    return ((boost::uint64_t) high << 32) | low;
+}
+
+/**
+ * Checks for a time stamp counter with a constant rate in all power states.
+ */
+bool hasInvariantTsc() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) || eax < 0x80000007) {
+        return false;
+    }
+    __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+    return (edx & (1u << 8)) != 0;
+}
+
+#endif
+
+/**
+ * Calibration of the cycle clock, determined once.
+ */
+struct Calibration {
+    bool useTsc;
+    double nanosPerCycle;
+};
+
+Calibration calibration = { false, 1.0 };
+boost::once_flag calibrationFlag = BOOST_ONCE_INIT;
+
+void calibrate() {
+#ifdef RSC_HAVE_TSC
+    if (!hasInvariantTsc()) {
+        return;
+    }
+    // measure the counter against the monotonic clock for a few milliseconds
+    const boost::uint64_t startNanos = monotonicNanos();
+    const boost::uint64_t startCycles = readTsc();
+    boost::uint64_t nanos;
+    do {
+        nanos = monotonicNanos() - startNanos;
+    } while (nanos < 10000000ull);
+    const boost::uint64_t cycles = readTsc() - startCycles;
+    if (cycles > 0) {
+        calibration.nanosPerCycle = (double) nanos / (double) cycles;
+        calibration.useTsc = true;
+    }
+#endif
+}
+
+const Calibration& getCalibration() {
+    boost::call_once(calibrationFlag, &calibrate);
+    return calibration;
+}
+
+}
+
+boost::uint64_t coarseTimeMillis() {
+#ifdef RSC_HAVE_CLOCK_GETTIME
+    return clockNanos(COARSE_REALTIME) / 1000000ull;
+#else
+    return currentTimeMillis();
+#endif
+}
+
+boost::uint64_t monotonicNanos() {
+#ifdef RSC_HAVE_CLOCK_GETTIME
+    return clockNanos(CLOCK_MONOTONIC);
+#else
+    return boost::chrono::duration_cast<boost::chrono::nanoseconds>(
+            boost::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+boost::uint64_t monotonicMicros() {
+    return monotonicNanos() / 1000ull;
+}
+
+boost::uint64_t coarseMonotonicMillis() {
+#ifdef RSC_HAVE_CLOCK_GETTIME
+    return clockNanos(COARSE_MONOTONIC) / 1000000ull;
+#else
+    return monotonicNanos() / 1000000ull;
+#endif
+}
+
+boost::uint64_t CycleClock::now() {
+#ifdef RSC_HAVE_TSC
+    if (getCalibration().useTsc) {
+        return readTsc();
+    }
+#endif
+    return monotonicNanos();
+}
+
+boost::uint64_t CycleClock::toNanos(const boost::uint64_t& cycles) {
+    const Calibration& current = getCalibration();
+    if (!current.useTsc) {
+        return cycles;
+    }
+    return (boost::uint64_t) ((double) cycles * current.nanosPerCycle);
+}
+
+double CycleClock::getNanosPerCycle() {
+    return getCalibration().nanosPerCycle;
+}
+
+bool CycleClock::isCycleCounterUsed() {
+    return getCalibration().useTsc;
+}
+
+}
+}
@@ -0,0 +1,127 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <boost/cstdint.hpp>
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace misc {
+
+/**
+ * Returns the system time in milliseconds with the resolution of the
+ * operating system's scheduler tick, usually 1 to 4 ms. On Linux this uses
+ * @c CLOCK_REALTIME_COARSE, which is served from the vDSO without a system
+ * call or reading a hardware clock, hence it is considerably cheaper than
+ * #currentTimeMillis. Other platforms fall back to #currentTimeMillis.
+ *
+ * Use this for timestamps which do not require a higher precision, e.g. for
+ * log messages.
+ *
+ * @return system time in milliseconds since the epoch
+ */
+RSC_EXPORT boost::uint64_t coarseTimeMillis();
+
+/**
+ * Returns the time of a monotonic clock in nanoseconds. The clock is not
+ * affected by changes of the system time, but its origin is unspecified.
+ * Hence, it can only be used to measure durations and for deadlines.
+ *
+ * @return monotonic time in nanoseconds
+ */
+RSC_EXPORT boost::uint64_t monotonicNanos();
+
+/**
+ * Returns the time of a monotonic clock in microseconds.
+ *
+ * @return monotonic time in microseconds
+ * @see monotonicNanos
+ */
+RSC_EXPORT boost::uint64_t monotonicMicros();
+
+/**
+ * Returns the time of a monotonic clock in milliseconds with the resolution
+ * of the scheduler tick. On Linux this uses @c CLOCK_MONOTONIC_COARSE.
+ *
+ * @return monotonic time in milliseconds
+ * @see monotonicNanos
+ */
+RSC_EXPORT boost::uint64_t coarseMonotonicMillis();
+
+/**
+ * A clock counting CPU cycles for measuring short durations with minimal
+ * overhead. On x86 processors with an invariant time stamp counter, the
+ * counter is read directly and converted to nanoseconds with a factor which
+ * is calibrated against #monotonicNanos on first use. Otherwise the clock
+ * falls back to #monotonicNanos, i.e. one cycle is one nanosecond.
+ *
+ * Cycle values are only comparable within one process.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT CycleClock {
+public:
+
+    /**
+     * Returns the current cycle count.
+     *
+     * @return cycle count
+     */
+    static boost::uint64_t now();
+
+    /**
+     * Converts a number of cycles to nanoseconds.
+     *
+     * @param cycles number of cycles, usually the difference of two values
+     *               returned by #now
+     * @return duration in nanoseconds
+     */
+    static boost::uint64_t toNanos(const boost::uint64_t& cycles);
+
+    /**
+     * Returns the calibrated duration of one cycle.
+     *
+     * @return nanoseconds per cycle
+     */
+    static double getNanosPerCycle();
+
+    /**
+     * Indicates whether the time stamp counter of the processor is used.
+     *
+     * @return @c true if cycles are counted by the processor, @c false if
+     *         the clock falls back to #monotonicNanos
+     */
+    static bool isCycleCounterUsed();
+
+private:
+    CycleClock();
+};
+
+}
+}
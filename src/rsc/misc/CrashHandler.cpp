@@ -0,0 +1,290 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "CrashHandler.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/atomic.hpp>
+#include <boost/format.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+namespace rsc {
+namespace misc {
+
+namespace {
+
+struct CallbackSlot {
+    CrashCallback callback;
+    void* context;
+};
+
+/**
+ * Registered callbacks. Only modified while holding callbacksMutex, but read
+ * without locking by the signal handler.
+ */
+volatile CallbackSlot callbacks[MAX_CRASH_CALLBACKS];
+
+/**
+ * Intentionally leaked so that callbacks can still be removed by objects
+ * destructed after static destruction started.
+ */
+boost::mutex& callbacksMutex() {
+    static boost::mutex* mutex = new boost::mutex;
+    return *mutex;
+}
+
+bool handlersInstalled = false;
+
+/**
+ * Set by the first thread entering the handler. Lock-free, hence usable in
+ * the handler.
+ */
+boost::atomic<bool> crashing(false);
+
+const int FATAL_SIGNALS[] = { SIGSEGV, SIGILL, SIGFPE, SIGABRT,
+#ifdef SIGBUS
+        SIGBUS,
+#endif
+        };
+
+const unsigned int NUM_FATAL_SIGNALS = sizeof(FATAL_SIGNALS) / sizeof(int);
+
+void invokeCallbacks(int signal) {
+    // a concurrent crash in a different thread must not run the callbacks
+    // again, a fatal signal in a callback terminates the process since the
+    // signal is blocked
+    bool expected = false;
+    if (!crashing.compare_exchange_strong(expected, true)) {
+        return;
+    }
+    for (unsigned int i = 0; i < MAX_CRASH_CALLBACKS; ++i) {
+        CrashCallback callback = callbacks[i].callback;
+        if (callback) {
+            callback(signal, callbacks[i].context);
+        }
+    }
+}
+
+#ifdef WIN32
+
+void crashHandler(int signal) {
+
+    invokeCallbacks(signal);
+
+    // terminate the process with the default action
+    ::signal(signal, SIG_DFL);
+    raise(signal);
+
+}
+
+#else
+
+/**
+ * Handlers installed before ours, indexed like FATAL_SIGNALS.
+ */
+struct sigaction previousActions[NUM_FATAL_SIGNALS];
+
+/**
+ * Alternate signal stack of a thread allocated by installCrashStack.
+ */
+struct AlternateStack {
+
+    AlternateStack() :
+            memory(0) {
+    }
+
+    ~AlternateStack() {
+        if (memory) {
+            stack_t disabled;
+            memset(&disabled, 0, sizeof(disabled));
+            disabled.ss_flags = SS_DISABLE;
+            sigaltstack(&disabled, 0);
+            delete[] memory;
+        }
+    }
+
+    /**
+     * @c NULL if the thread already had an alternate stack.
+     */
+    char* memory;
+
+};
+
+boost::thread_specific_ptr<AlternateStack>& alternateStacks() {
+    static boost::thread_specific_ptr<AlternateStack> stacks;
+    return stacks;
+}
+
+void crashHandler(int signal, siginfo_t* info, void* context) {
+
+    invokeCallbacks(signal);
+
+    // Pass the signal on to the handler which was installed before, so
+    // that e.g. crash reporters still see the original context. The
+    // previous action is restored first, hence a repeated fault reaches
+    // it as well.
+    unsigned int index = 0;
+    while (index < NUM_FATAL_SIGNALS && FATAL_SIGNALS[index] != signal) {
+        ++index;
+    }
+    if (index == NUM_FATAL_SIGNALS) {
+        return;
+    }
+    const struct sigaction& previous = previousActions[index];
+    sigaction(signal, &previous, 0);
+    if ((previous.sa_flags & SA_SIGINFO) && previous.sa_sigaction) {
+        previous.sa_sigaction(signal, info, context);
+        return;
+    }
+    if (!(previous.sa_flags & SA_SIGINFO) && previous.sa_handler != SIG_DFL
+            && previous.sa_handler != SIG_IGN) {
+        previous.sa_handler(signal);
+        return;
+    }
+
+    // The signal is blocked until the handler returns, hence the process is
+    // terminated with the default action afterwards, e.g. with a core dump.
+    struct sigaction defaultAction;
+    memset(&defaultAction, 0, sizeof(defaultAction));
+    defaultAction.sa_handler = SIG_DFL;
+    sigemptyset(&defaultAction.sa_mask);
+    sigaction(signal, &defaultAction, 0);
+    raise(signal);
+
+}
+
+#endif
+
+void installHandlers() {
+    for (unsigned int i = 0; i < NUM_FATAL_SIGNALS; ++i) {
+#ifdef WIN32
+        if (::signal(FATAL_SIGNALS[i], &crashHandler) == SIG_ERR) {
+            throw std::runtime_error(
+                    boost::str(
+                            boost::format("Failed to install handler for signal %1%")
+                                    % FATAL_SIGNALS[i]));
+        }
+#else
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = &crashHandler;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        if (sigaction(FATAL_SIGNALS[i], &action, &previousActions[i]) != 0) {
+            throw std::runtime_error(
+                    boost::str(
+                            boost::format("Failed to install handler for signal %1%: %2%")
+                                    % FATAL_SIGNALS[i] % strerror(errno)));
+        }
+#endif
+    }
+}
+
+}
+
+void installCrashStack() {
+#ifndef WIN32
+    if (alternateStacks().get()) {
+        return;
+    }
+
+    // keep an alternate stack installed by the application
+    stack_t current;
+    if (sigaltstack(0, &current) == 0 && !(current.ss_flags & SS_DISABLE)) {
+        alternateStacks().reset(new AlternateStack);
+        return;
+    }
+
+    const std::size_t size = std::max<std::size_t>(SIGSTKSZ, 64 * 1024);
+    AlternateStack* stack = new AlternateStack;
+    stack->memory = new char[size];
+    stack_t alternate;
+    memset(&alternate, 0, sizeof(alternate));
+    alternate.ss_sp = stack->memory;
+    alternate.ss_size = size;
+    if (sigaltstack(&alternate, 0) != 0) {
+        const int error = errno;
+        delete[] stack->memory;
+        stack->memory = 0;
+        delete stack;
+        throw std::runtime_error(
+                boost::str(
+                        boost::format("Failed to install alternate signal stack: %1%")
+                                % strerror(error)));
+    }
+    alternateStacks().reset(stack);
+#endif
+}
+
+void addCrashCallback(CrashCallback callback, void* context) {
+    boost::mutex::scoped_lock lock(callbacksMutex());
+
+    volatile CallbackSlot* free = 0;
+    for (unsigned int i = 0; i < MAX_CRASH_CALLBACKS; ++i) {
+        if (callbacks[i].callback == callback
+                && callbacks[i].context == context) {
+            return;
+        }
+        if (!free && !callbacks[i].callback) {
+            free = &callbacks[i];
+        }
+    }
+    if (!free) {
+        throw std::runtime_error("Too many crash callbacks registered.");
+    }
+
+    if (!handlersInstalled) {
+        installHandlers();
+        handlersInstalled = true;
+    }
+    installCrashStack();
+
+    // the context has to be visible before the callback can be invoked
+    free->context = context;
+    free->callback = callback;
+}
+
+void removeCrashCallback(CrashCallback callback, void* context) {
+    boost::mutex::scoped_lock lock(callbacksMutex());
+    for (unsigned int i = 0; i < MAX_CRASH_CALLBACKS; ++i) {
+        if (callbacks[i].callback == callback
+                && callbacks[i].context == context) {
+            callbacks[i].callback = 0;
+            callbacks[i].context = 0;
+        }
+    }
+}
+
+}
+}
@@ -0,0 +1,104 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace misc {
+
+/**
+ * Function invoked when the process received a fatal signal.
+ *
+ * @param signal number of the received signal
+ * @param context pointer passed to #addCrashCallback
+ */
+typedef void (*CrashCallback)(int signal, void* context);
+
+/**
+ * Maximum number of callbacks which can be registered at the same time.
+ */
+const unsigned int MAX_CRASH_CALLBACKS = 8;
+
+/**
+ * Registers a function which is invoked in the signal handler when the
+ * process is about to be terminated by a fatal signal, i.e. @c SIGSEGV,
+ * @c SIGBUS, @c SIGILL, @c SIGFPE or @c SIGABRT. The handlers are installed
+ * with the first registration. After all callbacks have been invoked, the
+ * handlers which were installed before, e.g. by crash reporters, are
+ * restored and invoked with the original signal information. Without such
+ * handlers the default action of the signal is restored and the signal is
+ * raised again, so that the process terminates as it would have done without
+ * the callbacks, e.g. with a core dump.
+ *
+ * Callbacks run in signal context with a possibly corrupted process state.
+ * They must only use async-signal-safe functions and should do as little as
+ * possible. They run on an alternate signal stack in threads which called
+ * #installCrashStack, including the registering thread, so that they also
+ * run after a stack overflow. Callbacks are invoked at most once, even if
+ * several threads crash at the same time. If a fatal signal arrives while
+ * callbacks are executed in the same thread, the process terminates
+ * immediately.
+ *
+ * Registering the same callback and context twice has no effect.
+ *
+ * @param callback function to invoke
+ * @param context arbitrary pointer passed to the callback
+ * @throw std::runtime_error more than #MAX_CRASH_CALLBACKS callbacks or the
+ *                           signal handlers cannot be installed
+ *
+ * @author jwienke
+ */
+RSC_EXPORT void addCrashCallback(CrashCallback callback, void* context = 0);
+
+/**
+ * Installs an alternate signal stack for the calling thread, so that crash
+ * callbacks can run when the thread crashes because of a stack overflow.
+ * Does nothing if the thread already has an alternate stack. A stack
+ * installed by this function is released when the thread terminates. Not
+ * supported on Windows, where this function does nothing.
+ *
+ * @throw std::runtime_error the stack cannot be installed
+ *
+ * @author jwienke
+ */
+RSC_EXPORT void installCrashStack();
+
+/**
+ * Removes a callback registered with #addCrashCallback. The signal handlers
+ * stay installed.
+ *
+ * @param callback function to remove
+ * @param context context the function was registered with
+ *
+ * @author jwienke
+ */
+RSC_EXPORT void removeCrashCallback(CrashCallback callback, void* context = 0);
+
+}
+}
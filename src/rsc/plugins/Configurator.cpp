@@ -26,6 +26,7 @@
 
 #include "Configurator.h"
 
+#include <boost/bind.hpp>
 #include <boost/format.hpp>
 
 #include <boost/tokenizer.hpp>
@@ -53,6 +54,8 @@ Configurator::Configurator(ManagerPtr                             manager,
       defaultPath(defaultPath) {
     // Gets interpreted as default path entries in execute().
     this->path.push_back("");
+
+    declareOptions(this->schema);
 }
 
 Configurator::~Configurator() {
@@ -67,26 +70,38 @@ void Configurator::handleOption(const vector<string>& key,
                                 const string& value) {
     RSCDEBUG(this->logger, "Processing option " << key << " = `" << value << "'");
 
-    // Ignore other options.
-    if (!((key.size() == 3)
-          && (key[0] == "plugins")
-          && (key[1] == "cpp"))) {
-        return;
-    }
+    this->schema.handleOption(key, value);
+}
 
-    // Process plugins.cpp.{path,load} options.
-    if (key[2] == "path") {
-        this->path = config::mergeSequenceValue("plugin load path",
-                                                key, value, this->path);
-    } else if (key[2] == "load") {
-        this->load = config::mergeSequenceValue("list of plugins to load",
-                                                key, value, this->load);
-    } else {
-        throw invalid_argument(str(format("Invalid option key `%1%'; plugin related option keys are `path' and `load'.")
-                                   % boost::io::group(std::container_none,
-                                                      std::element_sequence(".", ""),
-                                                      key)));
-    }
+void Configurator::declareOptions(config::OptionSchema& schema) {
+    // Process plugins.cpp.{path,load} options and ignore other
+    // options.
+    schema.addOption<string>(this, "plugins.cpp.path",
+                             boost::bind(&Configurator::handlePath, this, _1, _2));
+    schema.addOption<string>(this, "plugins.cpp.load",
+                             boost::bind(&Configurator::handleLoad, this, _1, _2));
+    schema.addOption<string>(this, "plugins.cpp.*",
+                             boost::bind(&Configurator::handleInvalid, this, _1, _2));
+}
+
+void Configurator::handlePath(const vector<string>& key,
+                              const string& value) {
+    this->path = config::mergeSequenceValue("plugin load path",
+                                            key, value, this->path);
+}
+
+void Configurator::handleLoad(const vector<string>& key,
+                              const string& value) {
+    this->load = config::mergeSequenceValue("list of plugins to load",
+                                            key, value, this->load);
+}
+
+void Configurator::handleInvalid(const vector<string>& key,
+                                 const string& /*value*/) {
+    throw invalid_argument(str(format("Invalid option key `%1%'; plugin related option keys are `path' and `load'.")
+                               % boost::io::group(std::container_none,
+                                                  std::element_sequence(".", ""),
+                                                  key)));
 }
 
 void Configurator::addDefaultPath() {
@@ -29,7 +29,10 @@
 #include <string>
 #include <vector>
 
+#include <boost/noncopyable.hpp>
+
 #include "../config/OptionHandler.h"
+#include "../config/OptionSchema.h"
 #include "../logging/Logger.h"
 
 #include "Manager.h"
@@ -45,7 +48,8 @@ namespace plugins {
  *
  * @author jmoringe
  */
-class RSC_EXPORT Configurator : public config::OptionHandler {
+class RSC_EXPORT Configurator : public config::OptionHandler,
+                                private boost::noncopyable {
 public:
     /**
      * Constructs a @c Configurator with default plugin search path @a
@@ -64,6 +68,15 @@ public:
     void handleOption(const std::vector<std::string>& key,
                       const std::string& value);
 
+    /**
+     * Declares the options processed by this configurator, allowing it
+     * to be configured together with other consumers of a shared
+     * schema.
+     *
+     * @param schema The schema to which the options should be added.
+     */
+    void declareOptions(config::OptionSchema& schema);
+
     /**
      * Performs the actual loading of plugins. Potential errors are reported via
      * exceptions here.
@@ -86,6 +99,15 @@ private:
     std::vector<std::string>             path;
     std::vector<std::string>             load;
 
+    config::OptionSchema                 schema;
+
+    void handlePath(const std::vector<std::string>& key,
+                    const std::string& value);
+    void handleLoad(const std::vector<std::string>& key,
+                    const std::string& value);
+    void handleInvalid(const std::vector<std::string>& key,
+                       const std::string& value);
+
     void addDefaultPath();
 
     void addPathEntries(const std::vector<std::string>& entries);
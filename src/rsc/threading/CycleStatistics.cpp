@@ -0,0 +1,173 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "CycleStatistics.h"
+
+namespace rsc {
+namespace threading {
+
+const unsigned int CycleStatistics::SUB_BUCKET_BITS;
+const unsigned int CycleStatistics::MAX_EXPONENT;
+const unsigned int CycleStatistics::NUM_BUCKETS;
+
+CycleStatistics::CycleStatistics() :
+        sequence(0), count(0), last(0), min(0), max(0), mean(0), m2(0) {
+    for (unsigned int i = 0; i < NUM_BUCKETS; ++i) {
+        buckets[i] = 0;
+    }
+}
+
+void CycleStatistics::record(const boost::uint64_t& durationNs) {
+
+    const boost::uint64_t seq = sequence.load(boost::memory_order_relaxed);
+    sequence.store(seq + 1, boost::memory_order_relaxed);
+    boost::atomic_thread_fence(boost::memory_order_release);
+
+    // Welford's online algorithm
+    ++count;
+    last = durationNs;
+    if (count == 1 || durationNs < min) {
+        min = durationNs;
+    }
+    if (durationNs > max) {
+        max = durationNs;
+    }
+    const double delta = (double) durationNs - mean;
+    mean += delta / (double) count;
+    m2 += delta * ((double) durationNs - mean);
+
+    sequence.store(seq + 2, boost::memory_order_release);
+
+    // single writer, so no read-modify-write operation is required
+    boost::atomic<boost::uint64_t>& bucket = buckets[getBucketIndex(
+            durationNs)];
+    bucket.store(bucket.load(boost::memory_order_relaxed) + 1,
+            boost::memory_order_relaxed);
+
+}
+
+CycleStatistics::Summary CycleStatistics::getSummary() const {
+
+    Summary summary;
+    boost::uint64_t before;
+    boost::uint64_t after;
+    double m2Copy;
+    do {
+        before = sequence.load(boost::memory_order_acquire);
+        summary.count = count;
+        summary.last = last;
+        summary.min = min;
+        summary.max = max;
+        summary.mean = mean;
+        m2Copy = m2;
+        boost::atomic_thread_fence(boost::memory_order_acquire);
+        after = sequence.load(boost::memory_order_relaxed);
+    } while ((before & 1) != 0 || before != after);
+
+    summary.variance = summary.count > 0 ? m2Copy / (double) summary.count : 0;
+    return summary;
+
+}
+
+std::vector<boost::uint64_t> CycleStatistics::getHistogram() const {
+    std::vector<boost::uint64_t> histogram(NUM_BUCKETS);
+    for (unsigned int i = 0; i < NUM_BUCKETS; ++i) {
+        histogram[i] = buckets[i].load(boost::memory_order_relaxed);
+    }
+    return histogram;
+}
+
+boost::uint64_t CycleStatistics::getPercentile(const double& percentile) const {
+
+    const std::vector<boost::uint64_t> histogram = getHistogram();
+    boost::uint64_t total = 0;
+    for (unsigned int i = 0; i < NUM_BUCKETS; ++i) {
+        total += histogram[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    double rank = percentile / 100.0 * (double) total;
+    if (rank < 1) {
+        rank = 1;
+    }
+    const boost::uint64_t maximum = getSummary().max;
+    boost::uint64_t seen = 0;
+    for (unsigned int i = 0; i < NUM_BUCKETS; ++i) {
+        seen += histogram[i];
+        if ((double) seen >= rank) {
+            const boost::uint64_t upper = getBucketUpperBound(i);
+            return upper < maximum ? upper : maximum;
+        }
+    }
+    return maximum;
+
+}
+
+unsigned int CycleStatistics::getBucketIndex(const boost::uint64_t& value) {
+
+    if (value < (1u << SUB_BUCKET_BITS)) {
+        return (unsigned int) value;
+    }
+
+    unsigned int exponent = SUB_BUCKET_BITS;
+    while (exponent < MAX_EXPONENT && (value >> (exponent + 1)) != 0) {
+        ++exponent;
+    }
+    if (exponent >= MAX_EXPONENT) {
+        return NUM_BUCKETS - 1;
+    }
+
+    const unsigned int subBucket = (unsigned int) (value
+            >> (exponent - SUB_BUCKET_BITS)) & ((1u << SUB_BUCKET_BITS) - 1);
+    return ((exponent - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + subBucket;
+
+}
+
+boost::uint64_t CycleStatistics::getBucketLowerBound(
+        const unsigned int& index) {
+    const unsigned int range = index >> SUB_BUCKET_BITS;
+    const boost::uint64_t subBucket = index & ((1u << SUB_BUCKET_BITS) - 1);
+    if (range == 0) {
+        return subBucket;
+    }
+    const unsigned int exponent = range + SUB_BUCKET_BITS - 1;
+    return (((boost::uint64_t) 1) << exponent)
+            + (subBucket << (exponent - SUB_BUCKET_BITS));
+}
+
+boost::uint64_t CycleStatistics::getBucketUpperBound(
+        const unsigned int& index) {
+    if (index >= NUM_BUCKETS - 1) {
+        return ~((boost::uint64_t) 0);
+    }
+    return getBucketLowerBound(index + 1) - 1;
+}
+
+}
+}
@@ -0,0 +1,189 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <vector>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace threading {
+
+/**
+ * Statistics about the durations of repeated operations, e.g. the cycles of
+ * a RepetitiveTask. Maintains the last, minimum, maximum and mean duration,
+ * the variance and a histogram of all durations.
+ *
+ * The histogram uses log-linear buckets in the style of HDR histograms: each
+ * power of two range is divided into 2^#SUB_BUCKET_BITS equally sized
+ * buckets, so that the relative error of a bucket is bounded independent of
+ * the magnitude of the recorded values. Values of 2^#MAX_EXPONENT ns and
+ * more end up in the last bucket.
+ *
+ * Recording is lock-free and intended to be done by one thread at a time.
+ * All query methods are lock-free as well and can be used from arbitrary
+ * threads concurrently to recording. #getSummary always returns a
+ * consistent view on the scalar values, while the histogram may differ from
+ * it by the values recorded concurrently.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT CycleStatistics: private boost::noncopyable {
+public:
+
+    /**
+     * Number of bits of a value used to select the linear sub-bucket within a
+     * power of two range.
+     */
+    static const unsigned int SUB_BUCKET_BITS = 4;
+
+    /**
+     * Values with this or a greater exponent share the last bucket.
+     */
+    static const unsigned int MAX_EXPONENT = 40;
+
+    /**
+     * Total number of histogram buckets.
+     */
+    static const unsigned int NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS
+            + 1) << SUB_BUCKET_BITS;
+
+    /**
+     * Consistent view on the scalar statistics.
+     *
+     * @author jwienke
+     */
+    struct Summary {
+        /**
+         * Number of recorded durations.
+         */
+        boost::uint64_t count;
+        /**
+         * Duration recorded last in ns.
+         */
+        boost::uint64_t last;
+        /**
+         * Minimum duration in ns, 0 without values.
+         */
+        boost::uint64_t min;
+        /**
+         * Maximum duration in ns.
+         */
+        boost::uint64_t max;
+        /**
+         * Mean duration in ns.
+         */
+        double mean;
+        /**
+         * Population variance of the durations in ns^2.
+         */
+        double variance;
+    };
+
+    CycleStatistics();
+
+    /**
+     * Records a new duration.
+     *
+     * @param durationNs the duration in nanoseconds
+     */
+    void record(const boost::uint64_t& durationNs);
+
+    /**
+     * Returns the scalar statistics.
+     *
+     * @return summary of all recorded durations
+     */
+    Summary getSummary() const;
+
+    /**
+     * Returns the counts of all histogram buckets.
+     *
+     * @return vector of #NUM_BUCKETS counts
+     */
+    std::vector<boost::uint64_t> getHistogram() const;
+
+    /**
+     * Estimates a percentile of the recorded durations from the histogram.
+     * The result is the upper bound of the bucket containing the percentile,
+     * limited to the maximum recorded duration.
+     *
+     * @param percentile percentile in the range [0, 100]
+     * @return estimated duration in ns or 0 without recorded durations
+     */
+    boost::uint64_t getPercentile(const double& percentile) const;
+
+    /**
+     * Returns the histogram bucket of a value.
+     *
+     * @param value value in ns
+     * @return bucket index in [0, #NUM_BUCKETS[
+     */
+    static unsigned int getBucketIndex(const boost::uint64_t& value);
+
+    /**
+     * Returns the smallest value stored in a bucket.
+     *
+     * @param index bucket index
+     * @return lower bound of the bucket in ns
+     */
+    static boost::uint64_t getBucketLowerBound(const unsigned int& index);
+
+    /**
+     * Returns the largest value stored in a bucket.
+     *
+     * @param index bucket index
+     * @return upper bound of the bucket in ns
+     */
+    static boost::uint64_t getBucketUpperBound(const unsigned int& index);
+
+private:
+
+    /**
+     * Sequence counter protecting the scalar values. Odd while they are
+     * modified.
+     */
+    boost::atomic<boost::uint64_t> sequence;
+
+    boost::uint64_t count;
+    boost::uint64_t last;
+    boost::uint64_t min;
+    boost::uint64_t max;
+    double mean;
+    double m2;
+
+    boost::atomic<boost::uint64_t> buckets[NUM_BUCKETS];
+
+};
+
+}
+}
@@ -27,12 +27,22 @@
 #pragma once
 
 #include <stdexcept>
+#include <vector>
 
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
+#include <boost/move/utility.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/format.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/condition.hpp>
+#include <boost/thread/thread_time.hpp>
+#include <boost/utility/result_of.hpp>
 
+#include "SimpleTask.h"
+#include "TaskExecutor.h"
 #include "rsc/rscexports.h"
 
 namespace rsc {
@@ -87,26 +97,109 @@ public:
     explicit FutureTimeoutException(const std::string& message);
 };
 
+template<class R, class T, class F>
+class FutureContinuationTask;
+
 /**
  * Class providing access to the result of a process that is asynchronously
  * running. If the result is requested before the task finished, the ::get
  * operation will block until a results or error is available.
  *
+ * Instead of blocking, callbacks (#addCallback) and continuations (#then)
+ * can be attached which are invoked once the future is done. Multiple futures
+ * can be combined using ::whenAll and ::whenAny.
+ *
+ * The completion state is maintained atomically so that #isDone and
+ * accessing an available result do not require locking.
+ *
  * @author jwienke
  * @tparam R result type, should be copyable but this is not a hard requirement
  */
 template<class R>
-class Future {
+class Future: public boost::enable_shared_from_this<Future<R> > {
 protected:
     typedef boost::mutex MutexType;
     typedef boost::condition ConditionType;
+public:
+
+    /**
+     * Callback invoked with the future once it is done.
+     */
+    typedef boost::function<void(Future<R>&)> Callback;
+
 private:
+
+    enum State {
+        PENDING, SUCCEEDED, FAILED
+    };
+
     R result;
-    bool taskFinished;
-    bool taskError;
+    boost::atomic<int> state;
     std::string errorMsg;
     ConditionType condition;
     MutexType mutex;
+    std::vector<Callback> callbacks;
+
+    void waitDone(const double& timeout) {
+
+        if (isDone()) {
+            return;
+        }
+
+        const boost::system_time deadline = boost::get_system_time()
+                + boost::posix_time::microseconds(long(timeout * 1000000));
+        MutexType::scoped_lock lock(mutex);
+        while (!isDone()) {
+            if (timeout <= 0) {
+                condition.wait(lock);
+            } else if (!condition.timed_wait(lock, deadline)) {
+                throw FutureTimeoutException(
+                        boost::str(
+                                boost::format(
+                                        "Timeout while waiting for result. Waited %1% seconds.")
+                                        % timeout));
+            }
+        }
+
+    }
+
+    void complete(const State& finalState) {
+
+        std::vector<Callback> toCall;
+        {
+            MutexType::scoped_lock lock(mutex);
+            state.store(finalState, boost::memory_order_release);
+            toCall.swap(callbacks);
+            condition.notify_all();
+        }
+
+        for (typename std::vector<Callback>::iterator it = toCall.begin();
+                it != toCall.end(); ++it) {
+            (*it)(*this);
+        }
+
+    }
+
+    template<class T, class F>
+    static void dispatchContinuation(Future<R>& source,
+            TaskExecutorPtr executor, F continuation,
+            boost::shared_ptr<Future<T> > next) {
+        TaskPtr task(
+                new FutureContinuationTask<R, T, F>(source.shared_from_this(),
+                        continuation, next));
+        if (!executor) {
+            task->run();
+            return;
+        }
+        try {
+            executor->schedule(task);
+        } catch (const std::exception& e) {
+            next->setError(
+                    std::string("Unable to schedule continuation: ")
+                            + e.what());
+        }
+    }
+
 public:
 
     /**
@@ -114,7 +207,10 @@ public:
      * thus suitable for representing an in-progress computation.
      */
     Future() :
-            taskFinished(false), taskError(false) {
+            state(PENDING) {
+    }
+
+    virtual ~Future() {
     }
 
     /**
@@ -151,45 +247,59 @@ public:
      *                               @a timeout.
      */
     R get(double timeout) {
-        MutexType::scoped_lock lock(mutex);
-        while (!taskFinished) {
-            if (timeout <= 0) {
-                condition.wait(lock);
-            } else {
-#if BOOST_VERSION >= 105000
-                if (!condition.timed_wait(lock, boost::posix_time::microseconds(long(timeout) * 1000000))) {
-#else
-                boost::xtime xt;
-                boost::xtime_get(&xt, boost::TIME_UTC);
-                xt.sec += timeout;
-                if (!condition.timed_wait(lock, xt)) {
-#endif
-                    throw FutureTimeoutException(
-                            boost::str(
-                                    boost::format(
-                                            "Timeout while waiting for result. Waited %1% seconds.")
-                                            % timeout));
-                }
-            }
-        }
+        return getReference(timeout);
+    }
 
-        if (taskError) {
+    /**
+     * Like #get but provides access to the stored result without copying it.
+     * The reference stays valid as long as this future exists.
+     *
+     * @param timeout The amount of time in seconds in which the operation has
+     *                to complete. 0 waits endlessly.
+     * @return reference to the result of the operation
+     * @throw FutureTaskExecutionException If the operation represented by the
+     *                                     Future object failed.
+     * @throw FutureTimeoutException If the result does not become available
+     *                               within the specified amount of time
+     */
+    const R& getReference(double timeout = 0) {
+        waitDone(timeout);
+        if (state.load(boost::memory_order_acquire) == FAILED) {
             throw FutureTaskExecutionException(errorMsg);
         }
-
         return result;
     }
 
+    /**
+     * Like #get but moves the result out of the future instead of copying it.
+     * Afterwards the future only contains a moved-from result. Hence, this
+     * method should only be used by the single final consumer of the result.
+     *
+     * @param timeout The amount of time in seconds in which the operation has
+     *                to complete. 0 waits endlessly.
+     * @return the result of the operation
+     * @throw FutureTaskExecutionException If the operation represented by the
+     *                                     Future object failed.
+     * @throw FutureTimeoutException If the result does not become available
+     *                               within the specified amount of time
+     */
+    R take(double timeout = 0) {
+        waitDone(timeout);
+        if (state.load(boost::memory_order_acquire) == FAILED) {
+            throw FutureTaskExecutionException(errorMsg);
+        }
+        return boost::move(result);
+    }
+
     /**
      * Tells whether the computation of the underlying process
-     * finished and provided a result or generated an error.
+     * finished and provided a result or generated an error. Does not block.
      *
      * @return @c true if a result or error is available, else @c
      * false
      */
     bool isDone() {
-        MutexType::scoped_lock lock(mutex);
-        return taskFinished;
+        return state.load(boost::memory_order_acquire) != PENDING;
     }
 
     /**
@@ -198,12 +308,8 @@ public:
      * @param data result data
      */
     void set(R data) {
-        result = data;
-        {
-            MutexType::scoped_lock lock(mutex);
-            taskFinished = true;
-            condition.notify_all();
-        }
+        result = boost::move(data);
+        complete(SUCCEEDED);
     }
 
     /**
@@ -213,13 +319,62 @@ public:
      */
     void setError(const std::string& message) {
         errorMsg = message;
+        complete(FAILED);
+    }
+
+    /**
+     * Registers a callback that is invoked once this future is done, either
+     * with a result or an error. If the future is already done, the callback
+     * is invoked immediately in the calling thread, otherwise in the thread
+     * providing the result. Callbacks must not throw and should not block.
+     *
+     * @param callback callback to invoke
+     */
+    void addCallback(const Callback& callback) {
         {
             MutexType::scoped_lock lock(mutex);
-            taskFinished = true;
-            taskError = true;
+            if (!isDone()) {
+                callbacks.push_back(callback);
+                return;
+            }
         }
-        condition.notify_all();
+        callback(*this);
     }
+
+    /**
+     * Creates a future for the result of applying a continuation to the
+     * result of this future once it is available. No thread is blocked while
+     * waiting for this future.
+     *
+     * If this future fails, the returned one fails with the same error
+     * message without invoking the continuation. Exceptions thrown by the
+     * continuation make the returned future fail.
+     *
+     * This future must be owned by a boost::shared_ptr because the
+     * continuation keeps it alive until it has been executed.
+     *
+     * @param executor executor to run the continuation on. If empty, the
+     *                 continuation is executed in the thread completing this
+     *                 future
+     * @param continuation callable receiving a <code>const R&</code>
+     *                     and returning a value
+     * @return future for the result of the continuation
+     * @throw boost::bad_weak_ptr this future is not owned by a shared_ptr
+     * @tparam F type of the continuation
+     */
+    template<class F>
+    boost::shared_ptr<Future<typename boost::result_of<F(const R&)>::type> > then(
+            TaskExecutorPtr executor, F continuation) {
+        typedef typename boost::result_of<F(const R&)>::type T;
+        // fail early instead of in the completing thread
+        this->shared_from_this();
+        boost::shared_ptr<Future<T> > next(new Future<T>);
+        addCallback(
+                boost::bind(&Future<R>::template dispatchContinuation<T, F>,
+                        _1, executor, continuation, next));
+        return next;
+    }
+
 protected:
     MutexType& getMutex() {
         return this->mutex;
@@ -230,5 +385,158 @@ protected:
     }
 };
 
+/**
+ * Task applying a continuation to the result of a Future.
+ *
+ * @author jwienke
+ * @tparam R result type of the source future
+ * @tparam T result type of the continuation
+ * @tparam F type of the continuation
+ */
+template<class R, class T, class F>
+class FutureContinuationTask: public SimpleTask {
+public:
+
+    FutureContinuationTask(boost::shared_ptr<Future<R> > source,
+            F continuation, boost::shared_ptr<Future<T> > next) :
+            source(source), continuation(continuation), next(next) {
+    }
+
+    void run() {
+        if (isCancelRequested()) {
+            next->setError("Continuation canceled before being executed.");
+        } else {
+            try {
+                next->set(continuation(source->getReference()));
+            } catch (const std::exception& e) {
+                next->setError(e.what());
+            } catch (...) {
+                next->setError("Continuation threw an unknown exception.");
+            }
+        }
+        markDone();
+    }
+
+private:
+
+    boost::shared_ptr<Future<R> > source;
+    F continuation;
+    boost::shared_ptr<Future<T> > next;
+
+};
+
+/**
+ * Shared state of ::whenAll.
+ *
+ * @author jwienke
+ */
+template<class R>
+class FutureWhenAllState {
+public:
+
+    explicit FutureWhenAllState(const std::size_t& count) :
+            remaining(count), values(count), failed(false), result(
+                    new Future<std::vector<R> >) {
+    }
+
+    void done(const std::size_t& index, Future<R>& future) {
+        boost::mutex::scoped_lock lock(mutex);
+        if (failed) {
+            return;
+        }
+        try {
+            values[index] = future.getReference();
+        } catch (const FutureException& e) {
+            failed = true;
+            lock.unlock();
+            result->setError(e.what());
+            return;
+        }
+        if (--remaining == 0) {
+            lock.unlock();
+            result->set(boost::move(values));
+        }
+    }
+
+    boost::mutex mutex;
+    std::size_t remaining;
+    std::vector<R> values;
+    bool failed;
+    boost::shared_ptr<Future<std::vector<R> > > result;
+
+};
+
+/**
+ * Shared state of ::whenAny.
+ *
+ * @author jwienke
+ */
+class FutureWhenAnyState {
+public:
+
+    FutureWhenAnyState() :
+            fired(false), result(new Future<std::size_t>) {
+    }
+
+    void done(const std::size_t& index) {
+        if (!fired.exchange(true)) {
+            result->set(index);
+        }
+    }
+
+    boost::atomic<bool> fired;
+    boost::shared_ptr<Future<std::size_t> > result;
+
+};
+
+/**
+ * Creates a future that is done once all given futures are done. It
+ * provides the results of all futures in the order of @a futures. If any of
+ * the futures fails, the combined future fails with the first error.
+ *
+ * @param futures futures to combine
+ * @return combined future
+ * @tparam R result type of the futures
+ */
+template<class R>
+boost::shared_ptr<Future<std::vector<R> > > whenAll(
+        const std::vector<boost::shared_ptr<Future<R> > >& futures) {
+    boost::shared_ptr<FutureWhenAllState<R> > state(
+            new FutureWhenAllState<R>(futures.size()));
+    if (futures.empty()) {
+        state->result->set(std::vector<R>());
+        return state->result;
+    }
+    for (std::size_t i = 0; i < futures.size(); ++i) {
+        futures[i]->addCallback(
+                boost::bind(&FutureWhenAllState<R>::done, state, i, _1));
+    }
+    return state->result;
+}
+
+/**
+ * Creates a future that is done once any of the given futures is done. It
+ * provides the index of the first future that has been done, regardless of
+ * whether this future succeeded or failed.
+ *
+ * @param futures futures to wait for
+ * @return future for the index of the first future done
+ * @throw std::invalid_argument @a futures is empty
+ * @tparam R result type of the futures
+ */
+template<class R>
+boost::shared_ptr<Future<std::size_t> > whenAny(
+        const std::vector<boost::shared_ptr<Future<R> > >& futures) {
+    if (futures.empty()) {
+        throw std::invalid_argument("At least one future is required.");
+    }
+    boost::shared_ptr<FutureWhenAnyState> state(new FutureWhenAnyState);
+    for (std::size_t i = 0; i < futures.size(); ++i) {
+        futures[i]->addCallback(
+                boost::bind(&FutureWhenAnyState::done, state, i));
+    }
+    return state->result;
+}
+
 }
 }
@@ -26,7 +26,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
+#include <boost/lockfree/queue.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/function.hpp>
 #include <boost/thread/mutex.hpp>
@@ -34,6 +40,7 @@
 #include <boost/thread.hpp>
 
 #include "../misc/IllegalStateException.h"
+#include "../misc/langutils.h"
 #include "SynchronizedQueue.h"
 
 namespace rsc {
@@ -54,17 +61,31 @@ namespace threading {
  *    per receiver thread
  *
  * Filtering and delivery of message to receivers are performed by handlers.
- * These handlers should be stateless.
+ * These handlers should be stateless. Instead of a DeliveryHandler a
+ * BatchDeliveryHandler can be used to deliver several queued messages of a
+ * receiver with a single call.
+ *
+ * How worker threads find the next receiver to serve is determined by the
+ * SchedulingMode, see #setSchedulingMode.
  *
  * @author jwienke
  *
  * @tparam M type of the messages dispatched by the pool
  * @tparam R type of the message receiver
+ * @tparam Q type of the per-receiver message queue. Must be default
+ *           constructible and provide the methods @c push, @c pop,
+ *           @c tryPop, @c drain and @c empty of SynchronizedQueue. RingBufferQueue
+ *           can be used to bound the number of queued messages per receiver.
  */
-template<class M, class R>
+template<class M, class R, class Q = SynchronizedQueue<M> >
 class OrderedQueueDispatcherPool {
 public:
 
+    /**
+     * Default for #setMaxBatchSize.
+     */
+    static const unsigned int DEFAULT_MAX_BATCH_SIZE = 64;
+
     /**
      * A function that delivers a message to a receiver. Must be reentrant.
      */
@@ -105,6 +126,35 @@ public:
 
     typedef boost::shared_ptr<DeliveryHandler> DeliveryHandlerPtr;
 
+    /**
+     * A handler that is called with a batch of messages for one receiver
+     * instead of a single message. Batches contain up to #setMaxBatchSize
+     * messages in the order they were pushed and only messages accepted by
+     * the FilterHandler.
+     *
+     * @author jwienke
+     * @note do not use state in this class and make it reentrant
+     */
+    class BatchDeliveryHandler {
+    public:
+
+        virtual ~BatchDeliveryHandler() {
+        }
+
+        /**
+         * Requests this handler to deliver several messages to the receiver.
+         *
+         * @param receiver receiver to pass messages to
+         * @param messages non-empty list of messages to pass to the receiver
+         */
+        virtual void
+        deliver(boost::shared_ptr<R>& receiver,
+                const std::vector<M>& messages) = 0;
+
+    };
+
+    typedef boost::shared_ptr<BatchDeliveryHandler> BatchDeliveryHandlerPtr;
+
     /**
      * A handler that is used to filter messages for a certain receiver.
      *
@@ -132,6 +182,39 @@ public:
 
     typedef boost::shared_ptr<FilterHandler> FilterHandlerPtr;
 
+    /**
+     * Strategies used by the worker threads to find the next receiver with
+     * pending messages.
+     */
+    enum SchedulingMode {
+
+        /**
+         * All workers share a single lock and search the list of receivers
+         * for one with pending messages on each job fetch. This is the
+         * default.
+         */
+        SCHEDULING_SCAN,
+
+        /**
+         * Receivers with pending messages are placed exactly once on a
+         * lock-free queue of ready receivers which is consumed by the
+         * workers. Fetching and finishing a job is then independent of the
+         * number of registered receivers and does not require a global lock.
+         */
+        SCHEDULING_READY_QUEUE,
+
+        /**
+         * Like SCHEDULING_READY_QUEUE, but each worker has its own queue of
+         * ready receivers. A receiver with new messages is put on the queue
+         * of the worker which served it last so that its state stays on one
+         * core. Workers only steal receivers from other workers if their own
+         * queue is empty and only an idle worker is woken up for new
+         * messages.
+         */
+        SCHEDULING_WORK_STEALING
+
+    };
+
 private:
 
     /**
@@ -196,13 +279,14 @@ private:
     public:
 
         Receiver(boost::shared_ptr<R> receiver) :
-            receiver(receiver), processing(false) {
+            receiver(receiver), processing(false), scheduled(false), removed(
+                    false), activeCalls(0), lastWorker(-1) {
         }
 
         boost::shared_ptr<R> receiver;
         // TODO think about if this really requires a synchronized queue if
         // all message dispatching to worker threads is synchronized
-        SynchronizedQueue<M> queue;
+        Q queue;
 
         boost::condition processingCondition;
 
@@ -216,6 +300,72 @@ private:
          */
         volatile bool processing;
 
+        /**
+         * Not used with SCHEDULING_SCAN. Indicates that this receiver is
+         * either on a queue of ready receivers or a worker currently owns
+         * it. Whoever changes this flag from @c false to @c true is
+         * responsible for putting the receiver on the ready queue.
+         */
+        boost::atomic<bool> scheduled;
+
+        /**
+         * Not used with SCHEDULING_SCAN. Set once the receiver has been
+         * unregistered so that workers drop it.
+         */
+        boost::atomic<bool> removed;
+
+        /**
+         * Not used with SCHEDULING_SCAN. Number of workers currently
+         * filtering or delivering a message for this receiver.
+         */
+        boost::atomic<unsigned int> activeCalls;
+
+        /**
+         * Guards waiting on #processingCondition if not using
+         * SCHEDULING_SCAN.
+         */
+        boost::mutex callsMutex;
+
+        /**
+         * Reference held on behalf of the ready queue, which itself only
+         * stores raw pointers. Only accessed by the thread which owns the
+         * #scheduled flag.
+         */
+        boost::shared_ptr<Receiver> self;
+
+        /**
+         * Only used with SCHEDULING_WORK_STEALING. Number of the worker which
+         * served this receiver most recently or -1.
+         */
+        boost::atomic<int> lastWorker;
+
+    };
+
+    /**
+     * Per-worker scheduling state for SCHEDULING_WORK_STEALING.
+     *
+     * @author jwienke
+     */
+    class WorkerState {
+    public:
+
+        WorkerState() :
+            readyReceivers(0), parked(false) {
+        }
+
+        /**
+         * Receivers preferably served by this worker.
+         */
+        boost::lockfree::queue<Receiver*> readyReceivers;
+
+        /**
+         * Indicates that the worker waits on #condition.
+         */
+        boost::atomic<bool> parked;
+
+        boost::mutex mutex;
+        boost::condition condition;
+
     };
 
     // TODO make this a set to only allow unique subscriptions?
@@ -229,8 +379,21 @@ private:
 
     volatile bool parallelCalls;
 
+    volatile unsigned int maxBatchSize;
+    volatile boost::uint32_t maxBatchLatency;
+
     volatile bool started;
 
+    SchedulingMode schedulingMode;
+
+    boost::lockfree::queue<Receiver*> readyReceivers;
+    boost::atomic<unsigned int> idleWorkers;
+    boost::mutex readyMutex;
+    boost::condition readyCondition;
+
+    std::vector<boost::shared_ptr<WorkerState> > workerStates;
+    boost::atomic<unsigned int> nextWorker;
+
     /**
      * Returns the next job to process for worker threads and blocks if there
      * is no job.
@@ -319,16 +482,359 @@ private:
 
     }
 
+    /**
+     * Puts a receiver on the queue of ready receivers and wakes up a worker if
+     * one is waiting. The caller must have changed the scheduled flag of the
+     * receiver from @c false to @c true.
+     *
+     * @param receiver receiver with pending messages
+     */
+    void scheduleReceiver(const boost::shared_ptr<Receiver>& receiver) {
+
+        receiver->self = receiver;
+        if (schedulingMode == SCHEDULING_WORK_STEALING) {
+            stealableReceiver(receiver);
+            return;
+        }
+        readyReceivers.push(receiver.get());
+
+        // pairs with the fence in nextReadyJob so that either the worker sees
+        // the new receiver or we see the worker waiting
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        if (idleWorkers.load() > 0) {
+            boost::mutex::scoped_lock lock(readyMutex);
+            readyCondition.notify_one();
+        }
+
+    }
+
+    /**
+     * #scheduleReceiver for SCHEDULING_WORK_STEALING. Puts the receiver on the
+     * queue of the worker which served it last and wakes up this worker if
+     * it waits. Otherwise, any other waiting worker is woken up to steal the
+     * receiver.
+     *
+     * @param receiver receiver with pending messages
+     */
+    void stealableReceiver(const boost::shared_ptr<Receiver>& receiver) {
+
+        int worker = receiver->lastWorker;
+        if (worker < 0) {
+            worker = nextWorker++ % workerStates.size();
+        }
+        WorkerState& owner = *workerStates[worker];
+        owner.readyReceivers.push(receiver.get());
+
+        // pairs with the fence in nextStealableJob
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        if (owner.parked) {
+            boost::mutex::scoped_lock lock(owner.mutex);
+            owner.condition.notify_one();
+        } else if (idleWorkers.load() > 0) {
+            for (size_t i = 0; i < workerStates.size(); ++i) {
+                WorkerState& thief = *workerStates[(worker + i + 1)
+                        % workerStates.size()];
+                if (thief.parked) {
+                    boost::mutex::scoped_lock lock(thief.mutex);
+                    thief.condition.notify_one();
+                    break;
+                }
+            }
+        }
+
+    }
+
+    /**
+     * Gives up ownership of a receiver obtained through #nextReadyJob and puts
+     * it back on the ready queue if it still has pending messages.
+     *
+     * @param receiver receiver to release
+     */
+    void releaseReceiver(const boost::shared_ptr<Receiver>& receiver) {
+        receiver->scheduled = false;
+        if (!receiver->queue.empty() && !receiver->scheduled.exchange(true)) {
+            scheduleReceiver(receiver);
+        }
+    }
+
+    /**
+     * Removes all receivers from the ready queues and resets their scheduling
+     * state. Only call this if no worker is running.
+     */
+    void clearReadyReceivers() {
+        Receiver* receiver;
+        while (readyReceivers.pop(receiver)
+                || popStealableReceiver(0, receiver)) {
+            receiver->scheduled = false;
+            // might destroy the receiver
+            boost::shared_ptr<Receiver>().swap(receiver->self);
+        }
+    }
+
+    /**
+     * Pops a receiver from the queue of a worker or, if empty, steals one
+     * from the other workers.
+     *
+     * @param workerNum number of the popping worker
+     * @param receiver out param for the popped receiver
+     * @return @c true if a receiver was found
+     */
+    bool popStealableReceiver(const unsigned int& workerNum,
+            Receiver*& receiver) {
+        for (size_t i = 0; i < workerStates.size(); ++i) {
+            if (workerStates[(workerNum + i) % workerStates.size()]->readyReceivers.pop(
+                    receiver)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * #nextReadyJob for SCHEDULING_WORK_STEALING.
+     *
+     * @param workerNum number of the worker requesting a new job
+     * @param receiver out param with the receiver to work on
+     */
+    void nextStealableJob(const unsigned int& workerNum,
+            boost::shared_ptr<Receiver>& receiver) {
+
+        WorkerState& state = *workerStates[workerNum];
+        Receiver* ready;
+        while (true) {
+
+            if (interrupted) {
+                throw InterruptedException("Processing was interrupted");
+            }
+
+            if (popStealableReceiver(workerNum, ready)) {
+                receiver.swap(ready->self);
+                receiver->lastWorker = workerNum;
+                return;
+            }
+
+            boost::mutex::scoped_lock lock(state.mutex);
+            state.parked = true;
+            ++idleWorkers;
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            while (!interrupted && !hasStealableReceivers()) {
+                state.condition.wait(lock);
+            }
+            --idleWorkers;
+            state.parked = false;
+
+        }
+
+    }
+
+    /**
+     * Tells whether any worker has receivers on its queue.
+     *
+     * @return @c true if there is a receiver to steal
+     */
+    bool hasStealableReceivers() const {
+        for (size_t i = 0; i < workerStates.size(); ++i) {
+            if (!workerStates[i]->readyReceivers.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Returns the next receiver with pending messages from the ready queue
+     * and blocks if there is none. The calling worker owns the returned
+     * receiver until it calls #releaseReceiver.
+     *
+     * @param workerNum number of the worker requesting a new job
+     * @param receiver out param with the receiver to work on
+     */
+    void nextReadyJob(const unsigned int& workerNum,
+            boost::shared_ptr<Receiver>& receiver) {
+
+        if (schedulingMode == SCHEDULING_WORK_STEALING) {
+            nextStealableJob(workerNum, receiver);
+            return;
+        }
+
+        Receiver* ready;
+        while (true) {
+
+            if (interrupted) {
+                throw InterruptedException("Processing was interrupted");
+            }
+
+            if (readyReceivers.pop(ready)) {
+                receiver.swap(ready->self);
+                return;
+            }
+
+            boost::mutex::scoped_lock lock(readyMutex);
+            ++idleWorkers;
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+            while (!interrupted && readyReceivers.empty()) {
+                readyCondition.wait(lock);
+            }
+            --idleWorkers;
+
+        }
+
+    }
+
+    /**
+     * Marks the end of a filter and delivery call for a receiver and wakes up
+     * a pending #unregisterReceiver call.
+     *
+     * @param receiver receiver the call was made for
+     */
+    void finishedReadyCall(const boost::shared_ptr<Receiver>& receiver) {
+        --receiver->activeCalls;
+        if (receiver->removed) {
+            boost::mutex::scoped_lock lock(receiver->callsMutex);
+            receiver->processingCondition.notify_all();
+        }
+    }
+
+    /**
+     * Worker loop for all modes except SCHEDULING_SCAN.
+     *
+     * @param workerNum number of the worker
+     */
+    void readyQueueWorker(const unsigned int& workerNum) {
+
+        std::vector<M> batch;
+        try {
+            while (true) {
+
+                boost::shared_ptr<Receiver> receiver;
+                nextReadyJob(workerNum, receiver);
+
+                ++receiver->activeCalls;
+                if (receiver->removed) {
+                    // leave it scheduled so that it never returns to the
+                    // ready queue
+                    finishedReadyCall(receiver);
+                    continue;
+                }
+
+                const bool parallel = parallelCalls;
+                if (batchDeliveryHandler) {
+                    collectBatch(receiver, batch);
+                    if (parallel) {
+                        releaseReceiver(receiver);
+                    }
+                    deliverBatch(receiver, batch);
+                } else {
+                    // owning a scheduled receiver guarantees a pending
+                    // message, which might still be in the process of being
+                    // pushed to a lock-free queue
+                    M message = receiver->queue.pop();
+                    if (parallel) {
+                        releaseReceiver(receiver);
+                    }
+                    if (filterHandler->filter(receiver->receiver, message)) {
+                        deliveryHandler->deliver(receiver->receiver, message);
+                    }
+                }
+                if (!parallel) {
+                    releaseReceiver(receiver);
+                }
+                finishedReadyCall(receiver);
+
+            }
+        } catch (InterruptedException& e) {
+        }
+
+    }
+
+    /**
+     * Pops the next batch of messages for a receiver. The receiver must have
+     * at least one pending message. Afterwards, messages are added until
+     * the maximum batch size is reached or no further message arrives within
+     * the latency bound.
+     *
+     * @param receiver receiver to pop messages from
+     * @param batch out param receiving the messages, must be empty
+     */
+    void collectBatch(const boost::shared_ptr<Receiver>& receiver,
+            std::vector<M>& batch) {
+
+        const unsigned int maxSize = std::max((unsigned int) maxBatchSize, 1u);
+        const boost::uint32_t latency = maxBatchLatency;
+        const boost::uint64_t deadline = rsc::misc::currentTimeMillis()
+                + latency;
+
+        batch.push_back(receiver->queue.pop());
+        while (batch.size() < maxSize) {
+            if (receiver->queue.drain(std::back_inserter(batch),
+                    maxSize - batch.size()) > 0) {
+                continue;
+            }
+            try {
+                const boost::uint64_t now = rsc::misc::currentTimeMillis();
+                if (latency == 0 || now >= deadline) {
+                    break;
+                }
+                batch.push_back(
+                        receiver->queue.pop((boost::uint32_t) (deadline - now)));
+            } catch (QueueEmptyException& e) {
+                // latency bound reached
+                break;
+            }
+        }
+
+    }
+
+    /**
+     * Filters a batch and passes the accepted messages to the
+     * BatchDeliveryHandler.
+     *
+     * @param receiver receiver the batch was collected for
+     * @param batch messages to deliver, cleared afterwards
+     */
+    void deliverBatch(const boost::shared_ptr<Receiver>& receiver,
+            std::vector<M>& batch) {
+
+        size_t accepted = 0;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (filterHandler->filter(receiver->receiver, batch[i])) {
+                if (accepted != i) {
+                    batch[accepted] = batch[i];
+                }
+                ++accepted;
+            }
+        }
+        batch.erase(batch.begin() + accepted, batch.end());
+
+        if (!batch.empty()) {
+            batchDeliveryHandler->deliver(receiver->receiver, batch);
+        }
+        batch.clear();
+
+    }
+
     /**
      * Threaded worker method.
      */
     void worker(const unsigned int& workerNum) {
 
+        if (schedulingMode != SCHEDULING_SCAN) {
+            readyQueueWorker(workerNum);
+            return;
+        }
+
+        std::vector<M> batch;
         try {
             while (true) {
 
                 boost::shared_ptr<Receiver> receiver;
                 nextJob(workerNum, receiver);
+                if (batchDeliveryHandler) {
+                    collectBatch(receiver, batch);
+                    deliverBatch(receiver, batch);
+                    finishedWork(receiver);
+                    continue;
+                }
                 M message = receiver->queue.pop();
                 //                std::cout << "Worker " << workerNum << " got new job: "
                 //                        << message << " for receiver " << *(receiver->receiver)
@@ -349,6 +855,7 @@ private:
     std::vector<boost::shared_ptr<boost::thread> > threadPool;
 
     DeliveryHandlerPtr deliveryHandler;
+    BatchDeliveryHandlerPtr batchDeliveryHandler;
     FilterHandlerPtr filterHandler;
 
 public:
@@ -366,7 +873,10 @@ public:
     OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
             deliverFunction delFunc) :
             currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
-                    false), started(false), threadPoolSize(threadPoolSize), deliveryHandler(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), deliveryHandler(
                     new DeliverFunctionAdapter(delFunc)), filterHandler(
                     new TrueFilter()) {
     }
@@ -386,7 +896,10 @@ public:
     OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
             deliverFunction delFunc, filterFunction filterFunc) :
             currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
-                    false), started(false), threadPoolSize(threadPoolSize), deliveryHandler(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), deliveryHandler(
                     new DeliverFunctionAdapter(delFunc)), filterHandler(
                     new FilterFunctionAdapter(filterFunc)) {
     }
@@ -401,7 +914,10 @@ public:
     OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
             DeliveryHandlerPtr deliveryHandler) :
             currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
-                    false), started(false), threadPoolSize(threadPoolSize), deliveryHandler(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), deliveryHandler(
                     deliveryHandler), filterHandler(new TrueFilter) {
     }
 
@@ -415,12 +931,53 @@ public:
     OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
             DeliveryHandlerPtr deliveryHandler, FilterHandlerPtr filterHandler) :
             currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
-                    false), started(false), threadPoolSize(threadPoolSize), deliveryHandler(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), deliveryHandler(
                     deliveryHandler), filterHandler(filterHandler) {
     }
 
+    /**
+     * Constructs a new pool which delivers messages in batches and accepts
+     * every message.
+     *
+     * @param threadPoolSize number of threads for this pool
+     * @param batchDeliveryHandler handler to deliver batches of messages to
+     *                             receivers
+     */
+    OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
+            BatchDeliveryHandlerPtr batchDeliveryHandler) :
+            currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), batchDeliveryHandler(batchDeliveryHandler), filterHandler(
+                    new TrueFilter) {
+    }
+
+    /**
+     * Constructs a new pool which delivers messages in batches.
+     *
+     * @param threadPoolSize number of threads for this pool
+     * @param batchDeliveryHandler handler to deliver batches of messages to
+     *                             receivers
+     * @param filterHandler filter handler for messages
+     */
+    OrderedQueueDispatcherPool(const unsigned int& threadPoolSize,
+            BatchDeliveryHandlerPtr batchDeliveryHandler,
+            FilterHandlerPtr filterHandler) :
+            currentPosition(0), jobsAvailable(false), interrupted(false), parallelCalls(
+                    false), maxBatchSize(DEFAULT_MAX_BATCH_SIZE), maxBatchLatency(
+                    0), started(false), schedulingMode(SCHEDULING_SCAN), readyReceivers(
+                    0), idleWorkers(0), nextWorker(0), threadPoolSize(
+                    threadPoolSize), batchDeliveryHandler(batchDeliveryHandler), filterHandler(
+                    filterHandler) {
+    }
+
     virtual ~OrderedQueueDispatcherPool() {
         stop();
+        clearReadyReceivers();
     }
 
     /**
@@ -436,6 +993,11 @@ public:
         boost::mutex::scoped_lock lock(receiversMutex);
         boost::shared_ptr<Receiver> rec(new Receiver(receiver));
         receivers.push_back(rec);
+        // each receiver is at most once on the ready queues
+        readyReceivers.reserve(1);
+        for (size_t i = 0; i < workerStates.size(); ++i) {
+            workerStates[i]->readyReceivers.reserve(1);
+        }
     }
 
     /**
@@ -448,6 +1010,10 @@ public:
 
         boost::mutex::scoped_lock lock(receiversMutex);
 
+        if (schedulingMode != SCHEDULING_SCAN) {
+            return unregisterReadyReceiver(receiver, lock);
+        }
+
         for (typename std::vector<boost::shared_ptr<Receiver> >::iterator it =
                 receivers.begin(); it != receivers.end(); ++it) {
             boost::shared_ptr<Receiver> rec = *it;
@@ -463,6 +1029,72 @@ public:
 
     }
 
+private:
+
+    bool unregisterReadyReceiver(boost::shared_ptr<R> receiver,
+            boost::mutex::scoped_lock& lock) {
+
+        for (typename std::vector<boost::shared_ptr<Receiver> >::iterator it =
+                receivers.begin(); it != receivers.end(); ++it) {
+            boost::shared_ptr<Receiver> rec = *it;
+            if (rec->receiver == receiver) {
+                it = receivers.erase(it);
+                lock.unlock();
+                // workers check this flag after announcing a call and before
+                // finishing it, hence afterwards no new call can start
+                rec->removed = true;
+                boost::mutex::scoped_lock callsLock(rec->callsMutex);
+                while (rec->activeCalls > 0) {
+                    rec->processingCondition.wait(callsLock);
+                }
+                return true;
+            }
+        }
+        return false;
+
+    }
+
+public:
+
+    /**
+     * Selects the strategy workers use to find receivers with pending
+     * messages. Must be called while the pool is not running. Ordering and
+     * the guarantees of #setParallelCalls are the same for all modes.
+     *
+     * @param mode new scheduling mode
+     * @throw IllegalStateException if the pool is running
+     */
+    void setSchedulingMode(const SchedulingMode& mode) {
+
+        boost::mutex::scoped_lock lock(receiversMutex);
+        if (started) {
+            throw rsc::misc::IllegalStateException(
+                    "Cannot change the scheduling mode of a running pool");
+        }
+
+        if (mode != schedulingMode) {
+            clearReadyReceivers();
+        }
+        if (mode == SCHEDULING_WORK_STEALING && workerStates.empty()) {
+            for (unsigned int i = 0; i < std::max(threadPoolSize, 1u); ++i) {
+                boost::shared_ptr<WorkerState> state(new WorkerState);
+                state->readyReceivers.reserve(receivers.size());
+                workerStates.push_back(state);
+            }
+        }
+        schedulingMode = mode;
+
+    }
+
+    /**
+     * Returns the currently selected scheduling mode.
+     *
+     * @return scheduling mode
+     */
+    SchedulingMode getSchedulingMode() const {
+        return schedulingMode;
+    }
+
     /**
      * Decides whether a single receiver might be called in parallel with
      * overlapping calls or not. As the default, each receiver receives only one
@@ -483,6 +1115,30 @@ public:
         parallelCalls = allow;
     }
 
+    /**
+     * Sets the maximum number of messages passed to the BatchDeliveryHandler
+     * in one call. Has no effect if no BatchDeliveryHandler is used.
+     *
+     * @param size maximum batch size, at least 1. Defaults to
+     *             #DEFAULT_MAX_BATCH_SIZE
+     */
+    void setMaxBatchSize(const unsigned int& size) {
+        maxBatchSize = size;
+    }
+
+    /**
+     * Sets the time a worker waits for further messages of a receiver to
+     * fill up a batch after it got the first message. The worker is blocked
+     * during this time, also for #stop. Has no effect if no
+     * BatchDeliveryHandler is used.
+     *
+     * @param ms maximum waiting time in milliseconds. 0, the default, only
+     *           batches messages which are already queued
+     */
+    void setMaxBatchLatency(const boost::uint32_t& ms) {
+        maxBatchLatency = ms;
+    }
+
     /**
      * Non-blocking start.
      *
@@ -498,6 +1154,16 @@ public:
 
         interrupted = false;
 
+        // messages may have been pushed in a different mode
+        if (schedulingMode != SCHEDULING_SCAN) {
+            for (typename std::vector<boost::shared_ptr<Receiver> >::iterator
+                    it = receivers.begin(); it != receivers.end(); ++it) {
+                if (!(*it)->queue.empty() && !(*it)->scheduled.exchange(true)) {
+                    scheduleReceiver(*it);
+                }
+            }
+        }
+
         for (unsigned int i = 0; i < threadPoolSize; ++i) {
             boost::function<void()> workerMethod = boost::bind(
                     &OrderedQueueDispatcherPool::worker, this, i);
@@ -519,6 +1185,14 @@ public:
             interrupted = true;
         }
         jobsAvailableCondition.notify_all();
+        {
+            boost::mutex::scoped_lock lock(readyMutex);
+            readyCondition.notify_all();
+        }
+        for (size_t i = 0; i < workerStates.size(); ++i) {
+            boost::mutex::scoped_lock lock(workerStates[i]->mutex);
+            workerStates[i]->condition.notify_all();
+        }
 
         for (unsigned int i = 0; i < threadPool.size(); ++i) {
             threadPool[i]->join();
@@ -539,6 +1213,16 @@ public:
         //        std::cout << "new job " << message << std::endl;
         {
             boost::mutex::scoped_lock lock(receiversMutex);
+            if (schedulingMode != SCHEDULING_SCAN) {
+                for (typename std::vector<boost::shared_ptr<Receiver> >::iterator
+                        it = receivers.begin(); it != receivers.end(); ++it) {
+                    (*it)->queue.push(message);
+                    if (!(*it)->scheduled.exchange(true)) {
+                        scheduleReceiver(*it);
+                    }
+                }
+                return;
+            }
             for (typename std::vector<boost::shared_ptr<Receiver> >::iterator
                     it = receivers.begin(); it != receivers.end(); ++it) {
                 (*it)->queue.push(message);
@@ -551,6 +1235,9 @@ public:
 
 };
 
+template<class M, class R, class Q>
+const unsigned int OrderedQueueDispatcherPool<M, R, Q>::DEFAULT_MAX_BATCH_SIZE;
+
 }
 }
 
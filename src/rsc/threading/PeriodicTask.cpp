@@ -26,6 +26,9 @@
 
 #include "PeriodicTask.h"
 
+#include "../misc/Clock.h"
+#include "PeriodicTaskScheduler.h"
+
 using namespace std;
 
 namespace rsc {
@@ -34,54 +37,112 @@ namespace threading {
 PeriodicTask::PeriodicTask(const unsigned int& ms, bool accountProcTime) :
         cycleTime(ms), logger(
                 rsc::logging::Logger::getLogger("rsc.threading.PeriodicTask")), fixedScheduling(
-                accountProcTime), nextProcessingStart(0) {
+                accountProcTime), nextProcessingStart(0), missedDeadlines(0), scheduler(
+                0), cycleRunning(false) {
 }
 
 PeriodicTask::~PeriodicTask() {
     RSCTRACE(logger, "~PeriodicTask() entered");
 }
 
+void PeriodicTask::cancel() {
+
+    RepetitiveTask::cancel();
+    // pairs with the fence of the scheduler after processing the task
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+    {
+        boost::mutex::scoped_lock lock(cycleMutex);
+        cycleCondition.notify_all();
+    }
+
+    boost::mutex::scoped_lock lock(schedulerMutex);
+    if (scheduler) {
+        scheduler->wake(this);
+    }
+
+}
+
+unsigned int PeriodicTask::getCycleTime() const {
+    return cycleTime;
+}
+
+boost::uint64_t PeriodicTask::getMissedDeadlines() const {
+    return missedDeadlines;
+}
+
+boost::uint64_t PeriodicTask::nextDeadline(const boost::uint64_t& deadline,
+        const boost::uint64_t& now, boost::uint64_t& missed) {
+
+    missed = 0;
+    const boost::uint64_t period = cycleTime * 1000ull;
+    if (!fixedScheduling) {
+        return now + period;
+    }
+    if (period == 0) {
+        return now;
+    }
+
+    boost::uint64_t next = deadline + period;
+    if (next < now) {
+        // skip all deadlines that already passed instead of catching up
+        missed = (now - next + period - 1) / period;
+        next += missed * period;
+        missedDeadlines += missed;
+    }
+    return next;
+
+}
+
 bool PeriodicTask::continueExec() {
-    RSCTRACE(logger, "~PeriodicTask()::continueExec() entered");
+    RSCTRACE(logger, "PeriodicTask()::continueExec() entered");
 
     if (isCancelRequested()) {
         return false;
     }
 
+    {
+        // the scheduler waits for the next deadline itself
+        boost::mutex::scoped_lock lock(schedulerMutex);
+        if (scheduler) {
+            return true;
+        }
+    }
+
+    const boost::uint64_t now = rsc::misc::monotonicMicros();
     if (nextProcessingStart == 0) {
-        nextProcessingStart = rsc::misc::currentTimeMicros() + cycleTime * 1000;
-        return true;
+        nextProcessingStart = now + cycleTime * 1000ull;
+    } else {
+        boost::uint64_t missed;
+        nextProcessingStart = nextDeadline(nextProcessingStart, now, missed);
+        if (missed > 0) {
+            RSCDEBUG(logger,
+                    "PeriodicTask()::continueExec() missed " << missed << " deadline(s)");
+        }
     }
 
     // wait, give others a chance
-    if (cycleTime != 0) {
-        // TODO provide option to interrupt in cancel using boost::this_thread
-        try {
-            RSCTRACE(
-                    logger,
-                    "PeriodicTask()::continueExec() before thread sleep, sleeping " << cycleTime << " ms");
-            if (fixedScheduling) {
-                boost::this_thread::sleep(
-                        boost::posix_time::microseconds(
-                                nextProcessingStart
-                                        - rsc::misc::currentTimeMicros()));
-            } else {
-                boost::this_thread::sleep(
-                        boost::posix_time::microseconds(cycleTime * 1000));
+    try {
+        RSCTRACE(logger,
+                "PeriodicTask()::continueExec() waiting until " << nextProcessingStart);
+        boost::mutex::scoped_lock lock(cycleMutex);
+        while (!isCancelRequested()) {
+            const boost::uint64_t current = rsc::misc::monotonicMicros();
+            if (current >= nextProcessingStart) {
+                break;
             }
-        } catch (const boost::thread_interrupted& e) {
-            // TODO handle interruption somewhere directly in task. This is
-            // something all tasks should benefit of, see above TODO.
-            RSCWARN(
-                    logger,
-                    "PeriodicTask()::continueExec() caught boost::thread_interrupted exception");
-            return false;
-        }RSCTRACE(logger, "PeriodicTask()::continueExec() thread woke up");
-    }RSCTRACE(logger, "PeriodicTask()::continueExec() before lock");
-
-    nextProcessingStart += cycleTime * 1000;
-
-    return true;
+            cycleCondition.timed_wait(lock,
+                    boost::posix_time::microseconds(
+                            nextProcessingStart - current));
+        }
+    } catch (const boost::thread_interrupted& e) {
+        RSCWARN(logger,
+                "PeriodicTask()::continueExec() caught boost::thread_interrupted exception");
+        return false;
+    }
+    RSCTRACE(logger, "PeriodicTask()::continueExec() thread woke up");
+
+    return !isCancelRequested();
 }
 
 }
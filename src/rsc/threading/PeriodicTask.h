@@ -32,14 +32,31 @@
 
 #include <iostream>
 
+#include <boost/atomic.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+
 namespace rsc {
 namespace threading {
 
+class PeriodicTaskScheduler;
+
 /**
  * A specialization of Task that executes a task in a periodic manner by
  * providing an special implementation of #continueExec. A fixed interval
  * is guaranteed.
  *
+ * With fixed scheduling, iterations start at absolute deadlines which are
+ * multiples of the cycle time apart, so that delays of single iterations do
+ * not accumulate. Deadlines which already passed when an iteration finishes
+ * are skipped and counted as missed deadlines.
+ *
+ * A periodic task can either be run on its own thread, e.g. by a
+ * ThreadedTaskExecutor, or together with other periodic tasks on a
+ * PeriodicTaskScheduler. In both cases #cancel immediately ends the wait for
+ * the next iteration.
+ *
  * @author swrede
  * @author jwienke
  * @author anordman
@@ -62,19 +79,76 @@ public:
 
     /**
      * Implements a waiting logic for the continuation of the repetitive task.
+     * On a PeriodicTaskScheduler this method is called after each iteration
+     * as well, but returns immediately because the scheduler waits for the
+     * next deadline. Subclasses may return @c false to stop the task in both
+     * cases.
      *
      * @return @ctrue until the task is canceled after having waited for the
      *         specified amount of time.
      */
     virtual bool continueExec();
 
+    /**
+     * Cancels the task and wakes it up if it is waiting for its next
+     * iteration.
+     */
+    virtual void cancel();
+
+    /**
+     * Returns the time between two iterations.
+     *
+     * @return cycle time in milliseconds
+     */
+    unsigned int getCycleTime() const;
+
+    /**
+     * Returns the number of deadlines that were skipped because a previous
+     * iteration had not finished in time. Can be called from any thread.
+     *
+     * @return number of missed deadlines
+     */
+    boost::uint64_t getMissedDeadlines() const;
+
 private:
+
+    friend class PeriodicTaskScheduler;
+
+    /**
+     * Computes the start of the next iteration after the iteration for
+     * @a deadline finished at @a now and records skipped deadlines.
+     *
+     * @param deadline start time of the finished iteration in microseconds
+     * @param now current time in microseconds
+     * @param missed out parameter receiving the number of skipped deadlines
+     * @return start time of the next iteration in microseconds
+     */
+    boost::uint64_t nextDeadline(const boost::uint64_t& deadline,
+            const boost::uint64_t& now, boost::uint64_t& missed);
+
     unsigned int cycleTime;
     rsc::logging::LoggerPtr logger;
     bool fixedScheduling;
     boost::uint64_t nextProcessingStart;
+
+    boost::mutex cycleMutex;
+    boost::condition cycleCondition;
+    boost::atomic<boost::uint64_t> missedDeadlines;
+
+    /**
+     * Scheduler this task is currently registered at, guarded by
+     * schedulerMutex.
+     */
+    PeriodicTaskScheduler* scheduler;
+    boost::mutex schedulerMutex;
+    /**
+     * Set while a worker of the scheduler processes this task.
+     */
+    boost::atomic<bool> cycleRunning;
+
 };
 
+typedef boost::shared_ptr<PeriodicTask> PeriodicTaskPtr;
+
 }
 }
-
@@ -0,0 +1,239 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "PeriodicTaskScheduler.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "../misc/Clock.h"
+#include "SimpleTask.h"
+
+using namespace std;
+
+namespace rsc {
+namespace threading {
+
+/**
+ * A single pending processing of a PeriodicTask on the executor.
+ *
+ * @author jwienke
+ */
+class PeriodicTaskScheduler::Cycle: public SimpleTask {
+public:
+
+    Cycle(PeriodicTaskScheduler* scheduler, PeriodicTaskPtr task,
+            const boost::uint64_t& deadline) :
+            scheduler(scheduler), task(task), deadline(deadline) {
+    }
+
+    void run() {
+        // the executor only cancels cycles when it is destroyed
+        scheduler->process(task, deadline, isCancelRequested());
+        markDone();
+    }
+
+private:
+
+    PeriodicTaskScheduler* scheduler;
+    PeriodicTaskPtr task;
+    boost::uint64_t deadline;
+
+};
+
+PeriodicTaskScheduler::PeriodicTaskScheduler(const unsigned int& numThreads,
+        const boost::uint64_t& tickMus) :
+        logger(
+                rsc::logging::Logger::getLogger(
+                        "rsc.threading.PeriodicTaskScheduler")), missedDeadlines(
+                0), executor(numThreads, tickMus) {
+}
+
+PeriodicTaskScheduler::~PeriodicTaskScheduler() {
+
+    vector<PeriodicTaskPtr> remaining;
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        for (map<PeriodicTask*, PeriodicTaskPtr>::const_iterator it =
+                tasks.begin(); it != tasks.end(); ++it) {
+            remaining.push_back(it->second);
+        }
+    }
+    for (vector<PeriodicTaskPtr>::iterator it = remaining.begin();
+            it != remaining.end(); ++it) {
+        (*it)->cancel();
+    }
+    for (vector<PeriodicTaskPtr>::iterator it = remaining.begin();
+            it != remaining.end(); ++it) {
+        (*it)->waitDone();
+    }
+
+}
+
+void PeriodicTaskScheduler::schedule(PeriodicTaskPtr task) {
+
+    if (task->isCancelRequested()) {
+        throw invalid_argument("Task already canceled.");
+    }
+
+    {
+        boost::mutex::scoped_lock lock(task->schedulerMutex);
+        if (task->scheduler) {
+            throw invalid_argument("Task is already scheduled.");
+        }
+        task->scheduler = this;
+    }
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        tasks[task.get()] = task;
+    }
+
+    scheduleCycle(task, rsc::misc::monotonicMicros());
+
+}
+
+std::size_t PeriodicTaskScheduler::getNumTasks() const {
+    boost::mutex::scoped_lock lock(mutex);
+    return tasks.size();
+}
+
+boost::uint64_t PeriodicTaskScheduler::getMissedDeadlines() const {
+    return missedDeadlines;
+}
+
+void PeriodicTaskScheduler::wake(PeriodicTask* task) {
+    PeriodicTaskPtr ptr;
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        map<PeriodicTask*, PeriodicTaskPtr>::const_iterator it = tasks.find(
+                task);
+        if (it == tasks.end()) {
+            return;
+        }
+        ptr = it->second;
+    }
+    executor.schedule(TaskPtr(new Cycle(this, ptr, 0)));
+}
+
+void PeriodicTaskScheduler::scheduleCycle(PeriodicTaskPtr task,
+        const boost::uint64_t& deadline) {
+    const boost::uint64_t now = rsc::misc::monotonicMicros();
+    executor.schedule(TaskPtr(new Cycle(this, task, deadline)),
+            deadline > now ? deadline - now : 0);
+}
+
+void PeriodicTaskScheduler::process(PeriodicTaskPtr task,
+        const boost::uint64_t& deadline, bool shutdown) {
+
+    bool iterationDue = deadline != 0;
+    while (true) {
+
+        // another worker is processing the task and will observe a
+        // cancellation after its iteration
+        if (task->cycleRunning.exchange(true)) {
+            return;
+        }
+
+        if (task->isDone()) {
+            task->cycleRunning = false;
+            return;
+        }
+
+        if (shutdown || task->isCancelRequested()) {
+            finish(task);
+            task->cycleRunning = false;
+            return;
+        }
+
+        bool rescheduled = false;
+        boost::uint64_t next = 0;
+        if (iterationDue) {
+
+            iterationDue = false;
+            bool continuing = false;
+            try {
+                task->pre();
+                task->execute();
+                task->post();
+                continuing = task->continueExec();
+            } catch (const std::exception& e) {
+                RSCERROR(logger,
+                        "Periodic task threw an exception and is stopped: " << e.what());
+            } catch (...) {
+                RSCERROR(logger,
+                        "Periodic task threw an unknown exception and is stopped");
+            }
+
+            if (!continuing) {
+                finish(task);
+                task->cycleRunning = false;
+                return;
+            }
+
+            boost::uint64_t missed;
+            next = task->nextDeadline(deadline, rsc::misc::monotonicMicros(),
+                    missed);
+            if (missed > 0) {
+                missedDeadlines += missed;
+                RSCDEBUG(logger,
+                        "Task " << task.get() << " missed " << missed << " deadline(s)");
+            }
+            rescheduled = true;
+
+        }
+
+        task->cycleRunning = false;
+        // pairs with the fence in PeriodicTask::cancel so that either we see
+        // the cancellation or the canceling thread's wake-up sees us idle
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        // only after releasing the task, otherwise a worker picking up the
+        // next cycle early would drop it
+        if (rescheduled) {
+            scheduleCycle(task, next);
+        }
+        if (!task->isCancelRequested() || task->isDone()) {
+            return;
+        }
+
+    }
+
+}
+
+void PeriodicTaskScheduler::finish(PeriodicTaskPtr task) {
+    {
+        boost::mutex::scoped_lock lock(task->schedulerMutex);
+        task->scheduler = 0;
+    }
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        tasks.erase(task.get());
+    }
+    task->markDone();
+}
+
+}
+}
@@ -0,0 +1,151 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <map>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "../logging/Logger.h"
+#include "PeriodicTask.h"
+#include "PooledTaskExecutor.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace threading {
+
+/**
+ * Executes many PeriodicTask instances using a single timer thread and a
+ * fixed pool of worker threads instead of one thread per task.
+ *
+ * Each iteration of a task is started at its absolute deadline (see
+ * PeriodicTask for the semantics of fixed scheduling) on one of the worker
+ * threads, while waiting tasks do not occupy any thread. Iterations of the
+ * same task never overlap. Canceling a task wakes it up immediately so that
+ * PeriodicTask::waitDone returns without waiting for the next deadline.
+ *
+ * After each iteration PeriodicTask::continueExec is called, which returns
+ * immediately for scheduled tasks. If it returns @c false or an iteration
+ * throws an exception, which is logged, the task is considered done.
+ *
+ * On destruction all registered tasks are canceled and the destructor waits
+ * until they are done.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT PeriodicTaskScheduler: private boost::noncopyable {
+public:
+
+    /**
+     * Creates a new scheduler and starts its threads.
+     *
+     * @param numThreads number of worker threads executing task iterations
+     * @param tickMus resolution of deadlines in microseconds
+     * @throw std::invalid_argument @a numThreads or @a tickMus is 0
+     */
+    explicit PeriodicTaskScheduler(
+            const unsigned int& numThreads =
+                    PooledTaskExecutor::DEFAULT_NUM_THREADS,
+            const boost::uint64_t& tickMus =
+                    PooledTaskExecutor::DEFAULT_TICK_MUS);
+    virtual ~PeriodicTaskScheduler();
+
+    /**
+     * Starts periodic execution of a task. The first iteration is started
+     * immediately.
+     *
+     * @param task the task to execute
+     * @throw std::invalid_argument task is already canceled or already
+     *                              scheduled on a scheduler
+     */
+    void schedule(PeriodicTaskPtr task);
+
+    /**
+     * Returns the number of tasks currently executed by this scheduler.
+     *
+     * @return number of tasks which are not done yet
+     */
+    std::size_t getNumTasks() const;
+
+    /**
+     * Returns the number of deadlines missed by all tasks of this scheduler
+     * since its creation. Missed deadlines of a single task are available
+     * through PeriodicTask::getMissedDeadlines.
+     *
+     * @return number of missed deadlines
+     */
+    boost::uint64_t getMissedDeadlines() const;
+
+private:
+
+    friend class PeriodicTask;
+
+    class Cycle;
+
+    /**
+     * Called by a task while being canceled to finish it as soon as
+     * possible.
+     */
+    void wake(PeriodicTask* task);
+
+    /**
+     * Processes a task on a worker thread.
+     *
+     * @param task the task to process
+     * @param deadline deadline of the iteration to execute or 0 if no
+     *                 iteration is due and only cancellation has to be
+     *                 handled
+     * @param shutdown if @c true, the task is finished regardless of its
+     *                 state
+     */
+    void process(PeriodicTaskPtr task, const boost::uint64_t& deadline,
+            bool shutdown);
+
+    void scheduleCycle(PeriodicTaskPtr task, const boost::uint64_t& deadline);
+
+    void finish(PeriodicTaskPtr task);
+
+    rsc::logging::LoggerPtr logger;
+
+    mutable boost::mutex mutex;
+    std::map<PeriodicTask*, PeriodicTaskPtr> tasks;
+    boost::atomic<boost::uint64_t> missedDeadlines;
+
+    /**
+     * Declared last so that pending iterations are processed before the
+     * other members are destroyed.
+     */
+    PooledTaskExecutor executor;
+
+};
+
+}
+}
@@ -0,0 +1,210 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include "PooledTaskExecutor.h"
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/bind.hpp>
+
+#include "../misc/Clock.h"
+
+using namespace std;
+
+namespace rsc {
+namespace threading {
+
+const unsigned int PooledTaskExecutor::DEFAULT_NUM_THREADS = 4;
+const boost::uint64_t PooledTaskExecutor::DEFAULT_TICK_MUS = 1000;
+
+PooledTaskExecutor::PooledTaskExecutor(const unsigned int& numThreads,
+        const boost::uint64_t& tickMus) :
+        logger(
+                rsc::logging::Logger::getLogger(
+                        "rsc.threading.PooledTaskExecutor")), numThreads(
+                numThreads), tickMus(tickMus), canceling(false), wheel(
+                tickMus > 0 ? rsc::misc::monotonicMicros() / tickMus : 0), wakeTick(
+                0), stopping(false) {
+
+    if (numThreads == 0) {
+        throw invalid_argument("At least one worker thread is required.");
+    }
+    if (tickMus == 0) {
+        throw invalid_argument("Tick length must be greater than 0.");
+    }
+
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        workers.create_thread(
+                boost::bind(&PooledTaskExecutor::workerLoop, this));
+    }
+    timerThread = boost::thread(
+            boost::bind(&PooledTaskExecutor::timerLoop, this));
+
+}
+
+PooledTaskExecutor::~PooledTaskExecutor() {
+
+    {
+        boost::mutex::scoped_lock lock(timerMutex);
+        stopping = true;
+        timerCondition.notify_all();
+    }
+    timerThread.join();
+
+    // Running tasks are canceled so that they finish and workers pick up
+    // all further tasks canceled.
+    {
+        boost::mutex::scoped_lock lock(runningMutex);
+        canceling = true;
+        for (multiset<TaskPtr>::iterator it = running.begin();
+                it != running.end(); ++it) {
+            (*it)->cancel();
+        }
+    }
+
+    vector<TaskPtr> pending;
+    tasks.drain(back_inserter(pending));
+    wheel.clear(back_inserter(pending));
+    for (vector<TaskPtr>::iterator it = pending.begin(); it != pending.end();
+            ++it) {
+        (*it)->cancel();
+    }
+    tasks.pushAll(pending.begin(), pending.end());
+
+    // one terminator per worker, queued after all remaining tasks
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        tasks.push(TaskPtr());
+    }
+    workers.join_all();
+
+}
+
+void PooledTaskExecutor::schedule(TaskPtr t) {
+    if (t->isCancelRequested()) {
+        throw invalid_argument("Task already canceled.");
+    }
+    tasks.push(t);
+}
+
+void PooledTaskExecutor::schedule(TaskPtr t, const boost::uint64_t& delayMus) {
+
+    if (t->isCancelRequested()) {
+        throw invalid_argument("Task already canceled.");
+    }
+    if (delayMus == 0) {
+        tasks.push(t);
+        return;
+    }
+
+    // round up to full ticks so that tasks never start too early
+    const boost::uint64_t dueTick = (rsc::misc::monotonicMicros() + delayMus
+            + tickMus - 1) / tickMus;
+
+    boost::mutex::scoped_lock lock(timerMutex);
+    wheel.add(dueTick, t);
+    if (dueTick < wakeTick) {
+        timerCondition.notify_one();
+    }
+
+}
+
+unsigned int PooledTaskExecutor::getNumThreads() const {
+    return numThreads;
+}
+
+void PooledTaskExecutor::workerLoop() {
+
+    while (true) {
+
+        TaskPtr task = tasks.pop();
+        if (!task) {
+            return;
+        }
+
+        {
+            boost::mutex::scoped_lock lock(runningMutex);
+            if (canceling) {
+                task->cancel();
+            }
+            running.insert(task);
+        }
+
+        try {
+            task->run();
+        } catch (const std::exception& e) {
+            RSCERROR(logger,
+                    "Task threw an exception and was aborted: " << e.what());
+        } catch (...) {
+            RSCERROR(logger,
+                    "Task threw an unknown exception and was aborted");
+        }
+
+        {
+            boost::mutex::scoped_lock lock(runningMutex);
+            running.erase(running.find(task));
+        }
+
+    }
+
+}
+
+void PooledTaskExecutor::timerLoop() {
+
+    vector<TaskPtr> due;
+
+    boost::mutex::scoped_lock lock(timerMutex);
+    while (!stopping) {
+
+        const boost::uint64_t now = rsc::misc::monotonicMicros();
+        wheel.advance(now / tickMus, back_inserter(due));
+
+        if (!due.empty()) {
+            lock.unlock();
+            tasks.pushAll(due.begin(), due.end());
+            due.clear();
+            lock.lock();
+            continue;
+        }
+
+        wakeTick = wheel.nextEventTick();
+        if (wakeTick == numeric_limits<boost::uint64_t>::max()) {
+            timerCondition.wait(lock);
+        } else if (wakeTick * tickMus > now) {
+            timerCondition.timed_wait(lock,
+                    boost::posix_time::microseconds(wakeTick * tickMus - now));
+        }
+        wakeTick = 0;
+
+    }
+
+}
+
+}
+}
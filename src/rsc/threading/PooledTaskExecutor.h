@@ -0,0 +1,142 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <set>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include "../logging/Logger.h"
+#include "SynchronizedQueue.h"
+#include "TaskExecutor.h"
+#include "TimerWheel.h"
+#include "rsc/rscexports.h"
+
+namespace rsc {
+namespace threading {
+
+/**
+ * A TaskExecutor which executes all tasks on a fixed pool of worker threads.
+ *
+ * Tasks scheduled with a delay are kept in a hierarchical TimerWheel that is
+ * maintained by a single timer thread. Waiting tasks therefore do not occupy
+ * any thread until they are due and the costs of scheduling a delayed task
+ * do not depend on the number of already waiting tasks. The resolution of
+ * delays is one tick of the wheel, delays are rounded up to full ticks.
+ * Delays are measured with the monotonic clock, hence changes of the system
+ * time do not affect them.
+ *
+ * Long-running tasks like RepetitiveTask instances permanently occupy a
+ * worker thread. Size the pool accordingly.
+ *
+ * On destruction, all tasks are canceled. Queued and delayed tasks that have
+ * not started yet still run once so that their done state is reached and
+ * clients in Task::waitDone are released. The destructor waits for running
+ * tasks to finish, which requires them to react to cancellation. Scheduling
+ * new tasks during destruction is not supported.
+ *
+ * @author jwienke
+ */
+class RSC_EXPORT PooledTaskExecutor: public TaskExecutor,
+        private boost::noncopyable {
+public:
+
+    /**
+     * Default number of worker threads.
+     */
+    static const unsigned int DEFAULT_NUM_THREADS;
+
+    /**
+     * Default length of a timer wheel tick in microseconds.
+     */
+    static const boost::uint64_t DEFAULT_TICK_MUS;
+
+    /**
+     * Creates a new executor and starts its threads.
+     *
+     * @param numThreads number of worker threads executing tasks
+     * @param tickMus resolution of delayed scheduling in microseconds
+     * @throw std::invalid_argument @a numThreads or @a tickMus is 0
+     */
+    explicit PooledTaskExecutor(
+            const unsigned int& numThreads = DEFAULT_NUM_THREADS,
+            const boost::uint64_t& tickMus = DEFAULT_TICK_MUS);
+    virtual ~PooledTaskExecutor();
+
+    void schedule(TaskPtr t);
+    void schedule(TaskPtr t, const boost::uint64_t& delayMus);
+
+    /**
+     * Returns the number of worker threads of this executor.
+     *
+     * @return worker thread count
+     */
+    unsigned int getNumThreads() const;
+
+private:
+
+    void workerLoop();
+    void timerLoop();
+
+    rsc::logging::LoggerPtr logger;
+
+    const unsigned int numThreads;
+    const boost::uint64_t tickMus;
+
+    SynchronizedQueue<TaskPtr> tasks;
+    boost::thread_group workers;
+
+    boost::mutex runningMutex;
+    /**
+     * Tasks currently executed by the workers.
+     */
+    std::multiset<TaskPtr> running;
+    /**
+     * Set on destruction. Workers cancel tasks before running them.
+     */
+    bool canceling;
+
+    boost::mutex timerMutex;
+    boost::condition timerCondition;
+    TimerWheel<TaskPtr> wheel;
+    /**
+     * Tick until which the timer thread sleeps. New tasks only need to wake
+     * it up if they are due earlier.
+     */
+    boost::uint64_t wakeTick;
+    bool stopping;
+    boost::thread timerThread;
+
+};
+
+}
+}
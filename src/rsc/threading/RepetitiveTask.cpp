@@ -26,6 +26,8 @@
 
 #include "RepetitiveTask.h"
 
+#include "../misc/Clock.h"
+
 using namespace std;
 
 namespace rsc {
@@ -33,7 +35,8 @@ namespace threading {
 
 RepetitiveTask::RepetitiveTask() :
         cancelRequest(false), done(false), logger(
-                rsc::logging::Logger::getLogger("rsc.threading.RepetitiveTask")) {
+                rsc::logging::Logger::getLogger("rsc.threading.RepetitiveTask")), cycleStart(
+                0) {
 }
 
 RepetitiveTask::~RepetitiveTask() {
@@ -47,6 +50,10 @@ void RepetitiveTask::post() {
     timerAfterCycle();
 }
 
+const CycleStatistics& RepetitiveTask::getCycleStatistics() const {
+    return cycleStatistics;
+}
+
 void RepetitiveTask::cancel() {
     cancelRequest = true;
 }
@@ -110,12 +117,14 @@ bool RepetitiveTask::isDone() {
 }
 
 void RepetitiveTask::timerBeforeCycle() {
-    timer.restart();
+    cycleStart = rsc::misc::CycleClock::now();
 }
 
 void RepetitiveTask::timerAfterCycle() {
-    // calculate processing time for last cycle, last n cycle, variance...
-    RSCTRACE(logger, "Times (last cycle = " << timer.elapsed() << "s)");
+    const boost::uint64_t duration = rsc::misc::CycleClock::toNanos(
+            rsc::misc::CycleClock::now() - cycleStart);
+    cycleStatistics.record(duration);
+    RSCTRACE(logger, "Times (last cycle = " << duration << "ns)");
 }
 
 ostream& operator<<(ostream& out, const RepetitiveTask& t) {
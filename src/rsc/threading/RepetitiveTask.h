@@ -32,8 +32,8 @@
 #include <boost/function.hpp>
 #include <boost/thread.hpp>
 #include <boost/thread/condition.hpp>
-#include <boost/timer.hpp>
 
+#include "CycleStatistics.h"
 #include "Task.h"
 
 namespace rsc {
@@ -66,7 +66,8 @@ public:
     /**
      * A method called before each iteration of the task. The default
      * implementation starts a timer for performance measurements. Override this
-     * for comparable tasks.
+     * for comparable tasks and call this implementation in order to maintain
+     * the cycle statistics.
      */
     virtual void pre();
 
@@ -76,11 +77,21 @@ public:
     virtual void execute() = 0;
 
     /**
-     * A method called after each iteration of the task. The default methods
-     * logs timing information. Use it for comparable tasks only.
+     * A method called after each iteration of the task. The default method
+     * records the duration of the iteration in the cycle statistics and logs
+     * it. Use it for comparable tasks only.
      */
     virtual void post();
 
+    /**
+     * Returns statistics about the durations of the #execute calls of this
+     * task as measured by #pre and #post. The statistics can be queried from
+     * any thread while the task is running.
+     *
+     * @return cycle statistics of this task
+     */
+    const CycleStatistics& getCycleStatistics() const;
+
     /**
      * Interrupts the task. The default implementation sets a boolean flag that
      * can be checked with #isCancelRequested.
@@ -120,13 +131,16 @@ public:
 
 protected:
 
+    /**
+     * Marks the task as done and wakes up threads waiting in #waitDone.
+     */
+    void markDone();
+
     mutable boost::recursive_mutex doneMutex;
     boost::condition doneCondition;
 
 private:
 
-    void markDone();
-
     void timerBeforeCycle();
 
     void timerAfterCycle();
@@ -135,8 +149,11 @@ private:
     volatile bool done;
 
     rsc::logging::LoggerPtr logger;
-    // TODO boost::timer measures cpu time, not really used time
-    boost::timer timer;
+    /**
+     * Start of the current cycle in cycles of rsc::misc::CycleClock.
+     */
+    boost::uint64_t cycleStart;
+    CycleStatistics cycleStatistics;
 
 };
 
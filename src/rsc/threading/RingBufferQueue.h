@@ -0,0 +1,415 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/function.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "InterruptedException.h"
+#include "SynchronizedQueue.h"
+
+namespace rsc {
+namespace threading {
+
+/**
+ * A bounded multi-producer multi-consumer queue with the same interface as
+ * SynchronizedQueue, implemented as a lock-free ring buffer. Producers and
+ * consumers only synchronize through atomic sequence numbers in the buffer
+ * cells. A mutex and condition are only used to park consumers in a blocking
+ * #pop and producers only signal if a consumer is actually parked.
+ *
+ * As with SynchronizedQueue the oldest element is dropped if an element is
+ * pushed on a full queue.
+ *
+ * @author jwienke
+ * @tparam M message type handled in this queue. Must be default
+ *           constructible and assignable.
+ */
+template<class M>
+class RingBufferQueue: public boost::noncopyable {
+public:
+
+    typedef boost::function<void(const M& drop)> dropHandlerType;
+
+    /**
+     * Capacity used by the default constructor.
+     */
+    static const unsigned int DEFAULT_CAPACITY = 1024;
+
+private:
+
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * A slot of the ring buffer. A cell at position @c pos can be written if
+     * its sequence is @c pos and read if its sequence is @c pos + 1.
+     */
+    struct Cell {
+        boost::atomic<size_t> sequence;
+        M data;
+    };
+
+    const size_t capacity;
+    boost::scoped_array<Cell> cells;
+    dropHandlerType dropHandler;
+
+    // producer and consumer indices on their own cache lines to prevent
+    // false sharing
+    char padding0[CACHE_LINE_SIZE];
+    boost::atomic<size_t> enqueuePos;
+    char padding1[CACHE_LINE_SIZE - sizeof(boost::atomic<size_t>)];
+    boost::atomic<size_t> dequeuePos;
+    char padding2[CACHE_LINE_SIZE - sizeof(boost::atomic<size_t>)];
+
+    boost::atomic<bool> interrupted;
+    boost::atomic<unsigned int> waiters;
+    boost::mutex mutex;
+    boost::condition condition;
+
+    bool tryEnqueue(const M& message) {
+
+        Cell* cell;
+        size_t pos = enqueuePos.load(boost::memory_order_relaxed);
+        while (true) {
+            cell = &cells[pos % capacity];
+            const size_t sequence = cell->sequence.load(
+                    boost::memory_order_acquire);
+            const std::ptrdiff_t diff = (std::ptrdiff_t) sequence
+                    - (std::ptrdiff_t) pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1,
+                        boost::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // full
+                return false;
+            } else {
+                pos = enqueuePos.load(boost::memory_order_relaxed);
+            }
+        }
+
+        cell->data = message;
+        cell->sequence.store(pos + 1, boost::memory_order_release);
+        return true;
+
+    }
+
+    bool tryDequeue(M& message) {
+
+        Cell* cell;
+        size_t pos = dequeuePos.load(boost::memory_order_relaxed);
+        while (true) {
+            cell = &cells[pos % capacity];
+            const size_t sequence = cell->sequence.load(
+                    boost::memory_order_acquire);
+            const std::ptrdiff_t diff = (std::ptrdiff_t) sequence
+                    - (std::ptrdiff_t) (pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1,
+                        boost::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // empty
+                return false;
+            } else {
+                pos = dequeuePos.load(boost::memory_order_relaxed);
+            }
+        }
+
+        message = boost::move(cell->data);
+        // do not keep references of the message alive in the buffer
+        cell->data = M();
+        cell->sequence.store(pos + capacity, boost::memory_order_release);
+        return true;
+
+    }
+
+    void notifyWaiters() {
+        // pairs with the fence in pop so that either the consumer sees the
+        // new element or we see the consumer waiting
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        if (waiters.load() > 0) {
+            boost::mutex::scoped_lock lock(mutex);
+            condition.notify_one();
+        }
+    }
+
+public:
+
+    /**
+     * Creates a new queue.
+     *
+     * @param capacity max allowed size of the queue. If the limit is reached
+     *                 and another element is added to the queue, the oldest
+     *                 element is removed. Must be at least 2.
+     * @param dropHandler function called with each element that is removed
+     *                    because the queue was full
+     * @throw std::invalid_argument capacity smaller than 2
+     */
+    explicit RingBufferQueue(const unsigned int& capacity = DEFAULT_CAPACITY,
+                             dropHandlerType dropHandler = 0) :
+        capacity(capacity), dropHandler(dropHandler), enqueuePos(0), dequeuePos(
+                0), interrupted(false), waiters(0) {
+        if (capacity < 2) {
+            throw std::invalid_argument(
+                    boost::str(
+                            boost::format(
+                                    "RingBufferQueue requires a capacity of at least 2, got %d")
+                                    % capacity));
+        }
+        cells.reset(new Cell[capacity]);
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, boost::memory_order_relaxed);
+        }
+    }
+
+    virtual ~RingBufferQueue() {
+    }
+
+    /**
+     * Pushes a new element on the queue and wakes up one waiting client if
+     * there is one. If the queue is full, the oldest element is dropped.
+     *
+     * @param message element to push on the queue
+     */
+    void push(const M& message) {
+        while (!tryEnqueue(message)) {
+            M dropped;
+            if (tryDequeue(dropped) && dropHandler) {
+                dropHandler(dropped);
+            }
+        }
+        notifyWaiters();
+    }
+
+    /**
+     * Pushes a new element on the queue if there is space left. In contrast
+     * to #push, no element is dropped if the queue is full.
+     *
+     * @param message element to push on the queue
+     * @return @c true if the element was pushed, @c false if the queue was
+     *         full
+     */
+    bool tryPush(const M& message) {
+        if (!tryEnqueue(message)) {
+            return false;
+        }
+        notifyWaiters();
+        return true;
+    }
+
+    /**
+     * Pushes all elements of a range on the queue and wakes up waiting
+     * clients.
+     *
+     * @param begin start of the range of elements to push
+     * @param end end of the range of elements to push
+     * @tparam InputIterator iterator type with elements convertible to M
+     */
+    template<class InputIterator>
+    void pushAll(InputIterator begin, InputIterator end) {
+        for (; begin != end; ++begin) {
+            push(*begin);
+        }
+    }
+
+    /**
+     * Returns the next element form the queue and wait until there is such an
+     * element. The returned element is removed from the queue immediately.
+     *
+     * @param timeoutMs maximum time spent waiting for a new element in
+     *                  milliseconds. Zero indicates to wait endlessly.
+     *                  Use #tryPop if you want to get a result without waiting
+     * @return next element on the queue
+     * @throw InterruptedException if #interrupt was called before a call to
+     *                             this method or while waiting for an element
+     * @throw QueueEmptyException thrown if @param timeoutMs was > 0 and no
+     *                            element was found on the queue in the
+     *                            specified time
+     */
+    M pop(const boost::uint32_t& timeoutMs = 0) {
+
+        M message;
+
+        if (interrupted) {
+            throw InterruptedException("Queue was interrupted");
+        }
+        if (tryDequeue(message)) {
+            return message;
+        }
+
+        const boost::system_time timeout = boost::get_system_time()
+                + boost::posix_time::milliseconds(timeoutMs);
+
+        boost::mutex::scoped_lock lock(mutex);
+        ++waiters;
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        while (!interrupted && !tryDequeue(message)) {
+            if (timeoutMs == 0) {
+                condition.wait(lock);
+            } else if (!condition.timed_wait(lock, timeout)) {
+                --waiters;
+                throw QueueEmptyException(boost::str(boost::format("No element available on queue within %d ms.") % timeoutMs));
+            }
+        }
+        --waiters;
+
+        if (interrupted) {
+            throw InterruptedException("Queue was interrupted");
+        }
+
+        return message;
+
+    }
+
+    /**
+     * Tries to pop an element from the queue but does not wait if there is no
+     * element on the queue.
+     *
+     * @return element from the queue
+     * @throw QueueEmptyException the queue was empty
+     */
+    M tryPop() {
+        M message;
+        if (!tryDequeue(message)) {
+            throw QueueEmptyException();
+        }
+        return message;
+    }
+
+    /**
+     * Removes up to @a max elements from the queue without waiting and
+     * writes them to @a out in queue order. Is not affected by the
+     * interruption flag.
+     *
+     * @param out iterator receiving the elements
+     * @param max maximum number of elements to remove. 0 removes all
+     * @return number of elements written to @a out
+     * @tparam OutputIterator output iterator for elements of type M
+     */
+    template<class OutputIterator>
+    std::size_t drain(OutputIterator out, const std::size_t& max = 0) {
+        std::size_t count = 0;
+        M message;
+        while ((max == 0 || count < max) && tryDequeue(message)) {
+            *out = message;
+            ++out;
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * Checks whether this queue is empty. Is not affected by the interruption
+     * flag. Elements of concurrently running #push calls might not be
+     * visible yet.
+     *
+     * @return @c true if empty, else @c false
+     */
+    bool empty() const {
+        size_t pos = dequeuePos.load(boost::memory_order_relaxed);
+        while (true) {
+            const size_t sequence = cells[pos % capacity].sequence.load(
+                    boost::memory_order_acquire);
+            const std::ptrdiff_t diff = (std::ptrdiff_t) sequence
+                    - (std::ptrdiff_t) (pos + 1);
+            if (diff == 0) {
+                return false;
+            } else if (diff < 0) {
+                return true;
+            }
+            pos = dequeuePos.load(boost::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Return element count of the queue. The result is only approximate if
+     * other threads are modifying the queue concurrently.
+     *
+     * @return The number of elements currently stored in the queue.
+     */
+    std::size_t size() const {
+        const size_t dequeued = dequeuePos.load();
+        const size_t enqueued = enqueuePos.load();
+        if (enqueued <= dequeued) {
+            return 0;
+        }
+        return std::min(enqueued - dequeued, capacity);
+    }
+
+    /**
+     * Returns the maximum number of elements in this queue.
+     *
+     * @return capacity
+     */
+    std::size_t getCapacity() const {
+        return capacity;
+    }
+
+    /**
+     * Remove all elements from the queue.
+     */
+    void clear() {
+        M message;
+        while (tryDequeue(message)) {
+        }
+    }
+
+    /**
+     * Interrupts the processing on this queue for every current call
+     * to pop and any later call. All of them will return with an
+     * exception.
+     */
+    void interrupt() {
+        interrupted = true;
+        boost::mutex::scoped_lock lock(mutex);
+        condition.notify_all();
+    }
+
+};
+
+template<class M>
+const unsigned int RingBufferQueue<M>::DEFAULT_CAPACITY;
+
+template<class M>
+const size_t RingBufferQueue<M>::CACHE_LINE_SIZE;
+
+}
+}
@@ -0,0 +1,321 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#pragma once
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread/condition.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "InterruptedException.h"
+#include "SynchronizedQueue.h"
+
+namespace rsc {
+namespace threading {
+
+/**
+ * An unbounded queue for exactly one producer thread and one consumer
+ * thread. Interruption and timed #pop behave like in SynchronizedQueue.
+ *
+ * The queue is a linked list of nodes. #push and the non-blocking part of
+ * #pop are wait-free and do not use any lock. Nodes are recycled by the
+ * producer so that no allocation happens once the queue has reached its
+ * typical size. A mutex and condition are only used to park the consumer in
+ * a blocking #pop and the producer only signals if the consumer is actually
+ * parked.
+ *
+ * #push must only be called by a single thread and #pop, #tryPop, #drain
+ * and #clear must only be called by a single, potentially different, thread.
+ * The remaining methods can be called from any thread.
+ *
+ * @author jwienke
+ * @tparam M message type handled in this queue. Must be default
+ *           constructible and assignable.
+ */
+template<class M>
+class SPSCQueue: public boost::noncopyable {
+private:
+
+    static const size_t CACHE_LINE_SIZE = 64;
+
+    struct Node {
+        Node() :
+            next(0) {
+        }
+        boost::atomic<Node*> next;
+        M data;
+    };
+
+    // consumer side: the node before the next element to pop
+    boost::atomic<Node*> head;
+    boost::atomic<boost::uint64_t> popped;
+    boost::atomic<bool> waiting;
+    char padding0[CACHE_LINE_SIZE];
+
+    // producer side
+    Node* tail;
+    // recycled nodes from first up to the last known head
+    Node* first;
+    Node* headCopy;
+    boost::atomic<boost::uint64_t> pushed;
+    char padding1[CACHE_LINE_SIZE];
+
+    boost::atomic<bool> interrupted;
+    boost::mutex mutex;
+    boost::condition condition;
+
+    Node* allocateNode() {
+        if (first != headCopy) {
+            Node* node = first;
+            first = first->next.load(boost::memory_order_relaxed);
+            return node;
+        }
+        headCopy = head.load(boost::memory_order_acquire);
+        if (first != headCopy) {
+            Node* node = first;
+            first = first->next.load(boost::memory_order_relaxed);
+            return node;
+        }
+        return new Node;
+    }
+
+    bool tryDequeue(M& message) {
+        Node* current = head.load(boost::memory_order_relaxed);
+        Node* next = current->next.load(boost::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        message = boost::move(next->data);
+        // do not keep references of the message alive in the queue
+        next->data = M();
+        head.store(next, boost::memory_order_release);
+        popped.store(popped.load(boost::memory_order_relaxed) + 1,
+                boost::memory_order_relaxed);
+        return true;
+    }
+
+public:
+
+    SPSCQueue() :
+        popped(0), waiting(false), pushed(0), interrupted(false) {
+        Node* dummy = new Node;
+        head = dummy;
+        tail = dummy;
+        first = dummy;
+        headCopy = dummy;
+    }
+
+    virtual ~SPSCQueue() {
+        Node* node = first;
+        while (node) {
+            Node* next = node->next.load(boost::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * Pushes a new element on the queue and wakes up the consumer if it is
+     * waiting. Must only be called by the producer thread.
+     *
+     * @param message element to push on the queue
+     */
+    void push(const M& message) {
+
+        Node* node = allocateNode();
+        node->data = message;
+        node->next.store(0, boost::memory_order_relaxed);
+        tail->next.store(node, boost::memory_order_release);
+        tail = node;
+        pushed.store(pushed.load(boost::memory_order_relaxed) + 1,
+                boost::memory_order_relaxed);
+
+        // pairs with the fence in pop so that either the consumer sees the
+        // new element or we see the consumer waiting
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        if (waiting.load(boost::memory_order_relaxed)) {
+            boost::mutex::scoped_lock lock(mutex);
+            condition.notify_one();
+        }
+
+    }
+
+    /**
+     * Pushes all elements of the range [@a begin, @a end) in order. Must only
+     * be called by the producer thread.
+     *
+     * @param begin iterator to the first element to push
+     * @param end iterator past the last element to push
+     * @tparam InputIterator input iterator for elements convertible to M
+     */
+    template<class InputIterator>
+    void pushAll(InputIterator begin, InputIterator end) {
+        for (; begin != end; ++begin) {
+            push(*begin);
+        }
+    }
+
+    /**
+     * Returns the next element form the queue and wait until there is such an
+     * element. The returned element is removed from the queue immediately.
+     * Must only be called by the consumer thread.
+     *
+     * @param timeoutMs maximum time spent waiting for a new element in
+     *                  milliseconds. Zero indicates to wait endlessly.
+     *                  Use #tryPop if you want to get a result without waiting
+     * @return next element on the queue
+     * @throw InterruptedException if #interrupt was called before a call to
+     *                             this method or while waiting for an element
+     * @throw QueueEmptyException thrown if @param timeoutMs was > 0 and no
+     *                            element was found on the queue in the
+     *                            specified time
+     */
+    M pop(const boost::uint32_t& timeoutMs = 0) {
+
+        M message;
+
+        if (interrupted) {
+            throw InterruptedException("Queue was interrupted");
+        }
+        if (tryDequeue(message)) {
+            return message;
+        }
+
+        const boost::system_time timeout = boost::get_system_time()
+                + boost::posix_time::milliseconds(timeoutMs);
+
+        boost::mutex::scoped_lock lock(mutex);
+        waiting = true;
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+        while (!interrupted && !tryDequeue(message)) {
+            if (timeoutMs == 0) {
+                condition.wait(lock);
+            } else if (!condition.timed_wait(lock, timeout)) {
+                waiting = false;
+                throw QueueEmptyException(boost::str(boost::format("No element available on queue within %d ms.") % timeoutMs));
+            }
+        }
+        waiting = false;
+
+        if (interrupted) {
+            throw InterruptedException("Queue was interrupted");
+        }
+
+        return message;
+
+    }
+
+    /**
+     * Tries to pop an element from the queue but does not wait if there is no
+     * element on the queue. Must only be called by the consumer thread.
+     *
+     * @return element from the queue
+     * @throw QueueEmptyException the queue was empty
+     */
+    M tryPop() {
+        M message;
+        if (!tryDequeue(message)) {
+            throw QueueEmptyException();
+        }
+        return message;
+    }
+
+    /**
+     * Removes up to @a max elements from the queue without waiting and
+     * writes them to @a out in queue order. Is not affected by the
+     * interruption flag. Must only be called by the consumer thread.
+     *
+     * @param out iterator receiving the elements
+     * @param max maximum number of elements to remove. 0 removes all
+     * @return number of elements written to @a out
+     * @tparam OutputIterator output iterator for elements of type M
+     */
+    template<class OutputIterator>
+    std::size_t drain(OutputIterator out, const std::size_t& max = 0) {
+        std::size_t count = 0;
+        M message;
+        while ((max == 0 || count < max) && tryDequeue(message)) {
+            *out = boost::move(message);
+            ++out;
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * Checks whether this queue is empty. Is not affected by the interruption
+     * flag.
+     *
+     * @return @c true if empty, else @c false
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * Return element count of the queue. The result is only approximate if
+     * the queue is modified concurrently.
+     *
+     * @return The number of elements currently stored in the queue.
+     */
+    std::size_t size() const {
+        const boost::uint64_t out = popped.load(boost::memory_order_acquire);
+        const boost::uint64_t in = pushed.load(boost::memory_order_acquire);
+        return in > out ? (std::size_t) (in - out) : 0;
+    }
+
+    /**
+     * Remove all elements from the queue. Must only be called by the consumer
+     * thread.
+     */
+    void clear() {
+        M message;
+        while (tryDequeue(message)) {
+        }
+    }
+
+    /**
+     * Interrupts the processing on this queue for every current call
+     * to pop and any later call. All of them will return with an
+     * exception.
+     */
+    void interrupt() {
+        interrupted = true;
+        boost::mutex::scoped_lock lock(mutex);
+        condition.notify_all();
+    }
+
+};
+
+template<class M>
+const size_t SPSCQueue<M>::CACHE_LINE_SIZE;
+
+}
+}
@@ -26,10 +26,12 @@
 
 #pragma once
 
-#include <queue>
+#include <deque>
 
+#include <boost/config.hpp>
 #include <boost/format.hpp>
 #include <boost/function.hpp>
+#include <boost/move/utility.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/thread/recursive_mutex.hpp>
@@ -55,6 +57,10 @@ public:
  * A queue with synchronized access and interruption support. On #push
  * operations only one waiting thread is woken up.
  *
+ * Elements are moved out of the queue when popping if the compiler supports
+ * rvalue references. Several elements can be exchanged with a single lock
+ * acquisition through #pushAll and #drain.
+ *
  * @author jwienke
  * @tparam M message type handled in this queue
  */
@@ -67,12 +73,39 @@ public:
 private:
 
     volatile bool interrupted;
-    std::queue<M> queue;
+    std::deque<M> queue;
     mutable boost::recursive_mutex mutex;
     boost::condition condition;
     unsigned int sizeLimit;
     dropHandlerType dropHandler;
 
+    /**
+     * Removes elements until another one can be added without exceeding the
+     * size limit. The mutex must be held by the caller.
+     */
+    void makeRoom() {
+        if (this->sizeLimit > 0) {
+            while (this->queue.size() > this->sizeLimit - 1) {
+                if (this->dropHandler) {
+                    this->dropHandler(this->queue.front());
+                }
+                this->queue.pop_front();
+            }
+        }
+    }
+
+    /**
+     * Removes the front element and returns it. The mutex must be held by the
+     * caller and the queue must not be empty.
+     *
+     * @return former front element
+     */
+    M popFront() {
+        M message(boost::move(this->queue.front()));
+        this->queue.pop_front();
+        return message;
+    }
+
 public:
 
     /**
@@ -104,18 +137,72 @@ public:
     void push(const M& message) {
         {
             boost::recursive_mutex::scoped_lock lock(this->mutex);
-            if (this->sizeLimit > 0) {
-                while (this->queue.size() > this->sizeLimit - 1) {
-                    if (this->dropHandler) {
-                        this->dropHandler(this->queue.front());
-                    }
-                    this->queue.pop();
-                }
-            }
-            this->queue.push(message);
+            makeRoom();
+            this->queue.push_back(message);
+        }
+        this->condition.notify_one();
+    }
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+    /**
+     * Moves a new element on the queue and wakes up one waiting client if
+     * there is one.
+     *
+     * @param message element to move on the queue
+     */
+    void push(M&& message) {
+        {
+            boost::recursive_mutex::scoped_lock lock(this->mutex);
+            makeRoom();
+            this->queue.push_back(boost::move(message));
+        }
+        this->condition.notify_one();
+    }
+#endif
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+    /**
+     * Constructs a new element in place at the end of the queue and wakes up
+     * one waiting client if there is one.
+     *
+     * @param args arguments passed to the constructor of the element
+     */
+    template<class... Args>
+    void emplace(Args&&... args) {
+        {
+            boost::recursive_mutex::scoped_lock lock(this->mutex);
+            makeRoom();
+            this->queue.emplace_back(boost::forward<Args>(args)...);
         }
         this->condition.notify_one();
     }
+#endif
+
+    /**
+     * Pushes all elements of a range on the queue with a single lock
+     * acquisition and wakes up waiting clients. The size limit is applied as
+     * if each element was pushed individually.
+     *
+     * @param begin start of the range of elements to push
+     * @param end end of the range of elements to push
+     * @tparam InputIterator iterator type with elements convertible to M
+     */
+    template<class InputIterator>
+    void pushAll(InputIterator begin, InputIterator end) {
+        std::size_t count = 0;
+        {
+            boost::recursive_mutex::scoped_lock lock(this->mutex);
+            for (; begin != end; ++begin, ++count) {
+                makeRoom();
+                this->queue.push_back(*begin);
+            }
+        }
+        if (count > 1) {
+            this->condition.notify_all();
+        } else if (count == 1) {
+            this->condition.notify_one();
+        }
+    }
 
     /**
      * Returns the element at the front of the queue without removing
@@ -196,9 +283,7 @@ public:
             throw InterruptedException("Queue was interrupted");
         }
 
-        M message = this->queue.front();
-        this->queue.pop();
-        return message;
+        return popFront();
 
     }
 
@@ -217,9 +302,44 @@ public:
             throw QueueEmptyException();
         }
 
-        M message = this->queue.front();
-        this->queue.pop();
-        return message;
+        return popFront();
+
+    }
+
+    /**
+     * Removes up to @a max elements from the queue with a single lock
+     * acquisition and writes them to @a out in queue order. Does not wait
+     * for elements and is not affected by the interruption flag. If all
+     * elements are requested, the contents of the queue are swapped out and
+     * written to @a out after releasing the lock.
+     *
+     * @param out iterator receiving the elements
+     * @param max maximum number of elements to remove. 0 removes all
+     * @return number of elements written to @a out
+     * @tparam OutputIterator output iterator for elements of type M
+     */
+    template<class OutputIterator>
+    std::size_t drain(OutputIterator out, const std::size_t& max = 0) {
+
+        std::deque<M> all;
+        {
+            boost::recursive_mutex::scoped_lock lock(this->mutex);
+            if (max != 0 && max < this->queue.size()) {
+                for (std::size_t i = 0; i < max; ++i) {
+                    *out = popFront();
+                    ++out;
+                }
+                return max;
+            }
+            all.swap(this->queue);
+        }
+
+        for (typename std::deque<M>::iterator it = all.begin(); it != all.end();
+                ++it) {
+            *out = boost::move(*it);
+            ++out;
+        }
+        return all.size();
 
     }
 
@@ -249,9 +369,7 @@ public:
      */
     void clear() {
         boost::recursive_mutex::scoped_lock lock(this->mutex);
-        while (!this->queue.empty()) {
-            this->queue.pop();
-        }
+        this->queue.clear();
     }
 
     /**
@@ -0,0 +1,300 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#pragma once
+
+#include <limits>
+#include <list>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+namespace rsc {
+namespace threading {
+
+/**
+ * A hierarchical timer wheel which sorts payloads by their expiry time
+ * expressed in abstract ticks. Adding a payload and advancing the wheel by
+ * one tick are constant time operations, independent of the number of
+ * stored payloads.
+ *
+ * The wheel consists of #LEVELS levels with #SLOTS slots each. Level 0 has
+ * the resolution of a single tick, each higher level covers the complete
+ * range of the level below in one slot. Whenever the lower level wraps
+ * around, the next slot of the higher level is cascaded down. Payloads
+ * further away than the range of all levels are parked in the highest level
+ * and re-sorted until their expiry is in range.
+ *
+ * This class is not thread-safe.
+ *
+ * @author jwienke
+ * @tparam T payload type stored in the wheel. Must be copyable.
+ */
+template<class T>
+class TimerWheel {
+public:
+
+    /**
+     * Number of bits of a tick count covered by one level.
+     */
+    static const unsigned int LEVEL_BITS = 8;
+
+    /**
+     * Number of slots per level.
+     */
+    static const unsigned int SLOTS = 1 << LEVEL_BITS;
+
+    /**
+     * Number of levels of the wheel.
+     */
+    static const unsigned int LEVELS = 4;
+
+    /**
+     * Creates a new empty wheel.
+     *
+     * @param startTick the tick the wheel is currently at
+     */
+    explicit TimerWheel(const boost::uint64_t& startTick = 0) :
+            slots(LEVELS * SLOTS), currentTick(startTick), count(0) {
+    }
+
+    /**
+     * Adds a payload which expires at the given tick. Payloads which are
+     * already expired will be returned by the next #advance that moves the
+     * wheel forward.
+     *
+     * @param expiryTick tick at which the payload expires
+     * @param payload the payload to store
+     */
+    void add(const boost::uint64_t& expiryTick, const T& payload) {
+        insert(Entry(expiryTick, payload));
+        ++count;
+    }
+
+    /**
+     * Advances the wheel up to the given tick and returns all payloads that
+     * expired in the meantime. If @a tick is not after the current tick,
+     * nothing happens.
+     *
+     * @param tick tick to advance the wheel to
+     * @param out iterator receiving the expired payloads in expiry order
+     * @return number of expired payloads
+     * @tparam OutputIterator output iterator for elements of type T
+     */
+    template<class OutputIterator>
+    std::size_t advance(const boost::uint64_t& tick, OutputIterator out) {
+
+        if (count == 0) {
+            if (tick > currentTick) {
+                currentTick = tick;
+            }
+            return 0;
+        }
+
+        std::size_t expired = 0;
+        while (currentTick < tick && count > 0) {
+
+            ++currentTick;
+            cascade();
+
+            std::list<Entry>& slot = slots[currentTick & MASK];
+            while (!slot.empty()) {
+                Entry& entry = slot.front();
+                if (entry.expiry > currentTick) {
+                    // far away entry placed with a clamped expiry
+                    insert(entry);
+                } else {
+                    *out = entry.payload;
+                    ++out;
+                    ++expired;
+                    --count;
+                }
+                slot.pop_front();
+            }
+
+        }
+        if (tick > currentTick) {
+            currentTick = tick;
+        }
+
+        return expired;
+
+    }
+
+    /**
+     * Returns the tick at which the wheel has to be advanced next in order to
+     * process its payloads on time. This is either the expiry of the next
+     * payload in the lowest level or the next cascading of higher levels,
+     * whichever comes first.
+     *
+     * @return next tick to advance to or the maximum value of
+     *         boost::uint64_t if the wheel is empty
+     */
+    boost::uint64_t nextEventTick() const {
+        if (count == 0) {
+            return std::numeric_limits<boost::uint64_t>::max();
+        }
+        const boost::uint64_t nextCascade = (currentTick | MASK) + 1;
+        for (boost::uint64_t tick = currentTick + 1; tick < nextCascade;
+                ++tick) {
+            if (!slots[tick & MASK].empty()) {
+                return tick;
+            }
+        }
+        return nextCascade;
+    }
+
+    /**
+     * Removes all payloads from the wheel regardless of their expiry.
+     *
+     * @param out iterator receiving the removed payloads in arbitrary order
+     * @return number of removed payloads
+     * @tparam OutputIterator output iterator for elements of type T
+     */
+    template<class OutputIterator>
+    std::size_t clear(OutputIterator out) {
+        std::size_t removed = 0;
+        for (typename std::vector<std::list<Entry> >::iterator slotIt =
+                slots.begin(); slotIt != slots.end(); ++slotIt) {
+            for (typename std::list<Entry>::const_iterator entryIt =
+                    slotIt->begin(); entryIt != slotIt->end(); ++entryIt) {
+                *out = entryIt->payload;
+                ++out;
+                ++removed;
+            }
+            slotIt->clear();
+        }
+        count = 0;
+        return removed;
+    }
+
+    /**
+     * Returns the tick the wheel has been advanced to.
+     *
+     * @return current tick
+     */
+    boost::uint64_t getCurrentTick() const {
+        return currentTick;
+    }
+
+    /**
+     * Returns the number of payloads in the wheel.
+     *
+     * @return payload count
+     */
+    std::size_t size() const {
+        return count;
+    }
+
+    /**
+     * Checks whether the wheel contains any payloads.
+     *
+     * @return @c true if empty, else @c false
+     */
+    bool empty() const {
+        return count == 0;
+    }
+
+private:
+
+    static const boost::uint64_t MASK = SLOTS - 1;
+
+    struct Entry {
+        Entry(const boost::uint64_t& expiry, const T& payload) :
+                expiry(expiry), payload(payload) {
+        }
+        boost::uint64_t expiry;
+        T payload;
+    };
+
+    void insert(const Entry& entry) {
+
+        // entries in the past are handled with the next tick
+        boost::uint64_t expiry = entry.expiry;
+        if (expiry <= currentTick) {
+            expiry = currentTick + 1;
+        }
+
+        // entries out of range are parked in the last slot of the top level
+        const boost::uint64_t range = ((boost::uint64_t) 1)
+                << (LEVEL_BITS * LEVELS);
+        if (expiry - currentTick >= range) {
+            expiry = currentTick + range - 1;
+        }
+
+        const boost::uint64_t delta = expiry - currentTick;
+        unsigned int level = 0;
+        while (level < LEVELS - 1
+                && delta >= (((boost::uint64_t) 1) << (LEVEL_BITS * (level + 1)))) {
+            ++level;
+        }
+        const boost::uint64_t slot = (expiry >> (LEVEL_BITS * level)) & MASK;
+        slots[level * SLOTS + slot].push_back(entry);
+
+    }
+
+    void cascade() {
+        for (unsigned int level = 1; level < LEVELS; ++level) {
+            const unsigned int shift = LEVEL_BITS * level;
+            if ((currentTick & ((((boost::uint64_t) 1) << shift) - 1)) != 0) {
+                break;
+            }
+            std::list<Entry> entries;
+            entries.swap(slots[level * SLOTS + ((currentTick >> shift) & MASK)]);
+            for (typename std::list<Entry>::const_iterator it =
+                    entries.begin(); it != entries.end(); ++it) {
+                if (it->expiry <= currentTick) {
+                    // expires on this tick, whose level 0 slot is processed
+                    // right after cascading
+                    slots[currentTick & MASK].push_back(*it);
+                } else {
+                    insert(*it);
+                }
+            }
+        }
+    }
+
+    std::vector<std::list<Entry> > slots;
+    boost::uint64_t currentTick;
+    std::size_t count;
+
+};
+
+template<class T>
+const unsigned int TimerWheel<T>::LEVEL_BITS;
+
+template<class T>
+const unsigned int TimerWheel<T>::SLOTS;
+
+template<class T>
+const unsigned int TimerWheel<T>::LEVELS;
+
+template<class T>
+const boost::uint64_t TimerWheel<T>::MASK;
+
+}
+}
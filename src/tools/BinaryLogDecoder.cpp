@@ -0,0 +1,120 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "rsc/logging/AsyncLogWriter.h"
+#include "rsc/logging/BinaryLogReader.h"
+#include "rsc/logging/StreamLogRecordSink.h"
+
+using namespace std;
+using namespace rsc::logging;
+
+namespace {
+
+void usage(const char* program) {
+    cerr << "Usage: " << program << " [-t] [FILE]..." << endl << endl
+            << "Prints binary RSC log files in text form. Reads standard "
+            << "input if no FILE or - is given." << endl << endl
+            << "  -t  include the number of the logging thread" << endl;
+}
+
+void decode(istream& stream, const bool& threads) {
+    BinaryLogReader reader(stream);
+    LogRecord record;
+    while (reader.next(record)) {
+        if (threads) {
+            cout << record.timestamp << " " << *record.loggerName
+                    << " {thread " << record.threadId << "} ["
+                    << record.level << "]: " << record.message << '\n';
+        } else {
+            StreamLogRecordSink::format(cout, record);
+        }
+    }
+}
+
+}
+
+/**
+ * Converts files written by BinaryLoggingSystem to the text layout of the
+ * other logging systems.
+ *
+ * @author jwienke
+ */
+int main(int argc, char* argv[]) {
+
+    bool threads = false;
+    vector<string> files;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-t") == 0) {
+            threads = true;
+        } else if (strcmp(argv[i], "-h") == 0
+                || strcmp(argv[i], "--help") == 0) {
+            usage(argv[0]);
+            return 0;
+        } else if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (files.empty()) {
+        files.push_back("-");
+    }
+
+    ios::sync_with_stdio(false);
+
+    int result = 0;
+    for (vector<string>::const_iterator it = files.begin(); it != files.end();
+            ++it) {
+        try {
+            if (*it == "-") {
+                decode(cin, threads);
+            } else {
+                ifstream file(it->c_str(), ios::in | ios::binary);
+                if (!file) {
+                    throw runtime_error("Unable to open file.");
+                }
+                decode(file, threads);
+            }
+        } catch (const exception& e) {
+            cout.flush();
+            cerr << *it << ": " << e.what() << endl;
+            result = 1;
+        }
+    }
+    cout.flush();
+
+    return result;
+
+}
@@ -0,0 +1,217 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdlib.h>
+
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <gtest/gtest.h>
+
+#include <rsc/config/ConfigCache.h>
+#include <rsc/config/Configuration.h>
+#include <rsc/config/OptionHandler.h>
+
+using namespace std;
+using namespace rsc::config;
+namespace fs = boost::filesystem;
+
+/**
+ * Records the options in the order they are passed.
+ */
+class RecordingHandler : public OptionHandler {
+public:
+    void handleOption(const vector<string>& key, const string& value) {
+        options.push_back(make_pair(key, value));
+    }
+    ConfigCache::Options options;
+};
+
+class ConfigCacheTest : public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        directory = fs::temp_directory_path()
+            / fs::unique_path("rsc-config-cache-%%%%-%%%%-%%%%");
+        fs::create_directories(directory);
+        cacheFile = directory / "options.cache";
+        sources.push_back(directory / "a.conf");
+        sources.push_back(directory / "missing.conf");
+
+        vector<string> key;
+        key.push_back("section");
+        key.push_back("option");
+        options.push_back(make_pair(key, "value"));
+        key.push_back("dotted.component");
+        options.push_back(make_pair(key, ""));
+
+        write(sources[0], "[section]\noption = value\n");
+    }
+
+    virtual void TearDown() {
+        fs::remove_all(directory);
+    }
+
+    /**
+     * Writes a file with a modification time in the past, so that it can be
+     * cached.
+     */
+    void write(const fs::path& file, const string& contents,
+               const time_t& age = 10) {
+        {
+            fs::ofstream stream(file, ios::out | ios::binary | ios::trunc);
+            stream << contents;
+        }
+        fs::last_write_time(file, time(0) - age);
+    }
+
+    bool replay() {
+        RecordingHandler handler;
+        const bool replayed = ConfigCache(cacheFile).replay(sources, handler);
+        if (replayed) {
+            EXPECT_EQ(options, handler.options);
+        } else {
+            EXPECT_TRUE(handler.options.empty());
+        }
+        return replayed;
+    }
+
+    fs::path directory;
+    fs::path cacheFile;
+    vector<fs::path> sources;
+    ConfigCache::Options options;
+
+};
+
+TEST_F(ConfigCacheTest, testReplay) {
+    EXPECT_FALSE(replay());
+    EXPECT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    EXPECT_TRUE(replay());
+    EXPECT_TRUE(replay());
+
+    // an empty option list is valid as well
+    options.clear();
+    EXPECT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    EXPECT_TRUE(replay());
+}
+
+TEST_F(ConfigCacheTest, testChangedSources) {
+    ASSERT_TRUE(ConfigCache(cacheFile).store(sources, options));
+
+    // same size and modification time, but different contents
+    const time_t modified = fs::last_write_time(sources[0]);
+    write(sources[0], "[section]\noption = other\n");
+    fs::last_write_time(sources[0], modified);
+    EXPECT_FALSE(replay());
+
+    ASSERT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    write(sources[1], "");
+    EXPECT_FALSE(replay());
+
+    ASSERT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    sources.pop_back();
+    EXPECT_FALSE(replay());
+
+    sources.push_back(directory / "other.conf");
+    EXPECT_FALSE(replay());
+}
+
+TEST_F(ConfigCacheTest, testRecentlyModifiedSource) {
+    write(sources[0], "[section]\noption = value\n", 0);
+    EXPECT_FALSE(ConfigCache(cacheFile).store(sources, options));
+    EXPECT_FALSE(fs::exists(cacheFile));
+}
+
+TEST_F(ConfigCacheTest, testCorruptCache) {
+    ASSERT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    const uintmax_t size = fs::file_size(cacheFile);
+
+    fs::resize_file(cacheFile, size - 1);
+    EXPECT_FALSE(replay());
+
+    ASSERT_TRUE(ConfigCache(cacheFile).store(sources, options));
+    {
+        fs::fstream stream(cacheFile, ios::in | ios::out | ios::binary);
+        stream.seekp(size - 2);
+        stream.put('X');
+    }
+    EXPECT_FALSE(replay());
+
+    write(cacheFile, "not a cache");
+    EXPECT_FALSE(replay());
+
+    EXPECT_THROW(ConfigCache(directory / "missing" / "cache").store(sources,
+                                                                   options),
+                 runtime_error);
+}
+
+TEST_F(ConfigCacheTest, testConfigure) {
+    setenv(DEFAULT_CACHE_VARIABLE_NAME.c_str(), cacheFile.string().c_str(), 1);
+
+    vector<string> files;
+    files.push_back(sources[0].string());
+    files.push_back(sources[1].string());
+
+    RecordingHandler first;
+    configure(first, "unused.conf", "RSC_CACHE_TEST_", 0, 0, true, "/",
+              DEFAULT_DEBUG_VARIABLE_NAME, files);
+    EXPECT_TRUE(fs::exists(cacheFile));
+
+    fs::remove(sources[0]);
+    write(sources[0], "[section]\noption = changed\n");
+    RecordingHandler second;
+    configure(second, "unused.conf", "RSC_CACHE_TEST_", 0, 0, true, "/",
+              DEFAULT_DEBUG_VARIABLE_NAME, files);
+
+    // the cache was written for the old file
+    fs::last_write_time(sources[0], time(0) - 20);
+    RecordingHandler third;
+    configure(third, "unused.conf", "RSC_CACHE_TEST_", 0, 0, true, "/",
+              DEFAULT_DEBUG_VARIABLE_NAME, files);
+    RecordingHandler fourth;
+    configure(fourth, "unused.conf", "RSC_CACHE_TEST_", 0, 0, true, "/",
+              DEFAULT_DEBUG_VARIABLE_NAME, files);
+
+    unsetenv(DEFAULT_CACHE_VARIABLE_NAME.c_str());
+
+    ASSERT_EQ(1u, first.options.size());
+    EXPECT_EQ("value", first.options[0].second);
+    ASSERT_EQ(1u, second.options.size());
+    EXPECT_EQ("changed", second.options[0].second);
+    EXPECT_EQ(second.options, third.options);
+    EXPECT_EQ(second.options, fourth.options);
+
+    // the last call replayed the options
+    RecordingHandler replayed;
+    EXPECT_TRUE(ConfigCache(cacheFile).replay(
+            vector<fs::path>(sources.begin(), sources.end()), replayed));
+    EXPECT_EQ(second.options, replayed.options);
+}
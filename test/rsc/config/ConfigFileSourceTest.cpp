@@ -25,14 +25,21 @@
  * ============================================================ */
 
 #include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
 
 #include <boost/format.hpp>
 
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
 #include <gtest/gtest.h>
 
 #include <rsc/config/OptionHandler.h>
 #include <rsc/config/ConfigFileSource.h>
 #include <rsc/config/CollectingOptionHandler.h>
+#include <rsc/config/MappedFile.h>
 #include <rsc/runtime/Properties.h>
 
 #include "testconfig.h"
@@ -45,6 +52,42 @@ using namespace rsc::runtime;
 class ConfigFileSourceEncodingTest : public ::testing::TestWithParam<string> {
 };
 
+/**
+ * Stores options with their keys as vectors.
+ */
+class KeyCollectingHandler : public OptionHandler {
+public:
+    void handleOption(const vector<string>& key, const string& value) {
+        options[key] = value;
+    }
+    map<vector<string>, string> options;
+};
+
+/**
+ * Exposes the reference implementation of key splitting.
+ */
+class KeySplittingSource : public ConfigSource {
+public:
+    void provideOptions(OptionHandler& /*handler*/) {
+    }
+    void split(const string& input, vector<string>& output) {
+        splitKeyAtDots(input, output);
+    }
+};
+
+vector<string> key(const string& a, const string& b = "",
+                   const string& c = "") {
+    vector<string> result;
+    result.push_back(a);
+    if (!b.empty()) {
+        result.push_back(b);
+    }
+    if (!c.empty()) {
+        result.push_back(c);
+    }
+    return result;
+}
+
 
 TEST_P(ConfigFileSourceEncodingTest, testSmoke)
 {
@@ -62,6 +105,18 @@ TEST_P(ConfigFileSourceEncodingTest, testSmoke)
     }
 }
 
+TEST_P(ConfigFileSourceEncodingTest, testSmokeMapped)
+{
+    ConfigFileSource source(
+            boost::filesystem::path(str(format("%1%/%2%") % TEST_ROOT % GetParam())));
+
+    CollectingOptionHandler handler;
+    source.provideOptions(handler);
+    EXPECT_EQ(any_cast<string>(handler.getOptions()["global"]), "5");
+    EXPECT_EQ(any_cast<string>(handler.getOptions()["string"]), "string");
+    EXPECT_EQ(any_cast<string>(handler.getOptions()["section1.option"]), "1.5");
+}
+
 INSTANTIATE_TEST_CASE_P(ValidFiles,
                         ConfigFileSourceEncodingTest,
                         ::testing::Values("smoke-unix.conf", "smoke-windows.conf"));
@@ -92,3 +147,134 @@ TEST(ConfigFileSourceTest, testEolError) {
         // good
     }
 }
+
+TEST(ConfigFileSourceTest, testMappedErrors) {
+    for (unsigned int i = 1; i <= 3; ++i) {
+        EXPECT_THROW(ConfigFileSource(boost::filesystem::path(
+                str(format("%1%/syntax-errors-%2%.conf") % TEST_ROOT % i))),
+                invalid_argument);
+    }
+    EXPECT_THROW(ConfigFileSource(boost::filesystem::path(
+            str(format("%1%/smoke-mac.conf") % TEST_ROOT))),
+            invalid_argument);
+    EXPECT_THROW(ConfigFileSource(boost::filesystem::path(
+            str(format("%1%/does-not-exist.conf") % TEST_ROOT))),
+            runtime_error);
+}
+
+TEST(ConfigFileSourceTest, testTruncatedFile) {
+    const boost::filesystem::path file = boost::filesystem::temp_directory_path()
+        / boost::filesystem::unique_path("rsc-config-file-%%%%-%%%%.conf");
+    {
+        ofstream stream(file.string().c_str());
+        stream << "a.b = 1" << endl << "c = 2" << endl;
+    }
+
+    // the contents are copied so that truncating the file by another
+    // writer does not affect them
+    MappedFile contents(file);
+    boost::filesystem::resize_file(file, 0);
+    EXPECT_EQ("a.b = 1\nc = 2\n", string(contents.begin(), contents.end()));
+
+    boost::filesystem::remove(file);
+}
+
+TEST(ConfigFileSourceTest, testSyntax) {
+    istringstream stream(
+            "# comment\n"
+            "global = 1 # trailing comment\n"
+            "\t spaced . key =  value with  spaces \r\n"
+            "\"quoted.part\".x = q\n"
+            "escaped\\.dot = e\n"
+            "\n"
+            "[section]\n"
+            "a = 1=2\n"
+            "[section.]\n"
+            "b =\n"
+            "[other.\"x.y\"]\n"
+            "c = 3\n"
+            "duplicate = 1\n"
+            "duplicate = 2");
+    ConfigFileSource source(stream);
+    KeyCollectingHandler handler;
+    source.provideOptions(handler);
+
+    map<vector<string>, string> expected;
+    expected[key("global")] = "1";
+    expected[key("spaced ", " key")] = "value with  spaces";
+    expected[key("quoted.part", "x")] = "q";
+    expected[key("escaped.dot")] = "e";
+    expected[key("section", "a")] = "1=2";
+    expected[key("section", "b")] = "";
+    expected[key("other", "x.y", "c")] = "3";
+    expected[key("other", "x.y", "duplicate")] = "2";
+    EXPECT_EQ(expected, handler.options);
+}
+
+TEST(ConfigFileSourceTest, testKeysMatchReference) {
+    // pairs of section header and key
+    const char* cases[][2] = {
+        { "", "a.b.c" },
+        { "", "a..b" },
+        { "", "a." },
+        { "", ".a" },
+        { "", "\"a.b\".c" },
+        { "", "a\\nb" },
+        { "", "a\\\\b" },
+        { "", "a\\q" },
+        { "", "a\\" },
+        { "", "\"a" },
+        { "", "" },
+        { "s", "" },
+        { "s", "k" },
+        { "s.", "k" },
+        { "s..", "k" },
+        { "", "k" },
+        { "\"s.", "k\"" },
+        { "s\\.", "k" },
+        { "s\\q", "a..b" },
+        { "s", "a\\q" },
+        { "s.", "a..b" }
+    };
+
+    for (unsigned int i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+        const string section = cases[i][0];
+        const string name = cases[i][1];
+        SCOPED_TRACE(section + " / " + name);
+
+        string fullName;
+        if (!section.empty()) {
+            fullName = section;
+            if (*fullName.rbegin() != '.') {
+                fullName += '.';
+            }
+        }
+        fullName += name;
+
+        string expectedError;
+        vector<string> expected;
+        try {
+            KeySplittingSource().split(fullName, expected);
+        } catch (const invalid_argument& e) {
+            expectedError = e.what();
+        }
+
+        string contents;
+        if (!section.empty()) {
+            contents += "[" + section + "]\n";
+        }
+        contents += name + " = value\n";
+        istringstream stream(contents);
+
+        try {
+            ConfigFileSource source(stream);
+            EXPECT_EQ("", expectedError);
+            KeyCollectingHandler handler;
+            source.provideOptions(handler);
+            ASSERT_EQ(1u, handler.options.size());
+            EXPECT_EQ(expected, handler.options.begin()->first);
+        } catch (const invalid_argument& e) {
+            EXPECT_EQ(expectedError, e.what());
+        }
+    }
+}
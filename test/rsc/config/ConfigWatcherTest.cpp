@@ -0,0 +1,326 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdlib.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include <rsc/config/ConfigWatcher.h>
+#include <rsc/config/OptionHandler.h>
+
+using namespace std;
+using namespace rsc::config;
+namespace fs = boost::filesystem;
+
+/**
+ * Records options received from the watcher thread.
+ */
+class WatchRecorder: public OptionHandler {
+public:
+    void handleOption(const vector<string>& key, const string& value) {
+        boost::mutex::scoped_lock lock(this->mutex);
+        string name;
+        for (vector<string>::const_iterator it = key.begin(); it != key.end();
+                ++it) {
+            name += (it == key.begin() ? "" : ".") + *it;
+        }
+        this->options.push_back(make_pair(name, value));
+    }
+
+    vector<pair<string, string> > getOptions() {
+        boost::mutex::scoped_lock lock(this->mutex);
+        return this->options;
+    }
+
+    /**
+     * Waits until at least @a count options have been received.
+     */
+    vector<pair<string, string> > waitFor(size_t count) {
+        for (unsigned int i = 0; i < 500; ++i) {
+            if (getOptions().size() >= count) {
+                break;
+            }
+            boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+        }
+        return getOptions();
+    }
+
+private:
+    boost::mutex mutex;
+    vector<pair<string, string> > options;
+};
+
+/**
+ * Uses the watcher from within its handler and removes itself after the
+ * first option.
+ */
+class ReentrantRecorder: public WatchRecorder {
+public:
+    explicit ReentrantRecorder(ConfigWatcher& watcher) :
+            watcher(watcher) {
+    }
+
+    void handleOption(const vector<string>& key, const string& value) {
+        WatchRecorder::handleOption(key, value);
+        EXPECT_FALSE(this->watcher.getOptions().empty());
+        EXPECT_EQ(0u, this->watcher.reload());
+        this->watcher.removeHandler(*this);
+    }
+
+private:
+    ConfigWatcher& watcher;
+};
+
+/**
+ * Records the batch boundaries as options with the names begin and
+ * commit.
+ */
+class BatchRecorder: public BatchOptionHandler {
+public:
+    void handleOption(const vector<string>& key, const string& value) {
+        this->recorder.handleOption(key, value);
+    }
+
+    void beginBatch() {
+        this->recorder.handleOption(vector<string>(1, "begin"), "");
+    }
+
+    void commitBatch() {
+        this->recorder.handleOption(vector<string>(1, "commit"), "");
+    }
+
+    WatchRecorder recorder;
+};
+
+class ConfigWatcherTest: public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        directory = fs::temp_directory_path()
+                / fs::unique_path("rsc-config-watcher-%%%%-%%%%-%%%%");
+        fs::create_directories(directory);
+        files.push_back((directory / "first.conf").string());
+        files.push_back((directory / "second.conf").string());
+    }
+
+    virtual void TearDown() {
+        fs::remove_all(directory);
+    }
+
+    void write(const string& file, const string& contents) {
+        // replace the file like editors do
+        const fs::path temporary = fs::path(file).string() + ".tmp";
+        {
+            fs::ofstream stream(temporary);
+            stream << contents;
+        }
+        fs::rename(temporary, file);
+    }
+
+    fs::path directory;
+    vector<string> files;
+};
+
+TEST_F(ConfigWatcherTest, testChangedOptions) {
+
+    write(files[0], "[a]\nx = 1\ny = 2\n");
+    write(files[1], "[a]\ny = 3\n");
+
+    ConfigWatcher watcher("unused.conf", "", 0, 0, 20, true, "/", files);
+    ASSERT_EQ(2u, watcher.getFiles().size());
+    EXPECT_EQ(2u, watcher.getOptions().size());
+
+    WatchRecorder recorder;
+    watcher.addHandler(recorder);
+
+    // overridden by the second file
+    write(files[0], "[a]\nx = 1\ny = 4\n");
+    // added to the second file
+    write(files[1], "[a]\ny = 3\nz = 5\n");
+
+    vector<pair<string, string> > options = recorder.waitFor(1);
+    ASSERT_EQ(1u, options.size());
+    EXPECT_EQ(make_pair(string("a.z"), string("5")), options[0]);
+
+    write(files[1], "[a]\nz = 6\n");
+    options = recorder.waitFor(3);
+    ASSERT_EQ(3u, options.size());
+    EXPECT_EQ(make_pair(string("a.y"), string("4")), options[1]);
+    EXPECT_EQ(make_pair(string("a.z"), string("6")), options[2]);
+    EXPECT_EQ(2u, watcher.getReloads());
+    EXPECT_EQ(0u, watcher.reload());
+
+    watcher.removeHandler(recorder);
+    write(files[1], "[a]\nz = 7\n");
+    EXPECT_LE(watcher.reload(), 1u);
+    vector<string> key;
+    key.push_back("a");
+    key.push_back("z");
+    EXPECT_EQ("7", watcher.getOptions()[key]);
+    EXPECT_EQ(3u, recorder.getOptions().size());
+
+}
+
+TEST_F(ConfigWatcherTest, testInvalidAndMissingFiles) {
+
+    ConfigWatcher watcher("unused.conf", "", 0, 0, 20, true, "/", files);
+    EXPECT_TRUE(watcher.getOptions().empty());
+
+    WatchRecorder recorder;
+    watcher.addHandler(recorder);
+
+    write(files[1], "[a\n");
+    EXPECT_THROW(watcher.reload(), invalid_argument);
+    EXPECT_TRUE(watcher.getOptions().empty());
+
+    write(files[1], "[a]\nb = c\n");
+    vector<pair<string, string> > options = recorder.waitFor(1);
+    ASSERT_EQ(1u, options.size());
+    EXPECT_EQ(make_pair(string("a.b"), string("c")), options[0]);
+
+    fs::remove(files[1]);
+    for (unsigned int i = 0; i < 500 && !watcher.getOptions().empty(); ++i) {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+    }
+    EXPECT_TRUE(watcher.getOptions().empty());
+    EXPECT_EQ(1u, recorder.getOptions().size());
+
+}
+
+TEST_F(ConfigWatcherTest, testReplay) {
+
+    write(files[0], "[a]\nx = 1\ny = 2\n");
+
+    ConfigWatcher watcher("unused.conf", "", 0, 0, 20, true, "/", files);
+    WatchRecorder recorder;
+    watcher.addHandler(recorder, true);
+
+    vector<pair<string, string> > options = recorder.getOptions();
+    ASSERT_EQ(2u, options.size());
+    EXPECT_EQ(make_pair(string("a.x"), string("1")), options[0]);
+    EXPECT_EQ(make_pair(string("a.y"), string("2")), options[1]);
+
+    write(files[0], "[a]\nx = 1\ny = 3\n");
+    options = recorder.waitFor(3);
+    ASSERT_EQ(3u, options.size());
+    EXPECT_EQ(make_pair(string("a.y"), string("3")), options[2]);
+
+}
+
+TEST_F(ConfigWatcherTest, testBatches) {
+
+    write(files[0], "[a]\nx = 1\n");
+
+    ConfigWatcher watcher("unused.conf", "", 0, 0, 20, true, "/", files);
+    BatchRecorder batches;
+    watcher.addHandler(batches, true);
+
+    write(files[0], "[a]\nx = 2\ny = 3\n");
+    vector<pair<string, string> > options = batches.recorder.waitFor(7);
+    ASSERT_EQ(7u, options.size());
+    EXPECT_EQ("begin", options[0].first);
+    EXPECT_EQ(make_pair(string("a.x"), string("1")), options[1]);
+    EXPECT_EQ("commit", options[2].first);
+    EXPECT_EQ("begin", options[3].first);
+    EXPECT_EQ(make_pair(string("a.x"), string("2")), options[4]);
+    EXPECT_EQ(make_pair(string("a.y"), string("3")), options[5]);
+    EXPECT_EQ("commit", options[6].first);
+
+}
+
+TEST_F(ConfigWatcherTest, testReentrantHandler) {
+
+    write(files[0], "[a]\nx = 1\n");
+
+    ConfigWatcher watcher("unused.conf", "", 0, 0, 20, true, "/", files);
+    ReentrantRecorder reentrant(watcher);
+    WatchRecorder recorder;
+    watcher.addHandler(reentrant);
+    watcher.addHandler(recorder);
+
+    write(files[0], "[a]\nx = 2\ny = 3\n");
+    vector<pair<string, string> > options = recorder.waitFor(2);
+    ASSERT_EQ(2u, options.size());
+    EXPECT_EQ(1u, reentrant.getOptions().size());
+
+    write(files[0], "[a]\nx = 4\n");
+    options = recorder.waitFor(3);
+    ASSERT_EQ(3u, options.size());
+    EXPECT_EQ(make_pair(string("a.x"), string("4")), options[2]);
+    EXPECT_EQ(1u, reentrant.getOptions().size());
+
+}
+
+TEST_F(ConfigWatcherTest, testEnvironmentOverrides) {
+
+    setenv("RSCWATCHTEST_A_B", "env", 1);
+    write(files[0], "[a]\nb = file\nc = file\n");
+
+    ConfigWatcher watcher("unused.conf", "RSCWATCHTEST_", 0, 0, 20, true,
+            "/", files);
+    WatchRecorder recorder;
+    watcher.addHandler(recorder);
+
+    write(files[0], "[a]\nb = changed\nc = changed\n");
+    vector<pair<string, string> > options = recorder.waitFor(1);
+    unsetenv("RSCWATCHTEST_A_B");
+
+    ASSERT_EQ(1u, options.size());
+    EXPECT_EQ(make_pair(string("a.c"), string("changed")), options[0]);
+
+}
+
+TEST_F(ConfigWatcherTest, testCommandLineOverrides) {
+
+    write(files[0], "[a]\nb = file\nc = file\n");
+
+    const char* argv[] = { "program", "-Da.b=cmd" };
+    ConfigWatcher watcher("unused.conf", "", 2, argv, 20, true, "/", files);
+    vector<string> key;
+    key.push_back("a");
+    key.push_back("b");
+    EXPECT_EQ("cmd", watcher.getOptions()[key]);
+
+    WatchRecorder recorder;
+    watcher.addHandler(recorder);
+
+    write(files[0], "[a]\nb = changed\nc = changed\n");
+    vector<pair<string, string> > options = recorder.waitFor(1);
+
+    ASSERT_EQ(1u, options.size());
+    EXPECT_EQ(make_pair(string("a.c"), string("changed")), options[0]);
+    EXPECT_EQ("cmd", watcher.getOptions()[key]);
+
+}
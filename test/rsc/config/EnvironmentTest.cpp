@@ -24,6 +24,8 @@
  *
  * ============================================================ */
 
+#include <stdlib.h>
+
 #include <fstream>
 
 #include <boost/format.hpp>
@@ -31,6 +33,7 @@
 #include <gtest/gtest.h>
 
 #include "rsc/config/Environment.h"
+#include "rsc/config/OptionHandler.h"
 
 using namespace std;
 using namespace boost;
@@ -58,3 +61,94 @@ TEST(EnvironmentTest, testUserConfigDirectory)
         // may happen if windows service
     }
 }
+
+TEST(EnvironmentTest, testGetEnvironmentVariable)
+{
+    unsetenv("RSC_ENVIRONMENT_TEST_VARIABLE");
+    EXPECT_FALSE(getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABLE"));
+
+    setenv("RSC_ENVIRONMENT_TEST_VARIABLE", "first", 1);
+    boost::shared_ptr<string> value
+        = getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABLE");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("first", *value);
+
+    setenv("RSC_ENVIRONMENT_TEST_VARIABLE", "second=with=separators", 1);
+    value = getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABLE");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("second=with=separators", *value);
+
+    setenv("RSC_ENVIRONMENT_TEST_VARIABLE", "", 1);
+    value = getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABLE");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("", *value);
+
+    unsetenv("RSC_ENVIRONMENT_TEST_VARIABLE");
+    EXPECT_FALSE(getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABLE"));
+    EXPECT_FALSE(getEnvironmentVariable("RSC_ENVIRONMENT_TEST_VARIABL"));
+    EXPECT_FALSE(getEnvironmentVariable(""));
+}
+
+TEST(EnvironmentTest, testRefreshEnvironment)
+{
+    setenv("RSC_ENVIRONMENT_TEST_REPLACED", "first", 1);
+    setenv("RSC_ENVIRONMENT_TEST_LAST", "last", 1);
+    boost::shared_ptr<string> value
+        = getEnvironmentVariable("RSC_ENVIRONMENT_TEST_REPLACED");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("first", *value);
+
+    setenv("RSC_ENVIRONMENT_TEST_REPLACED", "second", 1);
+    refreshEnvironment();
+    value = getEnvironmentVariable("RSC_ENVIRONMENT_TEST_REPLACED");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("second", *value);
+
+    unsetenv("RSC_ENVIRONMENT_TEST_REPLACED");
+    unsetenv("RSC_ENVIRONMENT_TEST_LAST");
+    EXPECT_FALSE(getEnvironmentVariable("RSC_ENVIRONMENT_TEST_REPLACED"));
+}
+
+class CollectingHandler : public OptionHandler {
+public:
+    void handleOption(const vector<string>& key, const string& value) {
+        this->options[key] = value;
+    }
+    map<vector<string>, string> options;
+};
+
+TEST(EnvironmentTest, testEnvironmentVariableSource)
+{
+    setenv("RSCENVTEST_A", "1", 1);
+    setenv("RSCENVTEST_B_C", "2", 1);
+    setenv("RSCENVTESTX", "3", 1);
+    setenv("RSCENVTES", "4", 1);
+
+    EnvironmentVariableSource source("RSCENVTEST_");
+    EnvironmentVariableSource::Matches matches = source.getMatches();
+    ASSERT_EQ(2u, matches.size());
+    EXPECT_EQ("RSCENVTEST_A", matches[0].getRawName());
+    EXPECT_EQ("a", matches[0].getTransformedName());
+    EXPECT_EQ("1", matches[0].getValue());
+    EXPECT_EQ("RSCENVTEST_B_C", matches[1].getRawName());
+    EXPECT_EQ("b_c", matches[1].getTransformedName());
+
+    CollectingHandler handler;
+    source.provideOptions(handler);
+    vector<string> key;
+    key.push_back("b");
+    key.push_back("c");
+    EXPECT_EQ(2u, handler.options.size());
+    EXPECT_EQ("2", handler.options[key]);
+
+    EnvironmentVariableSource unstripped("RSCENVTEST", false);
+    EXPECT_EQ(3u, unstripped.getMatches().size());
+    EXPECT_EQ("rscenvtest_b_c", unstripped.getMatches()[2].getTransformedName());
+
+    unsetenv("RSCENVTEST_A");
+    unsetenv("RSCENVTEST_B_C");
+    unsetenv("RSCENVTESTX");
+    unsetenv("RSCENVTES");
+
+    EXPECT_TRUE(EnvironmentVariableSource("RSCENVTEST_").getMatches().empty());
+}
@@ -0,0 +1,201 @@
+/* ============================================================
+ *
+ * This file is part of the RSC project
+ *
+ * Copyright (C) 2026 Jan Moringen <jmoringe@techfak.uni-bielefeld.de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <gtest/gtest.h>
+
+#include <rsc/config/OptionSchema.h>
+
+using namespace std;
+using namespace rsc::config;
+
+/**
+ * Records the keys and values received through the schema.
+ */
+template<class T>
+class Recorder {
+public:
+    void receive(const vector<string>& key, const T& value) {
+        string name;
+        for (vector<string>::const_iterator it = key.begin(); it != key.end();
+                ++it) {
+            name += (it == key.begin() ? "" : ".") + *it;
+        }
+        received.push_back(make_pair(name, value));
+    }
+
+    void declare(OptionSchema& schema, const string& pattern) {
+        schema.addOption<T>(this, pattern,
+                boost::bind(&Recorder<T>::receive, this, _1, _2));
+    }
+
+    vector<pair<string, T> > received;
+};
+
+/**
+ * Counts conversions to verify that values are converted only once.
+ */
+struct Counted {
+    int value;
+    static int conversions;
+};
+
+int Counted::conversions = 0;
+
+namespace rsc {
+namespace config {
+
+template<>
+struct OptionValueConverter<Counted> {
+    static Counted convert(const string& value) {
+        ++Counted::conversions;
+        Counted result;
+        result.value = boost::lexical_cast<int>(value);
+        return result;
+    }
+};
+
+}
+}
+
+vector<string> key(const string& dotted) {
+    vector<string> result;
+    string::size_type start = 0;
+    string::size_type end;
+    while ((end = dotted.find('.', start)) != string::npos) {
+        result.push_back(dotted.substr(start, end - start));
+        start = end + 1;
+    }
+    result.push_back(dotted.substr(start));
+    return result;
+}
+
+TEST(OptionSchemaTest, testPatterns) {
+    OptionSchema schema;
+    Recorder<string> literal;
+    literal.declare(schema, "a.b.c");
+    Recorder<string> any;
+    any.declare(schema, "a.*.c");
+    Recorder<string> rest;
+    rest.declare(schema, "a.**.c");
+    Recorder<string> all;
+    all.declare(schema, "**");
+
+    schema.handleOption(key("a.b.c"), "1");
+    schema.handleOption(key("a.x.c"), "2");
+    schema.handleOption(key("a.c"), "3");
+    schema.handleOption(key("a.x.y.c"), "4");
+    schema.handleOption(key("b.b.c"), "5");
+    schema.handleOption(key("A.b.c"), "6");
+
+    ASSERT_EQ(1u, literal.received.size());
+    EXPECT_EQ(make_pair(string("a.b.c"), string("1")), literal.received[0]);
+    ASSERT_EQ(2u, any.received.size());
+    EXPECT_EQ("a.b.c", any.received[0].first);
+    EXPECT_EQ("a.x.c", any.received[1].first);
+    ASSERT_EQ(4u, rest.received.size());
+    EXPECT_EQ("a.c", rest.received[2].first);
+    EXPECT_EQ("a.x.y.c", rest.received[3].first);
+    EXPECT_EQ(6u, all.received.size());
+}
+
+TEST(OptionSchemaTest, testCaseInsensitive) {
+    OptionSchema schema(false);
+    Recorder<string> recorder;
+    recorder.declare(schema, "rsc.Logging.level");
+
+    schema.handleOption(key("RSC.logging.LEVEL"), "DEBUG");
+    schema.handleOption(key("rsc.logging"), "DEBUG");
+
+    ASSERT_EQ(1u, recorder.received.size());
+    EXPECT_EQ("RSC.logging.LEVEL", recorder.received[0].first);
+    EXPECT_EQ("DEBUG", recorder.received[0].second);
+}
+
+TEST(OptionSchemaTest, testGroups) {
+    OptionSchema schema;
+    Recorder<string> recorder;
+    schema.addOption<string>(&recorder, "x.path",
+            boost::bind(&Recorder<string>::receive, &recorder, _1, _2));
+    schema.addOption<string>(&recorder, "x.*",
+            boost::bind(&Recorder<string>::receive, &recorder, _1, _2));
+    schema.addOption<string>(&recorder, "x.**",
+            boost::bind(&Recorder<string>::receive, &recorder, _1, _2));
+    Recorder<string> other;
+    other.declare(schema, "x.*");
+
+    schema.handleOption(key("x.path"), "1");
+    schema.handleOption(key("x.load"), "2");
+    schema.handleOption(key("x.y.z"), "3");
+
+    // only the most specific pattern of a group receives an option
+    ASSERT_EQ(3u, recorder.received.size());
+    EXPECT_EQ("x.path", recorder.received[0].first);
+    EXPECT_EQ("x.load", recorder.received[1].first);
+    EXPECT_EQ("x.y.z", recorder.received[2].first);
+    EXPECT_EQ(2u, other.received.size());
+}
+
+TEST(OptionSchemaTest, testConversion) {
+    OptionSchema schema;
+    Recorder<unsigned int> number;
+    number.declare(schema, "n");
+    Recorder<double> real;
+    real.declare(schema, "*");
+    Recorder<string> raw;
+    raw.declare(schema, "**");
+
+    schema.handleOption(key("n"), " 42 ");
+    ASSERT_EQ(1u, number.received.size());
+    EXPECT_EQ(42u, number.received[0].second);
+    ASSERT_EQ(1u, real.received.size());
+    EXPECT_EQ(42.0, real.received[0].second);
+    ASSERT_EQ(1u, raw.received.size());
+    EXPECT_EQ(" 42 ", raw.received[0].second);
+
+    EXPECT_THROW(schema.handleOption(key("n"), "many"), invalid_argument);
+    EXPECT_EQ(1u, number.received.size());
+
+    // values are converted at most once per type
+    Recorder<Counted> first;
+    first.declare(schema, "c.*");
+    Recorder<Counted> second;
+    second.declare(schema, "c.d");
+    Counted::conversions = 0;
+    schema.handleOption(key("c.d"), "7");
+    EXPECT_EQ(1, Counted::conversions);
+    ASSERT_EQ(1u, first.received.size());
+    EXPECT_EQ(7, first.received[0].second.value);
+    ASSERT_EQ(1u, second.received.size());
+    EXPECT_EQ(7, second.received[0].second.value);
+}
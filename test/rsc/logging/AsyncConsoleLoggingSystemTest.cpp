@@ -0,0 +1,342 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/AsyncConsoleLoggingSystem.h"
+#include "rsc/logging/ConsoleLoggingSystem.h"
+#include "rsc/logging/LoggerFactory.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+
+/**
+ * A stream buffer collecting its output which blocks writers while it is
+ * closed.
+ */
+class GatedStreamBuffer: public streambuf {
+public:
+
+    GatedStreamBuffer() :
+            open(false), entered(false) {
+    }
+
+    void setOpen(bool open) {
+        boost::mutex::scoped_lock lock(mutex);
+        this->open = open;
+        condition.notify_all();
+    }
+
+    void waitEntered() {
+        boost::mutex::scoped_lock lock(mutex);
+        while (!entered) {
+            condition.wait(lock);
+        }
+    }
+
+    string getContents() {
+        boost::mutex::scoped_lock lock(mutex);
+        return contents;
+    }
+
+protected:
+
+    int overflow(int c) {
+        boost::mutex::scoped_lock lock(mutex);
+        entered = true;
+        condition.notify_all();
+        while (!open) {
+            condition.wait(lock);
+        }
+        contents.push_back((char) c);
+        return c;
+    }
+
+private:
+
+    boost::mutex mutex;
+    boost::condition condition;
+    bool open;
+    bool entered;
+    string contents;
+
+};
+
+static vector<string> lines(const string& text) {
+    vector<string> result;
+    boost::algorithm::split(result, text, boost::algorithm::is_any_of("\n"));
+    if (!result.empty() && result.back().empty()) {
+        result.pop_back();
+    }
+    return result;
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testFormatAndOrder) {
+
+    stringstream stream;
+    AsyncConsoleLoggingSystem system(stream, 16,
+            AsyncLogWriter::OVERFLOW_BLOCK);
+    LoggerPtr logger = system.createLogger("a.test");
+    EXPECT_EQ("a.test", logger->getName());
+    EXPECT_EQ(Logger::LEVEL_INFO, logger->getLevel());
+
+    const unsigned int numMessages = 100;
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        logger->info(boost::lexical_cast<string>(i));
+    }
+    logger->debug("filtered");
+    logger->setName("renamed");
+    logger->error("last");
+    system.getWriter()->flush();
+
+    vector<string> output = lines(stream.str());
+    ASSERT_EQ(size_t(numMessages + 1), output.size());
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        EXPECT_TRUE(boost::algorithm::ends_with(output[i],
+                        " a.test [INFO]: " + boost::lexical_cast<string>(i)))
+                << output[i];
+    }
+    EXPECT_TRUE(boost::algorithm::ends_with(output.back(),
+                    " renamed [ERROR]: last")) << output.back();
+
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testDeferredMessages) {
+
+    stringstream stream;
+    AsyncConsoleLoggingSystem system(stream, 16,
+            AsyncLogWriter::OVERFLOW_BLOCK);
+    LoggerPtr logger = system.createLogger("deferred");
+
+    for (unsigned int i = 0; i < 50; ++i) {
+        RSCINFO_DEFERRED(logger, "value " << i << " " << std::hex << i);
+        RSCDEBUG_DEFERRED(logger, "filtered");
+        logger->info("direct");
+    }
+    system.getWriter()->flush();
+
+    vector<string> output = lines(stream.str());
+    ASSERT_EQ(size_t(100), output.size());
+    for (unsigned int i = 0; i < 50; ++i) {
+        stringstream expected;
+        expected << " deferred [INFO]: value " << i << " " << std::hex << i;
+        EXPECT_TRUE(boost::algorithm::ends_with(output[2 * i],
+                        expected.str())) << output[2 * i];
+        EXPECT_TRUE(boost::algorithm::ends_with(output[2 * i + 1],
+                        " deferred [INFO]: direct")) << output[2 * i + 1];
+    }
+
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testDropPolicy) {
+
+    GatedStreamBuffer buffer;
+    ostream stream(&buffer);
+    AsyncConsoleLoggingSystem system(stream, 4, AsyncLogWriter::OVERFLOW_DROP);
+    LoggerPtr logger = system.createLogger("drop");
+
+    // stall the writer inside the first message
+    logger->info("first");
+    buffer.waitEntered();
+
+    for (unsigned int i = 0; i < 10; ++i) {
+        logger->info("more");
+    }
+    EXPECT_EQ(boost::uint64_t(6), system.getWriter()->getDroppedRecords());
+
+    buffer.setOpen(true);
+    system.getWriter()->flush();
+    EXPECT_EQ(size_t(5), lines(buffer.getContents()).size());
+
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testCountPolicy) {
+
+    GatedStreamBuffer buffer;
+    ostream stream(&buffer);
+    AsyncConsoleLoggingSystem system(stream, 4,
+            AsyncLogWriter::OVERFLOW_COUNT);
+    LoggerPtr logger = system.createLogger("count");
+
+    logger->info("first");
+    buffer.waitEntered();
+
+    for (unsigned int i = 0; i < 10; ++i) {
+        logger->info("more");
+    }
+    EXPECT_EQ(boost::uint64_t(6), system.getWriter()->getDroppedRecords());
+
+    buffer.setOpen(true);
+    system.getWriter()->flush();
+    // the report is written with the batch following the overflow
+    logger->info("after");
+    system.getWriter()->flush();
+
+    vector<string> output = lines(buffer.getContents());
+    ASSERT_EQ(size_t(7), output.size());
+    EXPECT_NE(string::npos,
+            buffer.getContents().find(
+                    "[WARN]: 6 log messages were dropped"));
+    EXPECT_TRUE(boost::algorithm::ends_with(output.back(), "[INFO]: after"));
+
+}
+
+static void logMessages(LoggerPtr logger, unsigned int count) {
+    for (unsigned int i = 0; i < count; ++i) {
+        logger->info("blocking");
+    }
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testBlockPolicy) {
+
+    GatedStreamBuffer buffer;
+    ostream stream(&buffer);
+    AsyncConsoleLoggingSystem system(stream, 2,
+            AsyncLogWriter::OVERFLOW_BLOCK);
+    LoggerPtr logger = system.createLogger("block");
+
+    logger->info("first");
+    buffer.waitEntered();
+
+    boost::thread producer(boost::bind(&logMessages, logger, 20));
+    EXPECT_FALSE(producer.timed_join(boost::posix_time::milliseconds(100)));
+
+    buffer.setOpen(true);
+    producer.join();
+    system.getWriter()->flush();
+
+    EXPECT_EQ(boost::uint64_t(0), system.getWriter()->getDroppedRecords());
+    EXPECT_EQ(size_t(21), lines(buffer.getContents()).size());
+
+}
+
+/**
+ * A sink counting written records and flushes.
+ */
+class CountingSink: public LogRecordSink {
+public:
+
+    CountingSink() :
+            records(0), flushedRecords(0), flushes(0) {
+    }
+
+    void write(const vector<LogRecord>& records) {
+        boost::mutex::scoped_lock lock(mutex);
+        this->records += records.size();
+    }
+
+    void flush() {
+        boost::mutex::scoped_lock lock(mutex);
+        flushedRecords = records;
+        ++flushes;
+        condition.notify_all();
+    }
+
+    bool waitFlushed(size_t count, unsigned int timeoutMs) {
+        const boost::system_time timeout = boost::get_system_time()
+                + boost::posix_time::milliseconds(timeoutMs);
+        boost::mutex::scoped_lock lock(mutex);
+        while (flushedRecords < count) {
+            if (!condition.timed_wait(lock, timeout)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t getFlushedRecords() {
+        boost::mutex::scoped_lock lock(mutex);
+        return flushedRecords;
+    }
+
+    size_t getFlushes() {
+        boost::mutex::scoped_lock lock(mutex);
+        return flushes;
+    }
+
+private:
+
+    boost::mutex mutex;
+    boost::condition condition;
+    size_t records;
+    size_t flushedRecords;
+    size_t flushes;
+
+};
+
+TEST(AsyncConsoleLoggingSystemTest, testFlushInterval) {
+
+    boost::shared_ptr<CountingSink> sink(new CountingSink);
+    AsyncLogWriter writer(sink);
+
+    LogRecord record;
+    record.level = Logger::LEVEL_INFO;
+    record.message = "light load";
+
+    // records arriving one by one are flushed together once the writer
+    // is idle
+    for (unsigned int i = 0; i < 20; ++i) {
+        writer.append(record);
+        boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+    }
+    EXPECT_TRUE(sink->waitFlushed(20, 5000));
+    EXPECT_LT(sink->getFlushes(), size_t(20));
+
+    // explicit flushes do not wait for the interval
+    writer.append(record);
+    writer.flush();
+    EXPECT_EQ(size_t(21), sink->getFlushedRecords());
+
+}
+
+TEST(AsyncConsoleLoggingSystemTest, testSelection) {
+
+    LoggerFactory& factory = LoggerFactory::getInstance();
+    factory.reselectLoggingSystem();
+    EXPECT_EQ(ConsoleLoggingSystem::getName(),
+            factory.getLoggingSystemName());
+
+    factory.reselectLoggingSystem(AsyncConsoleLoggingSystem::getName());
+    EXPECT_EQ(AsyncConsoleLoggingSystem::getName(),
+            factory.getLoggingSystemName());
+    factory.getLogger("rsc.test.async")->trace("not shown");
+
+    factory.reselectLoggingSystem(LoggerFactory::DEFAULT_LOGGING_SYSTEM);
+    EXPECT_EQ(ConsoleLoggingSystem::getName(),
+            factory.getLoggingSystemName());
+
+}
@@ -0,0 +1,216 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/BinaryLoggingSystem.h"
+#include "rsc/logging/BinaryLogReader.h"
+#include "rsc/logging/StreamLogRecordSink.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+namespace fs = boost::filesystem;
+
+class BinaryLoggingSystemTest: public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        directory = fs::temp_directory_path()
+                / fs::unique_path("rsc-binary-logging-%%%%-%%%%-%%%%");
+        fs::create_directories(directory);
+        options.path = directory / "test.binlog";
+    }
+
+    virtual void TearDown() {
+        fs::remove_all(directory);
+    }
+
+    static string readFile(const fs::path& file) {
+        fs::ifstream stream(file, ios::in | ios::binary);
+        return string((istreambuf_iterator<char>(stream)),
+                istreambuf_iterator<char>());
+    }
+
+    static vector<LogRecord> decode(const string& data) {
+        istringstream stream(data);
+        BinaryLogReader reader(stream);
+        vector<LogRecord> records;
+        LogRecord record;
+        while (reader.next(record)) {
+            records.push_back(record);
+        }
+        return records;
+    }
+
+    static size_t countOccurrences(const string& data, const string& pattern) {
+        size_t count = 0;
+        for (size_t pos = data.find(pattern); pos != string::npos;
+                pos = data.find(pattern, pos + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    fs::path directory;
+    FileLogRecordSink::Options options;
+
+};
+
+TEST_F(BinaryLoggingSystemTest, testRoundTrip) {
+
+    BinaryLoggingSystem system(options);
+    LoggerPtr first = system.createLogger("binary.first");
+    LoggerPtr second = system.createLogger("binary.second");
+    for (unsigned int i = 0; i < 10; ++i) {
+        first->info("message " + boost::lexical_cast<string>(i));
+        RSCWARN_DEFERRED(second, "deferred " << i << " " << 1.5);
+    }
+    first->debug("filtered");
+    second->error("");
+    system.getWriter()->flush();
+
+    const string data = readFile(options.path);
+    // names are only written once per file
+    EXPECT_EQ(size_t(1), countOccurrences(data, "binary.first"));
+    EXPECT_EQ(size_t(1), countOccurrences(data, "binary.second"));
+
+    vector<LogRecord> records = decode(data);
+    ASSERT_EQ(size_t(21), records.size());
+    for (unsigned int i = 0; i < 10; ++i) {
+        const LogRecord& info = records[2 * i];
+        EXPECT_EQ("binary.first", *info.loggerName);
+        EXPECT_EQ(Logger::LEVEL_INFO, info.level);
+        EXPECT_EQ("message " + boost::lexical_cast<string>(i), info.message);
+        EXPECT_NE(0u, info.threadId);
+        EXPECT_NE(0u, info.timestamp);
+
+        const LogRecord& warn = records[2 * i + 1];
+        EXPECT_EQ("binary.second", *warn.loggerName);
+        EXPECT_EQ(Logger::LEVEL_WARN, warn.level);
+        EXPECT_EQ("deferred " + boost::lexical_cast<string>(i) + " 1.5",
+                warn.message);
+        EXPECT_EQ(info.threadId, warn.threadId);
+    }
+    EXPECT_EQ(Logger::LEVEL_ERROR, records.back().level);
+    EXPECT_EQ("", records.back().message);
+
+    // decoded records have the text layout
+    stringstream text;
+    StreamLogRecordSink::format(text, records.front());
+    EXPECT_EQ(boost::lexical_cast<string>(records.front().timestamp)
+            + " binary.first [INFO]: message 0\n", text.str());
+
+}
+
+TEST_F(BinaryLoggingSystemTest, testAppendAndRotation) {
+
+    options.maxSize = 500;
+    options.maxFiles = 0;
+    {
+        BinaryLoggingSystem system(options);
+        system.createLogger("before")->info("existing");
+    }
+
+    BinaryLoggingSystem system(options);
+    LoggerPtr logger = system.createLogger("rotation");
+    const unsigned int numMessages = 100;
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        logger->info(boost::lexical_cast<string>(i));
+    }
+    system.getWriter()->flush();
+    system.getSink()->waitForMaintenance();
+
+    vector<fs::path> files;
+    for (fs::directory_iterator it(directory); it != fs::directory_iterator();
+            ++it) {
+        if (it->path() != options.path) {
+            files.push_back(it->path());
+        }
+    }
+    sort(files.begin(), files.end());
+    files.push_back(options.path);
+    ASSERT_GT(files.size(), size_t(2));
+
+    // each file can be decoded on its own and the concatenation as well
+    string concatenated;
+    vector<LogRecord> records;
+    for (vector<fs::path>::const_iterator it = files.begin();
+            it != files.end(); ++it) {
+        const string data = readFile(*it);
+        EXPECT_GE(data.size(), 8u);
+        vector<LogRecord> fileRecords = decode(data);
+        EXPECT_FALSE(fileRecords.empty());
+        records.insert(records.end(), fileRecords.begin(), fileRecords.end());
+        concatenated += data;
+    }
+    EXPECT_EQ(records.size(), decode(concatenated).size());
+
+    ASSERT_EQ(size_t(numMessages + 1), records.size());
+    EXPECT_EQ("before", *records[0].loggerName);
+    EXPECT_EQ("existing", records[0].message);
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        EXPECT_EQ("rotation", *records[i + 1].loggerName);
+        EXPECT_EQ(boost::lexical_cast<string>(i), records[i + 1].message);
+    }
+
+}
+
+TEST_F(BinaryLoggingSystemTest, testInvalidInput) {
+
+    EXPECT_THROW(decode("not a binary log"), runtime_error);
+    EXPECT_THROW(decode(""), runtime_error);
+
+    BinaryLoggingSystem system(options);
+    system.createLogger("truncated")->info("some message");
+    system.getWriter()->flush();
+    const string data = readFile(options.path);
+    ASSERT_EQ(size_t(1), decode(data).size());
+
+    EXPECT_THROW(decode(data.substr(0, data.size() - 1)), runtime_error);
+    string corrupt = data;
+    corrupt[16] = 42;
+    EXPECT_THROW(decode(corrupt), runtime_error);
+
+}
+
+TEST_F(BinaryLoggingSystemTest, testRegistered) {
+    EXPECT_EQ("BinaryLoggingSystem",
+            loggingSystemRegistry()->getRegistree(
+                    BinaryLoggingSystem::getName())->getRegistryKey());
+    EXPECT_EQ("rsc.binlog", BinaryLoggingSystem().getOptions().path.string());
+}
@@ -0,0 +1,277 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <signal.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/CrashRingLoggingSystem.h"
+#include "rsc/logging/DeferredMessage.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+namespace fs = boost::filesystem;
+
+class CrashRingLoggingSystemTest: public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        directory = fs::temp_directory_path()
+                / fs::unique_path("rsc-crashring-logging-%%%%-%%%%-%%%%");
+        fs::create_directories(directory);
+        path = directory / "crash.log";
+    }
+
+    virtual void TearDown() {
+        fs::remove_all(directory);
+    }
+
+    static string readFile(const fs::path& file) {
+        fs::ifstream stream(file);
+        return string((istreambuf_iterator<char>(stream)),
+                istreambuf_iterator<char>());
+    }
+
+    static string dump(CrashRingLoggingSystem& system) {
+        stringstream stream;
+        system.dump(stream);
+        return stream.str();
+    }
+
+    static void logUniformMessages(LoggerPtr logger,
+            boost::atomic<bool>* stop) {
+        for (unsigned int i = 0; !stop->load(); ++i) {
+            logger->trace(string(CrashRingLoggingSystem::MAX_MESSAGE_LENGTH,
+                    'a' + i % 26));
+        }
+    }
+
+    static void logMessages(LoggerPtr logger, const string& prefix,
+            const unsigned int& count) {
+        for (unsigned int i = 0; i < count; ++i) {
+            logger->trace(prefix + boost::lexical_cast<string>(i) + ";");
+        }
+    }
+
+    fs::path directory;
+    fs::path path;
+
+};
+
+TEST_F(CrashRingLoggingSystemTest, testKeepsLastRecords) {
+
+    CrashRingLoggingSystem system(path.string(), 4, false);
+    LoggerPtr logger = system.createLogger("a.logger");
+    logger->setLevel(Logger::LEVEL_TRACE);
+
+    logMessages(logger, "message", 10);
+
+    const string contents = dump(system);
+    for (unsigned int i = 0; i < 6; ++i) {
+        EXPECT_EQ(string::npos,
+                contents.find("message" + boost::lexical_cast<string>(i) + ";"));
+    }
+    EXPECT_NE(string::npos,
+            contents.find("a.logger [TRACE]: message6;\n"));
+    EXPECT_LT(contents.find("message6;"), contents.find("message7;"));
+    EXPECT_LT(contents.find("message8;"), contents.find("message9;"));
+
+    // nothing is written unless requested
+    EXPECT_FALSE(fs::exists(path));
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testLevelAndDeferredMessages) {
+
+    CrashRingLoggingSystem system(path.string(), 16, false);
+    LoggerPtr logger = system.createLogger("deferred");
+    logger->setLevel(Logger::LEVEL_DEBUG);
+
+    logger->trace("invisible");
+    DeferredMessage message;
+    message << "value " << 42;
+    logger->logDeferred(Logger::LEVEL_DEBUG, message);
+    logger->debug(string(1000, 'x'));
+
+    const string contents = dump(system);
+    EXPECT_EQ(string::npos, contents.find("invisible"));
+    EXPECT_NE(string::npos, contents.find("deferred [DEBUG]: value 42\n"));
+    EXPECT_NE(string::npos,
+            contents.find(
+                    string(CrashRingLoggingSystem::MAX_MESSAGE_LENGTH, 'x')
+                            + "\n"));
+    EXPECT_EQ(string::npos,
+            contents.find(
+                    string(CrashRingLoggingSystem::MAX_MESSAGE_LENGTH + 1,
+                            'x')));
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testRingPerThread) {
+
+    CrashRingLoggingSystem system(path.string(), 2, false);
+    LoggerPtr logger = system.createLogger("threads");
+    logger->setLevel(Logger::LEVEL_TRACE);
+
+    logMessages(logger, "main", 3);
+    boost::thread first(
+            boost::bind(&CrashRingLoggingSystemTest::logMessages, logger,
+                    "first", 5));
+    first.join();
+    boost::thread second(
+            boost::bind(&CrashRingLoggingSystemTest::logMessages, logger,
+                    "second", 1));
+    second.join();
+
+    // the ring of the first thread has been reused by the second one
+    const string contents = dump(system);
+    EXPECT_EQ(string::npos, contents.find("first3;"));
+    EXPECT_NE(string::npos, contents.find("first4;"));
+    EXPECT_NE(string::npos, contents.find("second0;"));
+    EXPECT_EQ(string::npos, contents.find("main0;"));
+    EXPECT_NE(string::npos, contents.find("main1;"));
+    EXPECT_NE(string::npos, contents.find("main2;"));
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testConcurrentDumpSkipsTornRecords) {
+
+    CrashRingLoggingSystem system(path.string(), 4, false);
+    LoggerPtr logger = system.createLogger("torn");
+    logger->setLevel(Logger::LEVEL_TRACE);
+
+    boost::atomic<bool> stop(false);
+    boost::thread writer(
+            boost::bind(&CrashRingLoggingSystemTest::logUniformMessages,
+                    logger, &stop));
+
+    for (unsigned int i = 0; i < 2000; ++i) {
+        stringstream contents(dump(system));
+        string line;
+        while (getline(contents, line)) {
+            const string message = line.substr(line.find("]: ") + 3);
+            ASSERT_EQ(CrashRingLoggingSystem::MAX_MESSAGE_LENGTH,
+                    message.size());
+            ASSERT_EQ(string::npos,
+                    message.find_first_not_of(message[0])) << line;
+        }
+    }
+
+    stop = true;
+    writer.join();
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testDumpOnFatal) {
+
+    CrashRingLoggingSystem system(path.string(), 8, false);
+    LoggerPtr logger = system.createLogger("fatal");
+    logger->setLevel(Logger::LEVEL_TRACE);
+
+    logger->trace("before");
+    EXPECT_FALSE(fs::exists(path));
+    logger->fatal("broken");
+
+    const string contents = readFile(path);
+    EXPECT_NE(string::npos, contents.find("fatal message"));
+    EXPECT_NE(string::npos, contents.find("fatal [TRACE]: before\n"));
+    EXPECT_NE(string::npos, contents.find("fatal [FATAL]: broken\n"));
+    EXPECT_NE(string::npos, contents.find("Backtrace:\n"));
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testDumpOnDemand) {
+
+    CrashRingLoggingSystem system(path.string(), 8, false);
+    LoggerPtr logger = system.createLogger("demand");
+    logger->info("first");
+    system.dump("one");
+    logger->info("second");
+    system.dump("two");
+
+    const string contents = readFile(path);
+    EXPECT_LT(contents.find(": one ==="), contents.find(": two ==="));
+    EXPECT_LT(contents.find(": two ==="), contents.find("second"));
+    EXPECT_EQ(string::npos, contents.find("Backtrace:"));
+
+    CrashRingLoggingSystem broken((directory / "missing" / "file").string(),
+            8, false);
+    EXPECT_THROW(broken.dump("fail"), runtime_error);
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testDumpOnSignal) {
+
+    CrashRingLoggingSystem system(path.string(), 8, true);
+    LoggerPtr logger = system.createLogger("signal");
+    logger->info("last words");
+    DeferredMessage message;
+    message << "deferred " << 42;
+    logger->logDeferred(Logger::LEVEL_WARN, message);
+
+    EXPECT_DEATH(raise(SIGSEGV), "");
+
+    const string contents = readFile(path);
+    EXPECT_NE(string::npos,
+            contents.find(": signal " + boost::lexical_cast<string>(SIGSEGV)));
+    EXPECT_NE(string::npos, contents.find("signal [INFO]: last words\n"));
+    EXPECT_NE(string::npos, contents.find("signal [WARN]: deferred 42\n"));
+    EXPECT_NE(string::npos, contents.find("Backtrace:\n"));
+
+}
+
+TEST_F(CrashRingLoggingSystemTest, testOptions) {
+
+    CrashRingLoggingSystem system;
+    EXPECT_EQ("rsc-crash.log", system.getPath());
+    EXPECT_EQ(CrashRingLoggingSystem::DEFAULT_RECORDS, system.getRecords());
+
+    system.setOption("Path", path.string());
+    system.setOption("records", " 32 ");
+    system.setOption("signals", "off");
+    EXPECT_EQ(path.string(), system.getPath());
+    EXPECT_EQ(32u, system.getRecords());
+
+    EXPECT_THROW(system.setOption("records", "0"), invalid_argument);
+    EXPECT_THROW(system.setOption("records", "many"), invalid_argument);
+    EXPECT_THROW(system.setOption("signals", "maybe"), invalid_argument);
+    EXPECT_THROW(system.setOption("unknown", "1"), invalid_argument);
+    EXPECT_THROW(CrashRingLoggingSystem(path.string(), 0), invalid_argument);
+
+}
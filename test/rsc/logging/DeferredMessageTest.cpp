@@ -0,0 +1,228 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "rsc/logging/DeferredMessage.h"
+#include "rsc/logging/Logger.h"
+
+#include "mocks.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+using namespace testing;
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+};
+
+ostream& operator<<(ostream& stream, const Point& point) {
+    return stream << "(" << point.x << ", " << point.y << ")";
+}
+
+/**
+ * A type which logs a deferred message itself while being formatted.
+ */
+struct Nested {
+};
+
+ostream& operator<<(ostream& stream, const Nested& /*nested*/) {
+    DeferredMessage inner;
+    inner << "inner" << Point();
+    return stream << "nested:" << inner.str();
+}
+
+}
+
+TEST(DeferredMessageTest, testEquivalentToStream) {
+
+    const string text = "text";
+    char buffer[] = "buffer";
+    const Point point = { 3, -4 };
+    const void* pointer = &point;
+
+    DeferredMessage message;
+    stringstream expected;
+
+#define BOTH(args) \
+    message << args; \
+    expected << args;
+
+    BOTH(true << ' ' << 'c' << (signed char) 'd' << (unsigned char) 'e');
+    BOTH((short) -12 << (unsigned short) 13 << -14 << 15u << -16l << 17ul);
+    BOTH((boost::long_long_type) -18 << (boost::ulong_long_type) 19);
+    BOTH(1.5f << " " << 2.25 << " " << (long double) 3.125);
+    BOTH(pointer << "literal" << text << buffer << (const char*) "pointer");
+    BOTH(std::hex << -1 << (short) -1 << std::dec << 42);
+    BOTH(std::boolalpha << false << std::endl << std::scientific << 1.0);
+    BOTH(point << Logger::LEVEL_WARN);
+
+#undef BOTH
+
+    EXPECT_FALSE(message.empty());
+    EXPECT_FALSE(message.isTruncated());
+    EXPECT_EQ(expected.str(), message.str());
+
+}
+
+TEST(DeferredMessageTest, testManipulatorsDoNotLeak) {
+
+    DeferredMessage message;
+    message << std::hex << 255;
+
+    stringstream stream;
+    stream << message << " " << 255;
+    EXPECT_EQ("ff 255", stream.str());
+
+    // a formatted argument must not see state of previous ones
+    DeferredMessage setter;
+    setter << Point() << std::hex;
+    DeferredMessage next;
+    const Point point = { 10, 11 };
+    next << point;
+    EXPECT_EQ("(10, 11)", next.str());
+
+}
+
+TEST(DeferredMessageTest, testEmptyAndClear) {
+
+    DeferredMessage message;
+    EXPECT_TRUE(message.empty());
+    EXPECT_EQ("", message.str());
+
+    message << 42;
+    EXPECT_FALSE(message.empty());
+    message.clear();
+    EXPECT_TRUE(message.empty());
+
+    message << (const char*) 0;
+    EXPECT_EQ("(null)", message.str());
+
+}
+
+TEST(DeferredMessageTest, testCopy) {
+
+    DeferredMessage message;
+    message << "value " << 42;
+    DeferredMessage copy(message);
+    DeferredMessage assigned;
+    assigned << "something else";
+    assigned = copy;
+    EXPECT_EQ("value 42", copy.str());
+    EXPECT_EQ("value 42", assigned.str());
+
+}
+
+TEST(DeferredMessageTest, testTruncation) {
+
+    const string longText(DeferredMessage::CAPACITY * 2, 'x');
+
+    DeferredMessage message;
+    message << "start " << longText << 42;
+    EXPECT_TRUE(message.isTruncated());
+    const string result = message.str();
+    EXPECT_EQ(0u, result.find("start xxx"));
+    EXPECT_EQ(result.size() - 4, result.find("x..."));
+    EXPECT_LT(result.size(), DeferredMessage::CAPACITY + 3);
+
+    DeferredMessage formatted;
+    const Point point = { 1, 2 };
+    for (unsigned int i = 0; i < DeferredMessage::CAPACITY; ++i) {
+        formatted << point;
+    }
+    EXPECT_TRUE(formatted.isTruncated());
+    EXPECT_EQ(formatted.str().size() - 3, formatted.str().find("..."));
+
+    DeferredMessage numbers;
+    for (unsigned int i = 0; i < DeferredMessage::CAPACITY; ++i) {
+        numbers << 'a';
+    }
+    EXPECT_TRUE(numbers.isTruncated());
+
+}
+
+TEST(DeferredMessageTest, testFormatSignalSafe) {
+
+    char buffer[DeferredMessage::CAPACITY * 2];
+
+    DeferredMessage message;
+    message << "int " << -42 << " unsigned " << 42u << " long "
+            << -1234567890123ll << " char " << 'c' << " bool " << true
+            << " double " << 1.5 << " " << -0.25f << " " << 1e20
+            << " pointer " << (const void*) 0 << " " << string("text")
+            << hex << 255 << endl;
+    EXPECT_EQ("int -42 unsigned 42 long -1234567890123 char c bool 1"
+            " double 1.5 -0.25 1e+20 pointer 0 text255\n",
+            string(buffer, message.formatSignalSafe(buffer, sizeof(buffer))));
+
+    DeferredMessage pointer;
+    pointer << (const void*) 0x1f;
+    EXPECT_EQ("0x1f",
+            string(buffer, pointer.formatSignalSafe(buffer, sizeof(buffer))));
+
+    EXPECT_EQ("int -4", string(buffer, message.formatSignalSafe(buffer, 6)));
+
+    DeferredMessage truncated;
+    truncated << string(DeferredMessage::CAPACITY * 2, 'x');
+    const size_t length = truncated.formatSignalSafe(buffer, sizeof(buffer));
+    EXPECT_EQ(truncated.str(), string(buffer, length));
+
+}
+
+TEST(DeferredMessageTest, testNestedFormatting) {
+
+    DeferredMessage message;
+    message << "outer " << Nested() << " " << Point();
+    EXPECT_EQ("outer nested:inner(0, 0) (0, 0)", message.str());
+
+}
+
+TEST(DeferredMessageTest, testMacros) {
+
+    boost::shared_ptr<StubLogger> logger(new StubLogger("deferred"));
+    logger->setLevel(Logger::LEVEL_INFO);
+
+    RSCDEBUG_DEFERRED(logger, "not logged " << 1);
+    RSCINFO_DEFERRED(logger, "value " << 2);
+    RSCERROR_DEFERRED(logger, "error " << 3.5);
+
+    ASSERT_EQ(size_t(2), logger->logs.size());
+    EXPECT_EQ(Logger::LEVEL_INFO, logger->logs[0].first);
+    EXPECT_EQ("value 2", logger->logs[0].second);
+    EXPECT_EQ(Logger::LEVEL_ERROR, logger->logs[1].first);
+    EXPECT_EQ("error 3.5", logger->logs[1].second);
+
+}
@@ -0,0 +1,279 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/FileLoggingSystem.h"
+#include "rsc/logging/OptionBasedConfigurator.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+namespace fs = boost::filesystem;
+
+class FileLoggingSystemTest: public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        directory = fs::temp_directory_path()
+                / fs::unique_path("rsc-file-logging-%%%%-%%%%-%%%%");
+        fs::create_directories(directory);
+        options.path = directory / "test.log";
+    }
+
+    virtual void TearDown() {
+        fs::remove_all(directory);
+    }
+
+    vector<fs::path> rotatedFiles() {
+        vector<fs::path> files;
+        for (fs::directory_iterator it(options.path.parent_path());
+                it != fs::directory_iterator(); ++it) {
+            if (it->path() != options.path) {
+                files.push_back(it->path());
+            }
+        }
+        sort(files.begin(), files.end());
+        return files;
+    }
+
+    static vector<string> readLines(const fs::path& file) {
+        fs::ifstream stream(file);
+        vector<string> lines;
+        string line;
+        while (getline(stream, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    fs::path directory;
+    FileLogRecordSink::Options options;
+
+};
+
+TEST_F(FileLoggingSystemTest, testWrite) {
+
+    FileLoggingSystem system(options);
+    LoggerPtr logger = system.createLogger("file.test");
+    logger->info("first");
+    RSCWARN_DEFERRED(logger, "second " << 2);
+    logger->debug("filtered");
+    system.getWriter()->flush();
+
+    vector<string> lines = readLines(options.path);
+    ASSERT_EQ(size_t(2), lines.size());
+    EXPECT_TRUE(boost::algorithm::ends_with(lines[0], " file.test [INFO]: first"))
+            << lines[0];
+    EXPECT_TRUE(boost::algorithm::ends_with(lines[1],
+                    " file.test [WARN]: second 2")) << lines[1];
+
+}
+
+TEST_F(FileLoggingSystemTest, testSizeRotation) {
+
+    options.maxSize = 1000;
+    options.maxFiles = 3;
+    options.path = directory / "nested" / "test.log";
+    FileLoggingSystem system(options);
+    LoggerPtr logger = system.createLogger("rotation");
+
+    const unsigned int numMessages = 300;
+    for (unsigned int i = 0; i < numMessages; ++i) {
+        logger->info("message number " + boost::lexical_cast<string>(i));
+    }
+    system.getWriter()->flush();
+    system.getSink()->waitForMaintenance();
+
+    vector<fs::path> files = rotatedFiles();
+    ASSERT_EQ(size_t(3), files.size());
+    for (vector<fs::path>::const_iterator it = files.begin();
+            it != files.end(); ++it) {
+        EXPECT_GE(fs::file_size(*it), 1000u);
+        EXPECT_LT(fs::file_size(*it), 1100u);
+    }
+
+    // the newest messages must be there without gaps
+    files.push_back(options.path);
+    vector<string> lines;
+    for (vector<fs::path>::const_iterator it = files.begin();
+            it != files.end(); ++it) {
+        vector<string> fileLines = readLines(*it);
+        lines.insert(lines.end(), fileLines.begin(), fileLines.end());
+    }
+    ASSERT_FALSE(lines.empty());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const unsigned int expected = numMessages - lines.size() + i;
+        EXPECT_TRUE(boost::algorithm::ends_with(lines[i],
+                        "message number " + boost::lexical_cast<string>(expected)))
+                << lines[i];
+    }
+
+}
+
+TEST_F(FileLoggingSystemTest, testTimeRotation) {
+
+    options.maxAge = 1;
+    FileLoggingSystem system(options);
+    LoggerPtr logger = system.createLogger("time");
+
+    logger->warn("before");
+    system.getWriter()->flush();
+    EXPECT_TRUE(rotatedFiles().empty());
+
+    boost::this_thread::sleep(boost::posix_time::milliseconds(1100));
+    logger->warn("after");
+    system.getWriter()->flush();
+    system.getSink()->waitForMaintenance();
+
+    vector<fs::path> files = rotatedFiles();
+    ASSERT_EQ(size_t(1), files.size());
+    EXPECT_EQ(size_t(1), readLines(files.front()).size());
+    EXPECT_EQ(size_t(1), readLines(options.path).size());
+
+}
+
+TEST_F(FileLoggingSystemTest, testCompression) {
+
+    if (!FileLogRecordSink::isCompressionSupported()) {
+        options.compress = true;
+        EXPECT_THROW(FileLogRecordSink sink(options), invalid_argument);
+        return;
+    }
+
+    options.maxSize = 500;
+    options.maxFiles = 0;
+    FileLoggingSystem system(options);
+    LoggerPtr logger = system.createLogger("compression");
+    system.setOption("compress", "true");
+
+    for (unsigned int i = 0; i < 100; ++i) {
+        logger->error("compressed message " + boost::lexical_cast<string>(i));
+    }
+    system.getWriter()->flush();
+    system.getSink()->waitForMaintenance();
+
+    vector<fs::path> files = rotatedFiles();
+    ASSERT_GE(files.size(), size_t(5));
+    for (vector<fs::path>::const_iterator it = files.begin();
+            it != files.end(); ++it) {
+        EXPECT_EQ(".gz", it->extension().string());
+        EXPECT_LT(fs::file_size(*it), 500u);
+    }
+
+}
+
+TEST_F(FileLoggingSystemTest, testOptions) {
+
+    FileLoggingSystem system(options);
+
+    system.setOption("maxSize", "2k");
+    EXPECT_EQ(2048u, system.getOptions().maxSize);
+    system.setOption("MAXSIZE", "3M");
+    EXPECT_EQ(3u * 1024 * 1024, system.getOptions().maxSize);
+    system.setOption("maxage", "60");
+    EXPECT_EQ(60u, system.getOptions().maxAge);
+    system.setOption("maxfiles", "7");
+    EXPECT_EQ(7u, system.getOptions().maxFiles);
+    system.setOption("buffersize", "1024");
+    EXPECT_EQ(1024u, system.getOptions().bufferSize);
+
+    EXPECT_THROW(system.setOption("maxsize", "huge"), invalid_argument);
+    EXPECT_THROW(system.setOption("maxfiles", "-"), invalid_argument);
+    EXPECT_THROW(system.setOption("overflow", "explode"), invalid_argument);
+    EXPECT_THROW(system.setOption("unknown", "1"), invalid_argument);
+    EXPECT_EQ(7u, system.getOptions().maxFiles);
+
+    system.setOption("overflow", "drop");
+    EXPECT_EQ(AsyncLogWriter::OVERFLOW_DROP,
+            system.getWriter()->getOverflowPolicy());
+    system.setOption("overflow", "count");
+    EXPECT_EQ(AsyncLogWriter::OVERFLOW_COUNT,
+            system.getWriter()->getOverflowPolicy());
+
+    // changing the path while running switches the file
+    LoggerPtr logger = system.createLogger("switch");
+    logger->warn("old");
+    system.getWriter()->flush();
+    system.setOption("path", (directory / "other.log").string());
+    logger->warn("new");
+    system.getWriter()->flush();
+    EXPECT_EQ(size_t(1), readLines(options.path).size());
+    EXPECT_EQ(size_t(1), readLines(directory / "other.log").size());
+
+}
+
+TEST_F(FileLoggingSystemTest, testConfigurator) {
+
+    boost::shared_ptr<FileLoggingSystem> registered =
+            boost::dynamic_pointer_cast<FileLoggingSystem>(
+                    loggingSystemRegistry()->getRegistree(
+                            FileLoggingSystem::getName()));
+    ASSERT_TRUE(registered);
+    const FileLogRecordSink::Options oldOptions = registered->getOptions();
+
+    OptionBasedConfigurator configurator;
+    vector<string> key;
+    key.push_back("rsc");
+    key.push_back("logging");
+    key.push_back("file");
+    key.push_back("path");
+    configurator.handleOption(key, options.path.string());
+    key.back() = "maxFiles";
+    configurator.handleOption(key, "12");
+
+    EXPECT_EQ(options.path, registered->getOptions().path);
+    EXPECT_EQ(12u, registered->getOptions().maxFiles);
+
+    key.back() = "maxSize";
+    EXPECT_THROW(configurator.handleOption(key, "invalid"), invalid_argument);
+
+    // unknown settings, e.g. from unrelated environment variables, are ignored
+    key.back() = "foo";
+    EXPECT_NO_THROW(configurator.handleOption(key, "bar"));
+    key[2] = "binary";
+    EXPECT_NO_THROW(configurator.handleOption(key, "bar"));
+    key[2] = "crashring";
+    EXPECT_NO_THROW(configurator.handleOption(key, "bar"));
+    key.back() = "records";
+    EXPECT_THROW(configurator.handleOption(key, "none"), invalid_argument);
+
+    registered->setOption("path", oldOptions.path.string());
+    registered->setOption("maxfiles",
+            boost::lexical_cast<string>(oldOptions.maxFiles));
+
+}
@@ -24,11 +24,14 @@
  *
  * ============================================================ */
 
+#include <map>
 #include <stdexcept>
 #include <vector>
 
+#include <boost/atomic.hpp>
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/thread.hpp>
 #include <boost/algorithm/string.hpp>
 
@@ -37,6 +40,7 @@
 
 #include "rsc/logging/ConsoleLoggingSystem.h"
 #include "rsc/logging/LoggerFactory.h"
+#include "rsc/logging/LoggerProxy.h"
 #include "rsc/misc/langutils.h"
 
 #include "mocks.h"
@@ -62,6 +66,59 @@ TEST(LoggerFactoryTest, testSingletonLoggers) {
             LoggerFactory::getInstance().getLogger(name.str() + "blubb"));
 }
 
+static void getLoggers(const vector<string>& names,
+        vector<LoggerPtr>& result) {
+    for (unsigned int round = 0; round < 10; ++round) {
+        for (size_t i = 0; i < names.size(); ++i) {
+            LoggerPtr logger = LoggerFactory::getInstance().getLogger(
+                    names[i]);
+            if (round == 0) {
+                result.push_back(logger);
+            } else if (result[i] != logger) {
+                result[i].reset();
+            }
+        }
+    }
+}
+
+TEST(LoggerFactoryTest, testConcurrentCachedLookups) {
+
+    LoggerFactory::killInstance();
+
+    vector<string> names;
+    for (unsigned int i = 0; i < 500; ++i) {
+        names.push_back("cache." + boost::lexical_cast<string>(i % 50) + "."
+                + boost::lexical_cast<string>(i));
+    }
+
+    const unsigned int numThreads = 4;
+    vector<vector<LoggerPtr> > results(numThreads);
+    boost::thread_group threads;
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        threads.create_thread(
+                boost::bind(&getLoggers, boost::cref(names),
+                        boost::ref(results[i])));
+    }
+    threads.join_all();
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        LoggerPtr logger = LoggerFactory::getInstance().getLogger(names[i]);
+        EXPECT_EQ(names[i], logger->getName());
+        for (unsigned int t = 0; t < numThreads; ++t) {
+            EXPECT_EQ(logger, results[t][i]);
+        }
+    }
+
+    // case variants share the logger but are separate cache entries
+    EXPECT_EQ(LoggerFactory::getInstance().getLogger("cache.1.1"),
+            LoggerFactory::getInstance().getLogger("CACHE.1.1"));
+
+    LoggerPtr before = LoggerFactory::getInstance().getLogger(names.front());
+    LoggerFactory::getInstance().clearKnownLoggers();
+    EXPECT_NE(before, LoggerFactory::getInstance().getLogger(names.front()));
+
+}
+
 TEST(LoggerFactoryTest, testReconfigure) {
     LoggerFactory::getInstance().reconfigure(Logger::LEVEL_ERROR);
     stringstream name;
@@ -204,6 +261,182 @@ TEST(LoggerFactoryTest, testHierarchicalLevels) {
 
 }
 
+TEST(LoggerFactoryTest, testCachedLevelsFollowTree) {
+
+    LoggerFactory::killInstance();
+
+    LoggerProxyPtr parent = boost::dynamic_pointer_cast<LoggerProxy>(
+            LoggerFactory::getInstance().getLogger("cached"));
+    LoggerProxyPtr child = boost::dynamic_pointer_cast<LoggerProxy>(
+            LoggerFactory::getInstance().getLogger("cached.child"));
+    ASSERT_TRUE(parent);
+    ASSERT_TRUE(child);
+
+    parent->setLevel(Logger::LEVEL_TRACE);
+    EXPECT_TRUE(child->isTraceEnabled());
+    EXPECT_EQ(Logger::LEVEL_TRACE, child->getLogger()->getLevel());
+
+    LoggerFactory::getInstance().reconfigure(Logger::LEVEL_ERROR);
+    EXPECT_FALSE(parent->isWarnEnabled());
+    EXPECT_FALSE(child->isWarnEnabled());
+    EXPECT_TRUE(child->isErrorEnabled());
+    EXPECT_EQ(Logger::LEVEL_ERROR, child->getLogger()->getLevel());
+
+    LoggerFactory::getInstance().reselectLoggingSystem(
+            LoggerFactory::DEFAULT_LOGGING_SYSTEM);
+    EXPECT_EQ(Logger::LEVEL_ERROR, child->getLevel());
+    EXPECT_EQ(Logger::LEVEL_ERROR, child->getLogger()->getLevel());
+
+}
+
+void checkLevels(LoggerProxyPtr logger, boost::atomic<bool>& stop,
+        boost::atomic<unsigned int>& invalid) {
+    while (!stop) {
+        const Logger::Level level = logger->getLevel();
+        if (level != Logger::LEVEL_TRACE && level != Logger::LEVEL_ERROR
+                && level != Logger::LEVEL_DEBUG) {
+            ++invalid;
+        }
+    }
+}
+
+TEST(LoggerFactoryTest, testLevelSnapshots) {
+
+    LoggerFactory::killInstance();
+    LoggerFactory& factory = LoggerFactory::getInstance();
+
+    LoggerProxyPtr parent = boost::dynamic_pointer_cast<LoggerProxy>(
+            factory.getLogger("snapshot"));
+    LoggerProxyPtr child = boost::dynamic_pointer_cast<LoggerProxy>(
+            factory.getLogger("snapshot.child"));
+    ASSERT_TRUE(parent);
+    ASSERT_TRUE(child);
+
+    // levels can be assigned before a logger exists
+    map<string, Logger::Level> levels;
+    levels["snapshot"] = Logger::LEVEL_DEBUG;
+    levels["Later.Logger"] = Logger::LEVEL_FATAL;
+    factory.setLevels(levels);
+    EXPECT_EQ(Logger::LEVEL_DEBUG, parent->getLevel());
+    EXPECT_EQ(Logger::LEVEL_DEBUG, child->getLevel());
+    EXPECT_EQ(Logger::LEVEL_DEBUG, child->getLogger()->getLevel());
+    EXPECT_EQ(Logger::LEVEL_FATAL,
+            factory.getLogger("later.logger.child")->getLevel());
+
+    // concurrent level checks always see one of the assigned levels
+    boost::atomic<bool> stop(false);
+    boost::atomic<unsigned int> invalid(0);
+    boost::thread_group readers;
+    for (unsigned int i = 0; i < 4; ++i) {
+        readers.create_thread(
+                boost::bind(&checkLevels, child, boost::ref(stop),
+                        boost::ref(invalid)));
+    }
+    for (unsigned int i = 0; i < 1000; ++i) {
+        factory.setLevel("snapshot",
+                i % 2 ? Logger::LEVEL_TRACE : Logger::LEVEL_ERROR);
+    }
+    stop = true;
+    readers.join_all();
+    EXPECT_EQ(0u, invalid.load());
+    EXPECT_EQ(Logger::LEVEL_TRACE, child->getLevel());
+    EXPECT_EQ(Logger::LEVEL_TRACE, child->getLogger()->getLevel());
+
+    LoggerFactory::killInstance();
+
+}
+
+void refreshLevel(LoggerProxyPtr logger, boost::barrier& start) {
+    start.wait();
+    logger->getLevel();
+}
+
+TEST(LoggerFactoryTest, testConcurrentRefreshKeepsNewestLevel) {
+
+    LoggerFactory::killInstance();
+    LoggerFactory& factory = LoggerFactory::getInstance();
+
+    LoggerProxyPtr logger = boost::dynamic_pointer_cast<LoggerProxy>(
+            factory.getLogger("refresh.child"));
+    ASSERT_TRUE(logger);
+
+    // several threads refresh the cached level at once after each change
+    const unsigned int numThreads = 4;
+    for (unsigned int i = 0; i < 200; ++i) {
+        const Logger::Level level =
+                i % 2 ? Logger::LEVEL_TRACE : Logger::LEVEL_ERROR;
+        factory.setLevel("refresh", level);
+
+        boost::barrier start(numThreads);
+        boost::thread_group threads;
+        for (unsigned int j = 0; j < numThreads; ++j) {
+            threads.create_thread(
+                    boost::bind(&refreshLevel, logger, boost::ref(start)));
+        }
+        threads.join_all();
+
+        ASSERT_EQ(level, logger->getLevel());
+        ASSERT_EQ(level, logger->getLogger()->getLevel());
+    }
+
+    LoggerFactory::killInstance();
+
+}
+
+TEST(LoggerFactoryTest, testRateLimitInheritance) {
+
+    LoggerFactory::killInstance();
+    LoggerFactory& factory = LoggerFactory::getInstance();
+
+    LoggerProxyPtr child = boost::dynamic_pointer_cast<LoggerProxy>(
+            factory.getLogger("limited.child"));
+    ASSERT_TRUE(child);
+    boost::shared_ptr<StubLogger> stub(new StubLogger("limited.child"));
+    child->setLogger(stub);
+    child->setLoggerLevel(Logger::LEVEL_INFO);
+
+    // sampling is inherited by existing and new children
+    factory.setRateLimit("limited", RateLimit(0, 0, 3));
+    EXPECT_EQ(RateLimit(0, 0, 3), factory.getRateLimit("limited.child"));
+    EXPECT_EQ(RateLimit(0, 0, 3), factory.getRateLimit("limited.new.child"));
+    EXPECT_EQ(RateLimit(), factory.getRateLimit("unlimited"));
+    for (unsigned int i = 0; i < 9; ++i) {
+        child->info("sampled");
+    }
+    // disabled messages do not count
+    child->debug("disabled");
+    EXPECT_EQ(size_t(3), stub->logs.size());
+    EXPECT_EQ(6u, factory.getSuppressedMessages("limited.child"));
+    EXPECT_EQ(0u, factory.getSuppressedMessages("limited"));
+
+    // a token bucket only lets the burst pass at once
+    factory.setRateLimit("limited", RateLimit(0.001, 5));
+    stub->logs.clear();
+    RSCINFO_DEFERRED(child, "first");
+    for (unsigned int i = 0; i < 20; ++i) {
+        child->info("bucket");
+    }
+    EXPECT_EQ(size_t(5), stub->logs.size());
+    EXPECT_EQ(6u + 16u, factory.getSuppressedMessages("limited.child"));
+
+    // an assigned limit is not overridden by parents
+    factory.setRateLimit("limited.child", RateLimit());
+    factory.setRateLimit("limited", RateLimit(0, 0, 100));
+    EXPECT_EQ(RateLimit(), factory.getRateLimit("limited.child"));
+    EXPECT_EQ(RateLimit(0, 0, 100), factory.getRateLimit("limited.new"));
+    stub->logs.clear();
+    for (unsigned int i = 0; i < 10; ++i) {
+        child->info("unlimited");
+    }
+    EXPECT_EQ(size_t(10), stub->logs.size());
+
+    EXPECT_THROW(factory.setRateLimit("limited", RateLimit(-1)),
+            invalid_argument);
+
+    LoggerFactory::killInstance();
+
+}
+
 TEST(LoggerFactoryTest, testRootLoggerCorrectLevelAfterReselect) {
 
     LoggerFactory::killInstance();
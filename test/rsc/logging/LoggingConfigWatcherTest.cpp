@@ -0,0 +1,104 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/LoggerFactory.h"
+#include "rsc/logging/LoggingConfigWatcher.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+namespace fs = boost::filesystem;
+
+class LoggingConfigWatcherTest: public ::testing::Test {
+protected:
+
+    virtual void SetUp() {
+        LoggerFactory::killInstance();
+        file = fs::temp_directory_path()
+                / fs::unique_path("rsc-logging-watch-%%%%-%%%%-%%%%.conf");
+    }
+
+    virtual void TearDown() {
+        fs::remove(file);
+        LoggerFactory::killInstance();
+    }
+
+    void writeFile(const string& contents) {
+        fs::ofstream stream(file);
+        stream << contents;
+    }
+
+    fs::path file;
+
+};
+
+TEST_F(LoggingConfigWatcherTest, testReload) {
+
+    writeFile("[rsc.logging]\nlevel = ERROR\nwatched.level = DEBUG\n");
+    LoggerPtr watched = Logger::getLogger("watched");
+    LoggerPtr child = Logger::getLogger("watched.child");
+
+    LoggingConfigWatcher watcher(file.string(), 10);
+    EXPECT_EQ(file.string(), watcher.getFileName());
+    EXPECT_EQ(Logger::LEVEL_DEBUG, watched->getLevel());
+    EXPECT_EQ(Logger::LEVEL_DEBUG, child->getLevel());
+    EXPECT_EQ(Logger::LEVEL_ERROR, Logger::getLogger("")->getLevel());
+    EXPECT_EQ(0u, watcher.getReloads());
+
+    // the size differs, hence the change is detected within one second
+    writeFile("[rsc.logging]\nwatched.level = TRACE\nwatched.child.level = INFO\n");
+    for (unsigned int i = 0; i < 500 && watcher.getReloads() == 0; ++i) {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+    }
+    ASSERT_EQ(1u, watcher.getReloads());
+    EXPECT_EQ(Logger::LEVEL_TRACE, watched->getLevel());
+    EXPECT_EQ(Logger::LEVEL_INFO, child->getLevel());
+    EXPECT_EQ(Logger::LEVEL_ERROR, Logger::getLogger("")->getLevel());
+
+}
+
+TEST_F(LoggingConfigWatcherTest, testMissingFile) {
+
+    LoggingConfigWatcher watcher(file.string(), 10);
+    EXPECT_EQ(LoggerFactory::DEFAULT_LEVEL, Logger::getLogger("")->getLevel());
+
+    writeFile("[rsc.logging]\nlevel = FATAL\n");
+    for (unsigned int i = 0; i < 500 && watcher.getReloads() == 0; ++i) {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(10));
+    }
+    ASSERT_EQ(1u, watcher.getReloads());
+    EXPECT_EQ(Logger::LEVEL_FATAL, Logger::getLogger("")->getLevel());
+
+}
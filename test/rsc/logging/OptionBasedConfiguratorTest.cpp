@@ -34,6 +34,7 @@
 #include <gmock/gmock.h>
 
 #include "rsc/config/ConfigFileSource.h"
+#include "rsc/config/OptionSchema.h"
 #include "rsc/logging/LoggerFactory.h"
 #include "rsc/logging/OptionBasedConfigurator.h"
 
@@ -140,3 +141,83 @@ TEST(OptionBasedConfiguratorTest, testCaseInsensitiveSettings) {
     EXPECT_EQ(Logger::LEVEL_TRACE, Logger::getLogger("sub.foo")->getLevel());
 
 }
+
+TEST(OptionBasedConfiguratorTest, testRateLimits) {
+
+    LoggerFactory::killInstance();
+
+    OptionBasedConfigurator configurator;
+    vector<string> key = OptionBasedConfigurator::getDefaultRootOption();
+    key.push_back("limited");
+    key.push_back("ratelimit");
+    configurator.handleOption(key, "100:20");
+    key.back() = "SAMPLING";
+    configurator.handleOption(key, "10");
+
+    EXPECT_EQ(RateLimit(100, 20, 10),
+            LoggerFactory::getInstance().getRateLimit("limited.child"));
+
+    key.back() = "ratelimit";
+    configurator.handleOption(key, "off");
+    EXPECT_EQ(RateLimit(0, 0, 10),
+            LoggerFactory::getInstance().getRateLimit("limited"));
+
+    EXPECT_THROW(configurator.handleOption(key, "fast"), invalid_argument);
+    EXPECT_THROW(configurator.handleOption(key, "-1"), invalid_argument);
+
+    LoggerFactory::killInstance();
+
+}
+
+TEST(OptionBasedConfiguratorTest, testBatch) {
+
+    LoggerFactory::killInstance();
+
+    OptionBasedConfigurator configurator;
+    vector<string> key = OptionBasedConfigurator::getDefaultRootOption();
+    key.push_back("batched");
+    key.push_back("level");
+
+    configurator.beginBatch();
+    configurator.handleOption(key, "DEBUG");
+    EXPECT_EQ(LoggerFactory::DEFAULT_LEVEL,
+            Logger::getLogger("batched")->getLevel());
+    configurator.handleOption(key, "TRACE");
+    configurator.commitBatch();
+    EXPECT_EQ(Logger::LEVEL_TRACE, Logger::getLogger("batched")->getLevel());
+
+    // outside of a batch settings are applied immediately
+    configurator.handleOption(key, "INFO");
+    EXPECT_EQ(Logger::LEVEL_INFO, Logger::getLogger("batched")->getLevel());
+
+    LoggerFactory::killInstance();
+
+}
+
+TEST(OptionBasedConfiguratorTest, testSharedSchema) {
+
+    LoggerFactory::killInstance();
+
+    OptionBasedConfigurator configurator;
+    OptionSchema schema(false);
+    configurator.declareOptions(schema);
+
+    vector<string> key = OptionBasedConfigurator::getDefaultRootOption();
+    key.push_back("File");
+    key.push_back("Level");
+    schema.handleOption(key, "WARN");
+    EXPECT_EQ(Logger::LEVEL_WARN, Logger::getLogger("file")->getLevel());
+
+    key[2] = "sampled";
+    key.back() = "sampling";
+    EXPECT_THROW(schema.handleOption(key, "often"), invalid_argument);
+
+    key.pop_back();
+    key.back() = "level";
+    schema.handleOption(key, "ERROR");
+    EXPECT_EQ(Logger::LEVEL_ERROR,
+            LoggerFactory::getInstance().getLogger()->getLevel());
+
+    LoggerFactory::killInstance();
+
+}
@@ -0,0 +1,84 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/logging/RateLimiter.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::logging;
+
+TEST(RateLimiterTest, testUnlimited) {
+    EXPECT_FALSE(RateLimit().isLimited());
+    RateLimiter limiter((RateLimit()));
+    for (unsigned int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(limiter.accept());
+    }
+}
+
+TEST(RateLimiterTest, testSampling) {
+    RateLimiter limiter(RateLimit(0, 0, 4));
+    unsigned int accepted = 0;
+    for (unsigned int i = 0; i < 100; ++i) {
+        if (limiter.accept()) {
+            EXPECT_EQ(0u, i % 4);
+            ++accepted;
+        }
+    }
+    EXPECT_EQ(25u, accepted);
+}
+
+TEST(RateLimiterTest, testTokenBucket) {
+
+    // 50 messages per second with a burst of 10
+    RateLimiter limiter(RateLimit(50, 10));
+    unsigned int accepted = 0;
+    for (unsigned int i = 0; i < 100; ++i) {
+        accepted += limiter.accept();
+    }
+    EXPECT_GE(accepted, 10u);
+    EXPECT_LE(accepted, 11u);
+
+    // the bucket refills with the rate
+    boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+    accepted = 0;
+    for (unsigned int i = 0; i < 100; ++i) {
+        accepted += limiter.accept();
+    }
+    EXPECT_GE(accepted, 4u);
+    EXPECT_LE(accepted, 7u);
+
+}
+
+TEST(RateLimiterTest, testDefaultBurst) {
+    RateLimiter limiter(RateLimit(0.5));
+    EXPECT_TRUE(limiter.accept());
+    EXPECT_FALSE(limiter.accept());
+}
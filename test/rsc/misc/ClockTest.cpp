@@ -0,0 +1,95 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/misc/Clock.h"
+#include "rsc/misc/langutils.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsc::misc;
+
+TEST(ClockTest, testCoarseTimeMatchesSystemTime) {
+
+    // the coarse clock lags behind by at most one scheduler tick
+    const boost::uint64_t before = currentTimeMillis();
+    const boost::uint64_t coarse = coarseTimeMillis();
+    const boost::uint64_t after = currentTimeMillis();
+    EXPECT_LE(before, coarse + 50);
+    EXPECT_GE(after + 50, coarse);
+
+}
+
+TEST(ClockTest, testMonotonicClocks) {
+
+    const boost::uint64_t startNanos = monotonicNanos();
+    const boost::uint64_t startMicros = monotonicMicros();
+    const boost::uint64_t startMillis = coarseMonotonicMillis();
+    boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+    const boost::uint64_t nanos = monotonicNanos() - startNanos;
+    const boost::uint64_t micros = monotonicMicros() - startMicros;
+    const boost::uint64_t millis = coarseMonotonicMillis() - startMillis;
+
+    EXPECT_GE(nanos, 45000000u);
+    EXPECT_LT(nanos, 5000000000u);
+    EXPECT_GE(micros, 45000u);
+    EXPECT_LT(micros, 5000000u);
+    EXPECT_GE(millis, 40u);
+    EXPECT_LT(millis, 5000u);
+
+    boost::uint64_t last = monotonicNanos();
+    for (unsigned int i = 0; i < 1000; ++i) {
+        const boost::uint64_t current = monotonicNanos();
+        EXPECT_GE(current, last);
+        last = current;
+    }
+
+}
+
+TEST(ClockTest, testCycleClock) {
+
+    EXPECT_GT(CycleClock::getNanosPerCycle(), 0.0);
+    if (!CycleClock::isCycleCounterUsed()) {
+        EXPECT_EQ(1.0, CycleClock::getNanosPerCycle());
+        EXPECT_EQ(1234u, CycleClock::toNanos(1234));
+    }
+
+    const boost::uint64_t startNanos = monotonicNanos();
+    const boost::uint64_t startCycles = CycleClock::now();
+    boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+    const boost::uint64_t cycles = CycleClock::now() - startCycles;
+    const boost::uint64_t nanos = monotonicNanos() - startNanos;
+
+    // the converted duration must agree with the monotonic clock
+    const boost::uint64_t converted = CycleClock::toNanos(cycles);
+    EXPECT_GE(converted, nanos * 9 / 10);
+    EXPECT_LE(converted, nanos * 11 / 10);
+
+}
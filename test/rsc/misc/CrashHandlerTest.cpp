@@ -0,0 +1,99 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "rsc/misc/CrashHandler.h"
+
+using namespace std;
+using namespace testing;
+using namespace rsc::misc;
+
+namespace {
+
+void writeStderr(const char* message) {
+    if (write(STDERR_FILENO, message, strlen(message)) < 0) {
+        _exit(4);
+    }
+}
+
+void reportCrash(int /*signal*/, void* /*context*/) {
+    writeStderr("callback\n");
+}
+
+void previousHandler(int /*signal*/, siginfo_t* /*info*/, void* /*context*/) {
+    writeStderr("previous handler\n");
+    _exit(3);
+}
+
+void crashWithPreviousHandler() {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = &previousHandler;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &action, 0);
+
+    addCrashCallback(&reportCrash);
+    raise(SIGSEGV);
+}
+
+unsigned int recurse(volatile unsigned int depth) {
+    volatile char frame[1024];
+    frame[0] = (char) depth;
+    if (depth == 0xffffffff) {
+        return frame[0];
+    }
+    return recurse(depth + 1) + frame[0];
+}
+
+void overflowStack() {
+    addCrashCallback(&reportCrash);
+    recurse(0);
+}
+
+}
+
+TEST(CrashHandlerTest, testChainsPreviousHandler) {
+
+    // requires a fresh process in which no crash handler was installed yet
+    GTEST_FLAG(death_test_style) = "threadsafe";
+    EXPECT_EXIT(crashWithPreviousHandler(), ExitedWithCode(3),
+            "callback\nprevious handler\n");
+    GTEST_FLAG(death_test_style) = "fast";
+
+}
+
+TEST(CrashHandlerTest, testStackOverflow) {
+
+    EXPECT_DEATH(overflowStack(), "callback\n");
+
+}
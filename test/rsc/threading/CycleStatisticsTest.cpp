@@ -0,0 +1,156 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/CycleStatistics.h"
+
+using namespace std;
+using namespace rsc::threading;
+
+TEST(CycleStatisticsTest, testEmpty) {
+
+    CycleStatistics stats;
+    CycleStatistics::Summary summary = stats.getSummary();
+    EXPECT_EQ((boost::uint64_t) 0, summary.count);
+    EXPECT_EQ((boost::uint64_t) 0, summary.min);
+    EXPECT_EQ((boost::uint64_t) 0, summary.max);
+    EXPECT_EQ(0.0, summary.mean);
+    EXPECT_EQ(0.0, summary.variance);
+    EXPECT_EQ((boost::uint64_t) 0, stats.getPercentile(50));
+
+}
+
+TEST(CycleStatisticsTest, testSummary) {
+
+    CycleStatistics stats;
+    const boost::uint64_t values[] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+    for (unsigned int i = 0; i < 8; ++i) {
+        stats.record(values[i] * 1000);
+    }
+
+    CycleStatistics::Summary summary = stats.getSummary();
+    EXPECT_EQ((boost::uint64_t) 8, summary.count);
+    EXPECT_EQ((boost::uint64_t) 9000, summary.last);
+    EXPECT_EQ((boost::uint64_t) 2000, summary.min);
+    EXPECT_EQ((boost::uint64_t) 9000, summary.max);
+    EXPECT_DOUBLE_EQ(5000.0, summary.mean);
+    EXPECT_DOUBLE_EQ(4000000.0, summary.variance);
+
+}
+
+TEST(CycleStatisticsTest, testBuckets) {
+
+    // linear range
+    for (boost::uint64_t value = 0; value < 16; ++value) {
+        EXPECT_EQ(value, CycleStatistics::getBucketIndex(value));
+    }
+
+    // every value lies within the bounds of its bucket and bounds are
+    // contiguous
+    for (unsigned int index = 0; index < CycleStatistics::NUM_BUCKETS - 1;
+            ++index) {
+        const boost::uint64_t lower = CycleStatistics::getBucketLowerBound(
+                index);
+        const boost::uint64_t upper = CycleStatistics::getBucketUpperBound(
+                index);
+        EXPECT_LE(lower, upper);
+        EXPECT_EQ(index, CycleStatistics::getBucketIndex(lower));
+        EXPECT_EQ(index, CycleStatistics::getBucketIndex(upper));
+        EXPECT_EQ(upper + 1,
+                CycleStatistics::getBucketLowerBound(index + 1));
+        // bounded relative error
+        if (lower >= 16) {
+            EXPECT_LE((double) (upper - lower) / (double) lower, 1.0 / 16);
+        }
+    }
+
+    EXPECT_EQ(CycleStatistics::NUM_BUCKETS - 1,
+            CycleStatistics::getBucketIndex(~((boost::uint64_t) 0)));
+
+}
+
+TEST(CycleStatisticsTest, testPercentiles) {
+
+    CycleStatistics stats;
+    for (boost::uint64_t i = 1; i <= 1000; ++i) {
+        stats.record(i * 1000);
+    }
+
+    const std::vector<boost::uint64_t> histogram = stats.getHistogram();
+    boost::uint64_t total = 0;
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        total += histogram[i];
+    }
+    EXPECT_EQ((boost::uint64_t) 1000, total);
+
+    const double percentiles[] = { 10, 50, 90, 99 };
+    for (unsigned int i = 0; i < 4; ++i) {
+        const double expected = percentiles[i] * 10000;
+        const boost::uint64_t estimate = stats.getPercentile(percentiles[i]);
+        EXPECT_GE((double) estimate, expected);
+        EXPECT_LE((double) estimate, expected * (1.0 + 1.0 / 16));
+    }
+    EXPECT_EQ((boost::uint64_t) 1000000, stats.getPercentile(100));
+
+}
+
+void recordCycles(CycleStatistics* stats, const unsigned int& count) {
+    for (unsigned int i = 0; i < count; ++i) {
+        stats->record(100 + i % 2 * 100);
+    }
+}
+
+TEST(CycleStatisticsTest, testConcurrentQueries) {
+
+    const unsigned int count = 200000;
+    CycleStatistics stats;
+    boost::thread writer(boost::bind(recordCycles, &stats, count));
+
+    boost::uint64_t lastCount = 0;
+    while (lastCount < count) {
+        CycleStatistics::Summary summary = stats.getSummary();
+        EXPECT_GE(summary.count, lastCount);
+        lastCount = summary.count;
+        if (summary.count > 1) {
+            EXPECT_EQ((boost::uint64_t) 100, summary.min);
+            EXPECT_EQ((boost::uint64_t) 200, summary.max);
+            EXPECT_GE(summary.mean, 100.0);
+            EXPECT_LE(summary.mean, 200.0);
+        }
+    }
+    writer.join();
+
+    EXPECT_DOUBLE_EQ(150.0, stats.getSummary().mean);
+    EXPECT_DOUBLE_EQ(2500.0, stats.getSummary().variance);
+
+}
@@ -33,6 +33,8 @@
 #include <gmock/gmock.h>
 
 #include "rsc/threading/Future.h"
+#include "rsc/threading/PooledTaskExecutor.h"
+#include "rsc/misc/langutils.h"
 
 using namespace std;
 using namespace rsc::threading;
@@ -112,5 +114,169 @@ TEST(FutureTest, testGetAsynchronous)
 TEST(FutureTest, testTimeout)
 {
     Future<int> f;
+    const boost::uint64_t before = rsc::misc::currentTimeMillis();
     EXPECT_THROW(f.get(0.3), FutureTimeoutException);
+    EXPECT_GE(rsc::misc::currentTimeMillis() - before, 300u);
+}
+
+TEST(FutureTest, testReferenceAccess)
+{
+
+    Future<vector<int> > f;
+    f.set(vector<int>(3, 42));
+    const vector<int>& first = f.getReference();
+    const vector<int>& second = f.getReference(1.0);
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(vector<int>(3, 42), first);
+
+    vector<int> taken = f.take();
+    EXPECT_EQ(vector<int>(3, 42), taken);
+
+    Future<int> error;
+    error.setError("damn");
+    EXPECT_THROW(error.getReference(), FutureTaskExecutionException);
+    EXPECT_THROW(error.take(), FutureTaskExecutionException);
+
+}
+
+void countCallback(int* counter, Future<int>& future) {
+    EXPECT_TRUE(future.isDone());
+    ++*counter;
+}
+
+TEST(FutureTest, testCallbacks)
+{
+
+    Future<int> f;
+    int counter = 0;
+    f.addCallback(boost::bind(&countCallback, &counter, _1));
+    f.addCallback(boost::bind(&countCallback, &counter, _1));
+    EXPECT_EQ(0, counter);
+    f.set(3);
+    EXPECT_EQ(2, counter);
+    // already done, invoked immediately
+    f.addCallback(boost::bind(&countCallback, &counter, _1));
+    EXPECT_EQ(3, counter);
+
+}
+
+int twice(const int& value) {
+    return 2 * value;
+}
+
+string describe(const int& value) {
+    return boost::str(boost::format("value %d") % value);
+}
+
+int failingContinuation(const int& /*value*/) {
+    throw runtime_error("continuation failed");
+}
+
+TEST(FutureTest, testThenInline)
+{
+
+    boost::shared_ptr<Future<int> > f(new Future<int>);
+    boost::shared_ptr<Future<int> > doubled = f->then(TaskExecutorPtr(),
+            &twice);
+    boost::shared_ptr<Future<string> > described = doubled->then(
+            TaskExecutorPtr(), &describe);
+    EXPECT_FALSE(described->isDone());
+
+    f->set(21);
+    EXPECT_TRUE(described->isDone());
+    EXPECT_EQ("value 42", described->get());
+
+}
+
+TEST(FutureTest, testThenOnExecutor)
+{
+
+    TaskExecutorPtr executor(new PooledTaskExecutor(2));
+
+    boost::shared_ptr<Future<int> > f(new Future<int>);
+    boost::shared_ptr<Future<int> > doubled = f->then(executor, &twice);
+    boost::thread t(boost::bind(&setter, 21, boost::ref(*f)));
+    EXPECT_EQ(42, doubled->get(5.0));
+    t.join();
+
+    // already done before attaching the continuation
+    EXPECT_EQ(84, doubled->then(executor, &twice)->get(5.0));
+
+}
+
+TEST(FutureTest, testThenErrors)
+{
+
+    boost::shared_ptr<Future<int> > f(new Future<int>);
+    boost::shared_ptr<Future<int> > propagated = f->then(TaskExecutorPtr(),
+            &twice);
+    f->setError("source failed");
+    EXPECT_THROW(propagated->get(), FutureTaskExecutionException);
+
+    boost::shared_ptr<Future<int> > g(new Future<int>);
+    boost::shared_ptr<Future<int> > failing = g->then(TaskExecutorPtr(),
+            &failingContinuation);
+    g->set(1);
+    try {
+        failing->get();
+        FAIL() << "expected an exception";
+    } catch (const FutureTaskExecutionException& e) {
+        EXPECT_EQ(string("continuation failed"), e.what());
+    }
+
+    Future<int> notShared;
+    EXPECT_THROW(notShared.then(TaskExecutorPtr(), &twice), boost::bad_weak_ptr);
+
+}
+
+TEST(FutureTest, testWhenAll)
+{
+
+    vector<boost::shared_ptr<Future<int> > > futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.push_back(boost::shared_ptr<Future<int> >(new Future<int>));
+    }
+
+    boost::shared_ptr<Future<vector<int> > > all = whenAll(futures);
+    futures[2]->set(2);
+    futures[0]->set(0);
+    EXPECT_FALSE(all->isDone());
+    futures[1]->set(1);
+    ASSERT_TRUE(all->isDone());
+    const vector<int>& results = all->getReference();
+    ASSERT_EQ((size_t) 3, results.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(i, results[i]);
+    }
+
+    EXPECT_TRUE(whenAll(vector<boost::shared_ptr<Future<int> > >())->isDone());
+
+    futures.clear();
+    for (int i = 0; i < 2; ++i) {
+        futures.push_back(boost::shared_ptr<Future<int> >(new Future<int>));
+    }
+    all = whenAll(futures);
+    futures[1]->setError("damn");
+    EXPECT_THROW(all->get(), FutureTaskExecutionException);
+    futures[0]->set(0);
+
+}
+
+TEST(FutureTest, testWhenAny)
+{
+
+    vector<boost::shared_ptr<Future<int> > > futures;
+    for (int i = 0; i < 3; ++i) {
+        futures.push_back(boost::shared_ptr<Future<int> >(new Future<int>));
+    }
+
+    boost::shared_ptr<Future<size_t> > any = whenAny(futures);
+    EXPECT_FALSE(any->isDone());
+    futures[1]->setError("damn");
+    futures[2]->set(2);
+    EXPECT_EQ((size_t) 1, any->get());
+
+    EXPECT_THROW(whenAny(vector<boost::shared_ptr<Future<int> > >()),
+            invalid_argument);
+
 }
@@ -38,6 +38,7 @@
 #include <gtest/gtest.h>
 
 #include "rsc/threading/OrderedQueueDispatcherPool.h"
+#include "rsc/threading/RingBufferQueue.h"
 
 using namespace std;
 using namespace rsc;
@@ -489,3 +490,416 @@ TEST(OrderedQueueDispatcherPoolTest, testSequencedDispatchToOneReceiver)
     EXPECT_FALSE(receiver->calledInParallel);
 
 }
+
+TEST(OrderedQueueDispatcherPoolTest, testProcessingReadyQueue)
+{
+
+    StubReceiver::nextReceiverNum = 1;
+
+    srand(time(NULL));
+
+    const unsigned int numMessages = 100;
+    OrderedQueueDispatcherPool<int, StubReceiver> pool(
+            4,
+            OrderedQueueDispatcherPool<int, StubReceiver>::DeliveryHandlerPtr(
+                    new DeliveryHandler));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_READY_QUEUE);
+
+    const unsigned int numReceivers = 11;
+    vector<boost::shared_ptr<StubReceiver> > receivers;
+    for (unsigned int i = 0; i < numReceivers; ++i) {
+        boost::shared_ptr<StubReceiver> r(new StubReceiver);
+        pool.registerReceiver(r);
+        receivers.push_back(r);
+    }
+
+    // some messages before starting the pool
+    for (unsigned int i = 0; i < numMessages / 2; ++i) {
+        pool.push(i);
+    }
+
+    pool.start();
+    EXPECT_THROW(pool.start(), ::rsc::misc::IllegalStateException);
+    EXPECT_THROW(
+            pool.setSchedulingMode(
+                    OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_SCAN),
+            ::rsc::misc::IllegalStateException);
+
+    for (unsigned int i = numMessages / 2; i < numMessages; ++i) {
+        pool.push(i);
+    }
+
+    // wait for processing
+    for (unsigned int i = 0; i < receivers.size(); ++i) {
+        boost::mutex::scoped_lock lock(receivers[i]->mutex);
+        while (receivers[i]->messages.size() < numMessages) {
+            receivers[i]->condition.wait(lock);
+        }
+    }
+
+    pool.stop();
+
+    for (unsigned int i = 0; i < numReceivers; ++i) {
+
+        boost::shared_ptr<StubReceiver> r = receivers[i];
+        EXPECT_EQ(numMessages, r->messages.size());
+
+        for (unsigned int expected = 0; expected < numMessages; ++expected) {
+            EXPECT_EQ((int) expected, r->messages[expected]) << "Receiver " << i << " unordered";
+        }
+
+    }
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testUnregisterReadyQueue)
+{
+
+    OrderedQueueDispatcherPool<int, StubReceiver> pool(2,
+            boost::bind(deliver, _1, _2));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_READY_QUEUE);
+
+    pool.start();
+
+    boost::shared_ptr<StubReceiver> receiver(new StubReceiver);
+    pool.registerReceiver(receiver);
+    EXPECT_TRUE(pool.unregisterReceiver(receiver));
+    EXPECT_FALSE(pool.unregisterReceiver(receiver));
+
+    pool.push(42);
+
+    pool.stop();
+
+    boost::this_thread::sleep(boost::posix_time::millisec(100));
+
+    EXPECT_EQ((size_t) 0, receiver->messages.size());
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testSequencedDispatchToOneReceiverReadyQueue)
+{
+
+    OrderedQueueDispatcherPool<int, ParallelReceiver> pool(2,
+                boost::bind(parallelDeliver, _1, _2));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, ParallelReceiver>::SCHEDULING_READY_QUEUE);
+
+    pool.start();
+
+    boost::shared_ptr<ParallelReceiver> receiver(new ParallelReceiver);
+    pool.registerReceiver(receiver);
+
+    pool.push(42);
+    pool.push(43);
+
+    // twice the time one call can take so that both jobs have a chance to
+    // process
+    boost::this_thread::sleep(boost::posix_time::seconds(4));
+
+    pool.stop();
+
+    EXPECT_FALSE(receiver->calledInParallel);
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testParallelDispatchToOneReceiverReadyQueue)
+{
+
+    OrderedQueueDispatcherPool<int, ParallelReceiver> pool(2,
+                boost::bind(parallelDeliver, _1, _2));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, ParallelReceiver>::SCHEDULING_READY_QUEUE);
+
+    pool.start();
+
+    pool.setParallelCalls(true);
+
+    boost::shared_ptr<ParallelReceiver> receiver(new ParallelReceiver);
+    pool.registerReceiver(receiver);
+
+    pool.push(42);
+    pool.push(43);
+
+    boost::this_thread::sleep(boost::posix_time::seconds(2));
+
+    pool.stop();
+
+    EXPECT_TRUE(receiver->calledInParallel);
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testProcessingWorkStealing)
+{
+
+    StubReceiver::nextReceiverNum = 1;
+
+    const unsigned int numMessages = 100;
+    OrderedQueueDispatcherPool<int, StubReceiver> pool(
+            4,
+            OrderedQueueDispatcherPool<int, StubReceiver>::DeliveryHandlerPtr(
+                    new DeliveryHandler));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_WORK_STEALING);
+    EXPECT_EQ(
+            (OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_WORK_STEALING),
+            pool.getSchedulingMode());
+
+    const unsigned int numReceivers = 11;
+    vector<boost::shared_ptr<StubReceiver> > receivers;
+    for (unsigned int i = 0; i < numReceivers; ++i) {
+        boost::shared_ptr<StubReceiver> r(new StubReceiver);
+        pool.registerReceiver(r);
+        receivers.push_back(r);
+    }
+
+    // some messages before starting the pool
+    for (unsigned int i = 0; i < numMessages / 2; ++i) {
+        pool.push(i);
+    }
+
+    pool.start();
+
+    // bursts with pauses in between so that workers have to park and steal
+    for (unsigned int i = numMessages / 2; i < numMessages; ++i) {
+        pool.push(i);
+        if (i % 10 == 0) {
+            boost::this_thread::sleep(boost::posix_time::millisec(10));
+        }
+    }
+
+    // wait for processing
+    for (unsigned int i = 0; i < receivers.size(); ++i) {
+        boost::mutex::scoped_lock lock(receivers[i]->mutex);
+        while (receivers[i]->messages.size() < numMessages) {
+            receivers[i]->condition.wait(lock);
+        }
+    }
+
+    pool.stop();
+
+    for (unsigned int i = 0; i < numReceivers; ++i) {
+
+        boost::shared_ptr<StubReceiver> r = receivers[i];
+        EXPECT_EQ(numMessages, r->messages.size());
+
+        for (unsigned int expected = 0; expected < numMessages; ++expected) {
+            EXPECT_EQ((int) expected, r->messages[expected]) << "Receiver " << i << " unordered";
+        }
+
+    }
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testSequencedDispatchToOneReceiverWorkStealing)
+{
+
+    OrderedQueueDispatcherPool<int, ParallelReceiver> pool(2,
+                boost::bind(parallelDeliver, _1, _2));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, ParallelReceiver>::SCHEDULING_WORK_STEALING);
+
+    pool.start();
+
+    boost::shared_ptr<ParallelReceiver> receiver(new ParallelReceiver);
+    pool.registerReceiver(receiver);
+
+    pool.push(42);
+    pool.push(43);
+
+    // twice the time one call can take so that both jobs have a chance to
+    // process
+    boost::this_thread::sleep(boost::posix_time::seconds(4));
+
+    pool.stop();
+
+    EXPECT_FALSE(receiver->calledInParallel);
+
+}
+
+/**
+ * A batch delivery handler recording the size of each batch.
+ *
+ * @author jwienke
+ */
+class BatchDeliveryHandler: public OrderedQueueDispatcherPool<int, StubReceiver>::BatchDeliveryHandler {
+public:
+
+    boost::mutex batchSizesMutex;
+    vector<size_t> batchSizes;
+
+    void deliver(boost::shared_ptr<StubReceiver>& receiver,
+            const vector<int>& messages) {
+        {
+            boost::mutex::scoped_lock lock(batchSizesMutex);
+            batchSizes.push_back(messages.size());
+        }
+        boost::mutex::scoped_lock lock(receiver->mutex);
+        receiver->messages.insert(receiver->messages.end(), messages.begin(),
+                messages.end());
+        receiver->condition.notify_all();
+    }
+
+};
+
+class EvenFilterHandler: public OrderedQueueDispatcherPool<int, StubReceiver>::FilterHandler {
+public:
+    bool filter(boost::shared_ptr<StubReceiver>& /*receiver*/, const int& message) {
+        return message % 2 == 0;
+    }
+};
+
+TEST(OrderedQueueDispatcherPoolTest, testBatchDelivery)
+{
+
+    for (int mode = OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_SCAN;
+            mode <= OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_WORK_STEALING;
+            ++mode) {
+
+        const unsigned int numMessages = 100;
+        const unsigned int maxBatchSize = 8;
+        boost::shared_ptr<BatchDeliveryHandler> handler(new BatchDeliveryHandler);
+        OrderedQueueDispatcherPool<int, StubReceiver> pool(
+                3,
+                OrderedQueueDispatcherPool<int, StubReceiver>::BatchDeliveryHandlerPtr(
+                        handler));
+        pool.setSchedulingMode(
+                (OrderedQueueDispatcherPool<int, StubReceiver>::SchedulingMode) mode);
+        pool.setMaxBatchSize(maxBatchSize);
+
+        const unsigned int numReceivers = 5;
+        vector<boost::shared_ptr<StubReceiver> > receivers;
+        for (unsigned int i = 0; i < numReceivers; ++i) {
+            boost::shared_ptr<StubReceiver> r(new StubReceiver);
+            pool.registerReceiver(r);
+            receivers.push_back(r);
+        }
+
+        // queue everything before starting so that full batches are formed
+        for (unsigned int i = 0; i < numMessages; ++i) {
+            pool.push(i);
+        }
+
+        pool.start();
+
+        for (unsigned int i = 0; i < receivers.size(); ++i) {
+            boost::mutex::scoped_lock lock(receivers[i]->mutex);
+            while (receivers[i]->messages.size() < numMessages) {
+                receivers[i]->condition.wait(lock);
+            }
+        }
+
+        pool.stop();
+
+        for (unsigned int i = 0; i < numReceivers; ++i) {
+            ASSERT_EQ(numMessages, receivers[i]->messages.size());
+            for (unsigned int expected = 0; expected < numMessages; ++expected) {
+                EXPECT_EQ((int) expected, receivers[i]->messages[expected]) << "Receiver " << i << " unordered";
+            }
+        }
+
+        EXPECT_LT(handler->batchSizes.size(), numReceivers * numMessages);
+        for (unsigned int i = 0; i < handler->batchSizes.size(); ++i) {
+            EXPECT_GE(handler->batchSizes[i], (size_t) 1);
+            EXPECT_LE(handler->batchSizes[i], (size_t) maxBatchSize);
+        }
+
+    }
+
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testBatchDeliveryFilterAndLatency)
+{
+
+    boost::shared_ptr<BatchDeliveryHandler> handler(new BatchDeliveryHandler);
+    OrderedQueueDispatcherPool<int, StubReceiver> pool(
+            1,
+            OrderedQueueDispatcherPool<int, StubReceiver>::BatchDeliveryHandlerPtr(
+                    handler),
+            OrderedQueueDispatcherPool<int, StubReceiver>::FilterHandlerPtr(
+                    new EvenFilterHandler));
+    pool.setSchedulingMode(
+            OrderedQueueDispatcherPool<int, StubReceiver>::SCHEDULING_READY_QUEUE);
+    pool.setMaxBatchLatency(2000);
+
+    boost::shared_ptr<StubReceiver> receiver(new StubReceiver);
+    pool.registerReceiver(receiver);
+
+    pool.start();
+
+    // the worker waits for further messages after the first one
+    pool.push(0);
+    boost::this_thread::sleep(boost::posix_time::millisec(100));
+    pool.push(1);
+    pool.push(2);
+
+    {
+        boost::mutex::scoped_lock lock(receiver->mutex);
+        while (receiver->messages.size() < 2) {
+            receiver->condition.wait(lock);
+        }
+    }
+
+    pool.stop();
+
+    ASSERT_EQ((size_t) 2, receiver->messages.size());
+    EXPECT_EQ(0, receiver->messages[0]);
+    EXPECT_EQ(2, receiver->messages[1]);
+    ASSERT_EQ((size_t) 1, handler->batchSizes.size());
+    EXPECT_EQ((size_t) 2, handler->batchSizes[0]);
+
+}
+
+void deliverToStub(boost::shared_ptr<StubReceiver>& receiver, const int& message) {
+    boost::mutex::scoped_lock lock(receiver->mutex);
+    receiver->messages.push_back(message);
+    receiver->condition.notify_all();
+}
+
+TEST(OrderedQueueDispatcherPoolTest, testRingBufferReceiverQueues)
+{
+
+    typedef OrderedQueueDispatcherPool<int, StubReceiver,
+            RingBufferQueue<int> > RingBufferPool;
+
+    for (int mode = RingBufferPool::SCHEDULING_SCAN;
+            mode <= RingBufferPool::SCHEDULING_WORK_STEALING; ++mode) {
+
+        const unsigned int numMessages = 100;
+        RingBufferPool pool(3, boost::bind(deliverToStub, _1, _2));
+        pool.setSchedulingMode((RingBufferPool::SchedulingMode) mode);
+
+        const unsigned int numReceivers = 5;
+        vector<boost::shared_ptr<StubReceiver> > receivers;
+        for (unsigned int i = 0; i < numReceivers; ++i) {
+            boost::shared_ptr<StubReceiver> r(new StubReceiver);
+            pool.registerReceiver(r);
+            receivers.push_back(r);
+        }
+
+        pool.start();
+
+        for (unsigned int i = 0; i < numMessages; ++i) {
+            pool.push(i);
+        }
+
+        for (unsigned int i = 0; i < receivers.size(); ++i) {
+            boost::mutex::scoped_lock lock(receivers[i]->mutex);
+            while (receivers[i]->messages.size() < numMessages) {
+                receivers[i]->condition.wait(lock);
+            }
+        }
+
+        pool.stop();
+
+        for (unsigned int i = 0; i < numReceivers; ++i) {
+            ASSERT_EQ(numMessages, receivers[i]->messages.size());
+            for (unsigned int expected = 0; expected < numMessages; ++expected) {
+                EXPECT_EQ((int) expected, receivers[i]->messages[expected]) << "Receiver " << i << " unordered";
+            }
+        }
+
+    }
+
+}
@@ -0,0 +1,261 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/PeriodicTaskScheduler.h"
+
+using namespace std;
+using namespace rsc::threading;
+using namespace rsc::misc;
+
+class RecordingPeriodicTask: public PeriodicTask {
+public:
+
+    RecordingPeriodicTask(const unsigned int& cycleMs,
+            const unsigned int& workMs = 0) :
+            PeriodicTask(cycleMs), workMs(workMs), running(false), overlapped(
+                    false) {
+    }
+
+    void execute() {
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            if (running) {
+                overlapped = true;
+            }
+            running = true;
+            starts.push_back(currentTimeMicros());
+            condition.notify_all();
+        }
+        if (workMs > 0) {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(workMs));
+        }
+        boost::mutex::scoped_lock lock(mutex);
+        running = false;
+    }
+
+    void waitForIterations(const size_t& count) {
+        boost::mutex::scoped_lock lock(mutex);
+        while (starts.size() < count) {
+            condition.wait(lock);
+        }
+    }
+
+    bool waitForIterations(const size_t& count, const unsigned int& timeoutMs) {
+        const boost::system_time timeout = boost::get_system_time()
+                + boost::posix_time::milliseconds(timeoutMs);
+        boost::mutex::scoped_lock lock(mutex);
+        while (starts.size() < count) {
+            if (!condition.timed_wait(lock, timeout)) {
+                return starts.size() >= count;
+            }
+        }
+        return true;
+    }
+
+    size_t getIterations() {
+        boost::mutex::scoped_lock lock(mutex);
+        return starts.size();
+    }
+
+    unsigned int workMs;
+    boost::mutex mutex;
+    boost::condition condition;
+    vector<boost::uint64_t> starts;
+    bool running;
+    bool overlapped;
+
+};
+
+typedef boost::shared_ptr<RecordingPeriodicTask> RecordingPeriodicTaskPtr;
+
+/**
+ * Stops itself through #continueExec after a number of iterations.
+ */
+class LimitedPeriodicTask: public RecordingPeriodicTask {
+public:
+
+    LimitedPeriodicTask(const unsigned int& cycleMs,
+            const size_t& maxIterations) :
+            RecordingPeriodicTask(cycleMs), maxIterations(maxIterations) {
+    }
+
+    bool continueExec() {
+        return PeriodicTask::continueExec() && getIterations() < maxIterations;
+    }
+
+    size_t maxIterations;
+
+};
+
+TEST(PeriodicTaskSchedulerTest, testScheduleInvalid) {
+
+    PeriodicTaskScheduler scheduler(1);
+
+    RecordingPeriodicTaskPtr canceled(new RecordingPeriodicTask(10));
+    canceled->cancel();
+    EXPECT_THROW(scheduler.schedule(canceled), invalid_argument);
+
+    RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(10));
+    scheduler.schedule(task);
+    EXPECT_THROW(scheduler.schedule(task), invalid_argument);
+    task->cancel();
+    task->waitDone();
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testManyTasksOnFewThreads) {
+
+    const unsigned int numTasks = 100;
+    PeriodicTaskScheduler scheduler(2);
+
+    vector<RecordingPeriodicTaskPtr> tasks;
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(20));
+        scheduler.schedule(task);
+        tasks.push_back(task);
+    }
+    EXPECT_EQ(numTasks, scheduler.getNumTasks());
+
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        tasks[i]->waitForIterations(5);
+    }
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        tasks[i]->cancel();
+    }
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        tasks[i]->waitDone();
+        EXPECT_FALSE(tasks[i]->overlapped);
+    }
+    EXPECT_EQ((size_t) 0, scheduler.getNumTasks());
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testAbsoluteDeadlines) {
+
+    const unsigned int cycleMs = 10;
+    const size_t iterations = 30;
+
+    PeriodicTaskScheduler scheduler(1);
+    RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(cycleMs, 3));
+    scheduler.schedule(task);
+    task->waitForIterations(iterations);
+    task->cancel();
+    task->waitDone();
+
+    const boost::uint64_t first = task->starts[0];
+    for (size_t i = 1; i < iterations; ++i) {
+        EXPECT_GE(task->starts[i], first + i * cycleMs * 1000);
+    }
+    // without drift the last start only contains the jitter of one cycle
+    if (task->getMissedDeadlines() == 0) {
+        EXPECT_LE(task->starts[iterations - 1],
+                first + (iterations - 1) * cycleMs * 1000 + 50000);
+    }
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testCancelWakesImmediately) {
+
+    PeriodicTaskScheduler scheduler(1);
+    RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(10000));
+    scheduler.schedule(task);
+    task->waitForIterations(1);
+
+    const boost::uint64_t before = currentTimeMillis();
+    task->cancel();
+    task->waitDone();
+    EXPECT_LT(currentTimeMillis() - before, 1000);
+    EXPECT_EQ((size_t) 1, task->getIterations());
+    EXPECT_EQ((size_t) 0, scheduler.getNumTasks());
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testMissedDeadlines) {
+
+    PeriodicTaskScheduler scheduler(1);
+    RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(10, 35));
+    scheduler.schedule(task);
+    task->waitForIterations(4);
+    task->cancel();
+    task->waitDone();
+
+    EXPECT_GE(task->getMissedDeadlines(), (boost::uint64_t) 3);
+    EXPECT_EQ(task->getMissedDeadlines(), scheduler.getMissedDeadlines());
+    EXPECT_FALSE(task->overlapped);
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testDestructionCancelsTasks) {
+
+    RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(10000));
+    {
+        PeriodicTaskScheduler scheduler;
+        scheduler.schedule(task);
+        task->waitForIterations(1);
+    }
+    EXPECT_TRUE(task->isCancelRequested());
+    EXPECT_TRUE(task->isDone());
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testZeroPeriodOnManyWorkers) {
+
+    // a worker picking up the next cycle while the previous one is still
+    // finishing must not drop it
+    for (unsigned int run = 0; run < 20; ++run) {
+        PeriodicTaskScheduler scheduler(4);
+        RecordingPeriodicTaskPtr task(new RecordingPeriodicTask(0));
+        scheduler.schedule(task);
+        ASSERT_TRUE(task->waitForIterations(2000, 10000))
+                << "stalled after " << task->getIterations()
+                << " iterations in run " << run;
+        task->cancel();
+        task->waitDone();
+        EXPECT_FALSE(task->overlapped);
+    }
+
+}
+
+TEST(PeriodicTaskSchedulerTest, testContinueExec) {
+
+    PeriodicTaskScheduler scheduler(2);
+    boost::shared_ptr<LimitedPeriodicTask> task(new LimitedPeriodicTask(1, 5));
+    scheduler.schedule(task);
+    task->waitDone();
+    EXPECT_FALSE(task->isCancelRequested());
+    EXPECT_EQ((size_t) 5, task->getIterations());
+    EXPECT_EQ((size_t) 0, scheduler.getNumTasks());
+
+}
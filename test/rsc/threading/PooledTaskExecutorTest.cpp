@@ -0,0 +1,196 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/PooledTaskExecutor.h"
+#include "rsc/threading/RepetitiveTask.h"
+#include "rsc/threading/SimpleTask.h"
+
+using namespace std;
+using namespace rsc::threading;
+using namespace rsc::misc;
+
+class PooledFlagSetTask: public SimpleTask {
+public:
+    boost::uint64_t runTime;
+    boost::thread::id thread;
+    PooledFlagSetTask() :
+            runTime(0) {
+    }
+    void run() {
+        runTime = currentTimeMicros();
+        thread = boost::this_thread::get_id();
+        markDone();
+    }
+};
+
+class SleepingRepetitiveTask: public RepetitiveTask {
+public:
+    void execute() {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+    }
+};
+
+class ThrowingTask: public SimpleTask {
+public:
+    void run() {
+        markDone();
+        throw runtime_error("expected");
+    }
+};
+
+TEST(PooledTaskExecutorTest, testInvalidConstruction) {
+
+    EXPECT_THROW(PooledTaskExecutor(0), invalid_argument);
+    EXPECT_THROW(PooledTaskExecutor(1, 0), invalid_argument);
+
+}
+
+TEST(PooledTaskExecutorTest, testScheduleExceptionCanceled) {
+
+    PooledTaskExecutor executor;
+    TaskPtr t(new PooledFlagSetTask);
+    t->cancel();
+    EXPECT_THROW(executor.schedule(t), invalid_argument);
+    EXPECT_THROW(executor.schedule(t, 320), invalid_argument);
+
+}
+
+TEST(PooledTaskExecutorTest, testSchedule) {
+
+    PooledTaskExecutor executor;
+    TaskPtr t(new PooledFlagSetTask);
+    executor.schedule(t);
+    t->waitDone();
+    EXPECT_TRUE(t->isDone());
+
+}
+
+TEST(PooledTaskExecutorTest, testScheduleDelayedAfterCancel) {
+
+    PooledTaskExecutor executor;
+    TaskPtr t(new PooledFlagSetTask);
+    EXPECT_FALSE(t->isDone());
+    executor.schedule(t, 100000);
+    t->cancel();
+    EXPECT_FALSE(t->isDone());
+    t->waitDone();
+    EXPECT_TRUE(t->isDone());
+
+}
+
+TEST(PooledTaskExecutorTest, testScheduleDelayed) {
+
+    PooledTaskExecutor executor;
+    const boost::uint64_t delay = 237048;
+    boost::shared_ptr<PooledFlagSetTask> t(new PooledFlagSetTask);
+    boost::uint64_t scheduleTime = currentTimeMicros();
+    executor.schedule(t, delay);
+    t->waitDone();
+    const boost::uint64_t allowedPrecision = 200000;
+    EXPECT_GE(t->runTime, scheduleTime + delay);
+    EXPECT_LE(t->runTime, scheduleTime + delay + allowedPrecision);
+
+}
+
+TEST(PooledTaskExecutorTest, testManyDelayedTasksOnFixedPool) {
+
+    const unsigned int numThreads = 2;
+    PooledTaskExecutor executor(numThreads);
+    EXPECT_EQ(numThreads, executor.getNumThreads());
+
+    const unsigned int numTasks = 1000;
+    vector<boost::shared_ptr<PooledFlagSetTask> > tasks;
+    vector<boost::uint64_t> earliest;
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        const boost::uint64_t delay = (i * 7919) % 300000;
+        boost::shared_ptr<PooledFlagSetTask> t(new PooledFlagSetTask);
+        earliest.push_back(currentTimeMicros() + delay);
+        executor.schedule(t, delay);
+        tasks.push_back(t);
+    }
+
+    vector<boost::thread::id> threads;
+    for (unsigned int i = 0; i < numTasks; ++i) {
+        tasks[i]->waitDone();
+        EXPECT_GE(tasks[i]->runTime, earliest[i]);
+        if (find(threads.begin(), threads.end(), tasks[i]->thread)
+                == threads.end()) {
+            threads.push_back(tasks[i]->thread);
+        }
+    }
+    EXPECT_LE(threads.size(), numThreads);
+
+}
+
+TEST(PooledTaskExecutorTest, testExceptionKeepsWorker) {
+
+    PooledTaskExecutor executor(1);
+    TaskPtr throwing(new ThrowingTask);
+    executor.schedule(throwing);
+    TaskPtr t(new PooledFlagSetTask);
+    executor.schedule(t);
+    t->waitDone();
+    EXPECT_TRUE(t->isDone());
+
+}
+
+TEST(PooledTaskExecutorTest, testDestructionReleasesPendingTasks) {
+
+    TaskPtr t(new PooledFlagSetTask);
+    {
+        PooledTaskExecutor executor;
+        executor.schedule(t, 100000000);
+    }
+    EXPECT_TRUE(t->isCancelRequested());
+    EXPECT_TRUE(t->isDone());
+
+}
+
+TEST(PooledTaskExecutorTest, testDestructionCancelsQueuedAndRunningTasks) {
+
+    TaskPtr endless(new SleepingRepetitiveTask);
+    TaskPtr queued(new PooledFlagSetTask);
+    {
+        PooledTaskExecutor executor(1);
+        executor.schedule(endless);
+        executor.schedule(queued);
+        boost::this_thread::sleep(boost::posix_time::milliseconds(20));
+    }
+    EXPECT_TRUE(endless->isCancelRequested());
+    EXPECT_TRUE(endless->isDone());
+    EXPECT_TRUE(queued->isCancelRequested());
+    EXPECT_TRUE(queued->isDone());
+
+}
@@ -0,0 +1,286 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+#include <stdexcept>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/RingBufferQueue.h"
+#include "rsc/misc/langutils.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::threading;
+using namespace rsc::misc;
+
+void waitOnRingBufferElement(RingBufferQueue<int>* queue, int* resultVar,
+        bool* interrupted) {
+    try {
+        *resultVar = queue->pop();
+    } catch (InterruptedException& e) {
+        *interrupted = true;
+    }
+}
+
+TEST(RingBufferQueueTest, testBasicPushPopSingleThreaded)
+{
+
+    RingBufferQueue<int> queue;
+
+    const int first = 12;
+    const int second = 24;
+    const int third = 36;
+
+    queue.push(first);
+    queue.push(second);
+    queue.push(third);
+
+    EXPECT_EQ((size_t) 3, queue.size());
+    EXPECT_EQ(first, queue.pop());
+    EXPECT_EQ(second, queue.pop());
+    EXPECT_EQ(third, queue.pop());
+    EXPECT_EQ((size_t) 0, queue.size());
+
+}
+
+TEST(RingBufferQueueTest, testInvalidCapacity)
+{
+    EXPECT_THROW(RingBufferQueue<int>(1), invalid_argument);
+}
+
+TEST(RingBufferQueueTest, testTryPop)
+{
+
+    RingBufferQueue<int> queue;
+
+    EXPECT_THROW(queue.tryPop(), QueueEmptyException);
+
+    const int i = 3;
+    queue.push(i);
+    EXPECT_EQ(i, queue.tryPop());
+
+    EXPECT_THROW(queue.tryPop(), QueueEmptyException);
+
+}
+
+TEST(RingBufferQueueTest, testTryPush)
+{
+
+    RingBufferQueue<int> queue(2);
+    EXPECT_TRUE(queue.tryPush(1));
+    EXPECT_TRUE(queue.tryPush(2));
+    EXPECT_FALSE(queue.tryPush(3));
+    EXPECT_EQ(1, queue.pop());
+    EXPECT_TRUE(queue.tryPush(3));
+    EXPECT_EQ(2, queue.pop());
+    EXPECT_EQ(3, queue.pop());
+
+}
+
+TEST(RingBufferQueueTest, testBasicPushPopMultiThreaded)
+{
+
+    RingBufferQueue<int> queue;
+
+    int waiter1Result;
+    bool waiter1Interrupted = false;
+    boost::function<void()> waiter1 = boost::bind(waitOnRingBufferElement,
+            &queue, &waiter1Result, &waiter1Interrupted);
+    int waiter2Result;
+    bool waiter2Interrupted = false;
+    boost::function<void()> waiter2 = boost::bind(waitOnRingBufferElement,
+            &queue, &waiter2Result, &waiter2Interrupted);
+
+    boost::thread w1(waiter1);
+    boost::thread w2(waiter2);
+
+    int first = 12;
+    int second = 24;
+
+    queue.push(first);
+    queue.push(second);
+
+    w1.join();
+    w2.join();
+
+    EXPECT_TRUE((waiter1Result == first && waiter2Result == second) ||
+            (waiter1Result == second && waiter2Result == first));
+    EXPECT_FALSE(waiter1Interrupted);
+    EXPECT_FALSE(waiter2Interrupted);
+
+}
+
+void produceRingBufferElements(RingBufferQueue<int>* queue,
+        const int& producer, const int& count) {
+    for (int i = 0; i < count; ++i) {
+        queue->push(producer * count + i);
+    }
+}
+
+void consumeRingBufferElements(RingBufferQueue<int>* queue,
+        vector<int>* results, const int& count) {
+    for (int i = 0; i < count; ++i) {
+        results->push_back(queue->pop());
+    }
+}
+
+TEST(RingBufferQueueTest, testMultipleProducersAndConsumers)
+{
+
+    const int numThreads = 4;
+    const int perThread = 5000;
+
+    // large enough to never drop elements
+    RingBufferQueue<int> queue(numThreads * perThread);
+
+    vector<vector<int> > results(numThreads);
+    boost::thread_group threads;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.create_thread(
+                boost::bind(consumeRingBufferElements, &queue, &results[i],
+                        perThread));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        threads.create_thread(
+                boost::bind(produceRingBufferElements, &queue, i, perThread));
+    }
+    threads.join_all();
+
+    vector<bool> seen(numThreads * perThread, false);
+    for (int i = 0; i < numThreads; ++i) {
+        // elements of one producer arrive in order at each consumer
+        vector<int> last(numThreads, -1);
+        for (size_t j = 0; j < results[i].size(); ++j) {
+            const int element = results[i][j];
+            EXPECT_FALSE(seen[element]);
+            seen[element] = true;
+            EXPECT_GT(element, last[element / perThread]);
+            last[element / perThread] = element;
+        }
+    }
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(RingBufferQueueTest, testPopTimeout) {
+
+    RingBufferQueue<int> queue;
+    boost::uint64_t before = currentTimeMillis();
+    EXPECT_THROW(queue.pop(500), QueueEmptyException);
+    boost::uint64_t after = currentTimeMillis();
+    EXPECT_GE(after - before, 500);
+
+}
+
+TEST(RingBufferQueueTest, testInterruption)
+{
+
+    RingBufferQueue<int> queue;
+
+    int waiter1Result;
+    bool waiter1Interrupted = false;
+    boost::function<void()> waiter1 = boost::bind(waitOnRingBufferElement,
+            &queue, &waiter1Result, &waiter1Interrupted);
+    int waiter2Result;
+    bool waiter2Interrupted = false;
+    boost::function<void()> waiter2 = boost::bind(waitOnRingBufferElement,
+            &queue, &waiter2Result, &waiter2Interrupted);
+
+    boost::thread w1(waiter1);
+    boost::thread w2(waiter2);
+
+    queue.interrupt();
+
+    w1.join();
+    w2.join();
+
+    EXPECT_TRUE(waiter1Interrupted);
+    EXPECT_TRUE(waiter2Interrupted);
+
+    EXPECT_THROW(queue.pop(), InterruptedException) << "Even new calls to pop must throw after interruption";
+
+}
+
+TEST(RingBufferQueueTest, testEmpty)
+{
+
+    RingBufferQueue<int> queue;
+
+    EXPECT_TRUE(queue.empty());
+    queue.push(12);
+    EXPECT_FALSE(queue.empty());
+    queue.interrupt();
+    EXPECT_FALSE(queue.empty());
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(RingBufferQueueTest, testSizeLimit)
+{
+
+    RingBufferQueue<int> queue(3);
+
+    unsigned int elems = 5;
+    for (unsigned int i = 0; i < elems; ++i) {
+        queue.push(i);
+    }
+
+    EXPECT_EQ((size_t) 3, queue.size());
+    EXPECT_EQ(2, queue.pop());
+    EXPECT_EQ(3, queue.pop());
+    EXPECT_EQ(4, queue.pop());
+    EXPECT_TRUE(queue.empty());
+
+}
+
+void dropRingBufferElement(const int& dropped, vector<int>* results) {
+    results->push_back(dropped);
+}
+
+TEST(RingBufferQueueTest, testDropHandler)
+{
+
+    vector<int> dropped;
+    RingBufferQueue<int> queue(2,
+            boost::bind(&dropRingBufferElement, _1, &dropped));
+
+    unsigned int elems = 5;
+    for (unsigned int i = 0; i < elems; ++i) {
+        queue.push(i);
+    }
+
+    EXPECT_EQ((size_t) 3, dropped.size());
+    EXPECT_EQ(0, dropped[0]);
+    EXPECT_EQ(1, dropped[1]);
+    EXPECT_EQ(2, dropped[2]);
+
+}
@@ -0,0 +1,208 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <iterator>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/SPSCQueue.h"
+#include "rsc/misc/langutils.h"
+
+using namespace std;
+using namespace rsc;
+using namespace rsc::threading;
+using namespace rsc::misc;
+
+void waitOnSPSCElement(SPSCQueue<int>* queue, int* resultVar,
+        bool* interrupted) {
+    try {
+        *resultVar = queue->pop();
+    } catch (InterruptedException& e) {
+        *interrupted = true;
+    }
+}
+
+TEST(SPSCQueueTest, testBasicPushPopSingleThreaded)
+{
+
+    SPSCQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+
+    const int first = 12;
+    const int second = 24;
+    const int third = 36;
+
+    queue.push(first);
+    queue.push(second);
+    queue.push(third);
+
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ((size_t) 3, queue.size());
+    EXPECT_EQ(first, queue.pop());
+    EXPECT_EQ(second, queue.pop());
+    EXPECT_EQ(third, queue.pop());
+    EXPECT_EQ((size_t) 0, queue.size());
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(SPSCQueueTest, testTryPop)
+{
+
+    SPSCQueue<int> queue;
+
+    EXPECT_THROW(queue.tryPop(), QueueEmptyException);
+
+    const int i = 3;
+    queue.push(i);
+    EXPECT_EQ(i, queue.tryPop());
+
+    EXPECT_THROW(queue.tryPop(), QueueEmptyException);
+
+}
+
+TEST(SPSCQueueTest, testNodeReuse)
+{
+
+    SPSCQueue<int> queue;
+    for (int round = 0; round < 100; ++round) {
+        for (int i = 0; i < 10; ++i) {
+            queue.push(round * 10 + i);
+        }
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(round * 10 + i, queue.pop());
+        }
+    }
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(SPSCQueueTest, testReleasesPoppedElements)
+{
+
+    SPSCQueue<boost::shared_ptr<int> > queue;
+    boost::shared_ptr<int> element(new int(42));
+    queue.push(element);
+    EXPECT_EQ(2, element.use_count());
+    EXPECT_EQ(element, queue.pop());
+    EXPECT_EQ(1, element.use_count());
+
+}
+
+TEST(SPSCQueueTest, testDrainAndPushAll)
+{
+
+    SPSCQueue<int> queue;
+
+    vector<int> input;
+    for (int i = 0; i < 5; ++i) {
+        input.push_back(i);
+    }
+    queue.pushAll(input.begin(), input.end());
+    EXPECT_EQ((size_t) 5, queue.size());
+
+    vector<int> output;
+    EXPECT_EQ((size_t) 2, queue.drain(back_inserter(output), 2));
+    EXPECT_EQ((size_t) 3, queue.drain(back_inserter(output)));
+    EXPECT_EQ(input, output);
+    EXPECT_TRUE(queue.empty());
+
+    queue.push(1);
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+
+}
+
+void produceSPSCElements(SPSCQueue<int>* queue, const int& count) {
+    for (int i = 0; i < count; ++i) {
+        queue->push(i);
+    }
+}
+
+void consumeSPSCElements(SPSCQueue<int>* queue, vector<int>* results,
+        const int& count) {
+    for (int i = 0; i < count; ++i) {
+        results->push_back(queue->pop());
+    }
+}
+
+TEST(SPSCQueueTest, testProducerConsumer)
+{
+
+    const int count = 100000;
+
+    SPSCQueue<int> queue;
+    vector<int> results;
+
+    boost::thread consumer(
+            boost::bind(consumeSPSCElements, &queue, &results, count));
+    boost::thread producer(boost::bind(produceSPSCElements, &queue, count));
+    producer.join();
+    consumer.join();
+
+    ASSERT_EQ((size_t) count, results.size());
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(i, results[i]);
+    }
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(SPSCQueueTest, testPopTimeout) {
+
+    SPSCQueue<int> queue;
+    boost::uint64_t before = currentTimeMillis();
+    EXPECT_THROW(queue.pop(500), QueueEmptyException);
+    boost::uint64_t after = currentTimeMillis();
+    EXPECT_GE(after - before, 500);
+
+}
+
+TEST(SPSCQueueTest, testInterruption)
+{
+
+    SPSCQueue<int> queue;
+
+    int waiterResult;
+    bool waiterInterrupted = false;
+    boost::thread waiter(
+            boost::bind(waitOnSPSCElement, &queue, &waiterResult,
+                    &waiterInterrupted));
+
+    boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+    queue.interrupt();
+    waiter.join();
+
+    EXPECT_TRUE(waiterInterrupted);
+    EXPECT_THROW(queue.pop(), InterruptedException);
+
+}
@@ -24,7 +24,11 @@
  *
  * ============================================================ */
 
+#include <iterator>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
@@ -207,3 +211,148 @@ TEST(SynchronizedQueueTest, testDropHandler)
     EXPECT_EQ(2, dropped[2]);
 
 }
+
+TEST(SynchronizedQueueTest, testDrain)
+{
+
+    SynchronizedQueue<int> queue;
+
+    vector<int> drained;
+    EXPECT_EQ((size_t) 0, queue.drain(back_inserter(drained)));
+    EXPECT_TRUE(drained.empty());
+
+    for (int i = 0; i < 5; ++i) {
+        queue.push(i);
+    }
+
+    EXPECT_EQ((size_t) 2, queue.drain(back_inserter(drained), 2));
+    ASSERT_EQ((size_t) 2, drained.size());
+    EXPECT_EQ(0, drained[0]);
+    EXPECT_EQ(1, drained[1]);
+    EXPECT_EQ((size_t) 3, queue.size());
+
+    // larger limits than available elements return everything
+    EXPECT_EQ((size_t) 3, queue.drain(back_inserter(drained), 10));
+    ASSERT_EQ((size_t) 5, drained.size());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, drained[i]);
+    }
+    EXPECT_TRUE(queue.empty());
+
+}
+
+TEST(SynchronizedQueueTest, testPushAll)
+{
+
+    vector<int> dropped;
+    SynchronizedQueue<int> queue(3, boost::bind(&drop, _1, &dropped));
+
+    vector<int> elements;
+    for (int i = 0; i < 5; ++i) {
+        elements.push_back(i);
+    }
+    queue.pushAll(elements.begin(), elements.end());
+
+    ASSERT_EQ((size_t) 2, dropped.size());
+    EXPECT_EQ(0, dropped[0]);
+    EXPECT_EQ(1, dropped[1]);
+
+    vector<int> drained;
+    queue.drain(back_inserter(drained));
+    ASSERT_EQ((size_t) 3, drained.size());
+    EXPECT_EQ(2, drained[0]);
+    EXPECT_EQ(3, drained[1]);
+    EXPECT_EQ(4, drained[2]);
+
+}
+
+TEST(SynchronizedQueueTest, testPushAllWakesAllWaiters)
+{
+
+    SynchronizedQueue<int> queue;
+
+    int waiter1Result = -1;
+    bool waiter1Interrupted = false;
+    int waiter2Result = -1;
+    bool waiter2Interrupted = false;
+    boost::thread w1(boost::bind(waitOnQueueElement, &queue, &waiter1Result,
+            &waiter1Interrupted));
+    boost::thread w2(boost::bind(waitOnQueueElement, &queue, &waiter2Result,
+            &waiter2Interrupted));
+
+    vector<int> elements;
+    elements.push_back(12);
+    elements.push_back(24);
+    queue.pushAll(elements.begin(), elements.end());
+
+    w1.join();
+    w2.join();
+
+    EXPECT_EQ(36, waiter1Result + waiter2Result);
+
+}
+
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+
+/**
+ * Counts how often instances are copied.
+ */
+class CopyCounter {
+public:
+
+    static unsigned int copies;
+
+    explicit CopyCounter(const string& value = "") :
+            value(value) {
+    }
+
+    CopyCounter(const CopyCounter& other) :
+            value(other.value) {
+        ++copies;
+    }
+
+    CopyCounter(CopyCounter&& other) BOOST_NOEXCEPT :
+            value(std::move(other.value)) {
+    }
+
+    CopyCounter& operator=(const CopyCounter& other) {
+        value = other.value;
+        ++copies;
+        return *this;
+    }
+
+    CopyCounter& operator=(CopyCounter&& other) BOOST_NOEXCEPT {
+        value = std::move(other.value);
+        return *this;
+    }
+
+    string value;
+
+};
+
+unsigned int CopyCounter::copies = 0;
+
+TEST(SynchronizedQueueTest, testMoveOperations)
+{
+
+    SynchronizedQueue<CopyCounter> queue;
+    CopyCounter::copies = 0;
+
+    queue.push(CopyCounter("a"));
+    CopyCounter b("b");
+    queue.push(std::move(b));
+    queue.emplace("c");
+    queue.emplace("d");
+
+    EXPECT_EQ("a", queue.pop().value);
+    EXPECT_EQ("b", queue.tryPop().value);
+    vector<CopyCounter> drained;
+    EXPECT_EQ((size_t) 2, queue.drain(back_inserter(drained)));
+    EXPECT_EQ("c", drained[0].value);
+    EXPECT_EQ("d", drained[1].value);
+
+    EXPECT_EQ(0u, CopyCounter::copies);
+
+}
+
+#endif
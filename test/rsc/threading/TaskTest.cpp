@@ -120,3 +120,63 @@ TEST(TaskTest, testExecution)
     }
     //cerr << "main finished" << endl;
 }
+
+class SlowPeriodicTask: public PeriodicTask {
+public:
+    SlowPeriodicTask() :
+        PeriodicTask(10000), executed(false) {
+    }
+    void execute() {
+        executed = true;
+    }
+    volatile bool executed;
+};
+
+TEST(TaskTest, testPeriodicCancelWakesUp)
+{
+
+    boost::shared_ptr<SlowPeriodicTask> p(new SlowPeriodicTask);
+
+    ThreadedTaskExecutor executor;
+    executor.schedule(p);
+    while (!p->executed) {
+        boost::this_thread::yield();
+    }
+
+    const boost::uint64_t before = rsc::misc::currentTimeMillis();
+    p->cancel();
+    p->waitDone();
+    EXPECT_LT(rsc::misc::currentTimeMillis() - before, 1000);
+
+}
+
+class CountingRepetitiveTask: public RepetitiveTask {
+public:
+    CountingRepetitiveTask() :
+        iterations(0) {
+    }
+    void execute() {
+        ++iterations;
+        boost::this_thread::sleep(boost::posix_time::milliseconds(2));
+    }
+    bool continueExec() {
+        return iterations < 5;
+    }
+    int iterations;
+};
+
+TEST(TaskTest, testCycleStatistics)
+{
+
+    CountingRepetitiveTask task;
+    task.run();
+
+    CycleStatistics::Summary summary = task.getCycleStatistics().getSummary();
+    EXPECT_EQ((boost::uint64_t) 5, summary.count);
+    EXPECT_GE(summary.min, (boost::uint64_t) 2000000);
+    EXPECT_GE(summary.max, summary.min);
+    EXPECT_GE(summary.mean, (double) summary.min);
+    EXPECT_LE(summary.mean, (double) summary.max);
+    EXPECT_GE(task.getCycleStatistics().getPercentile(50), summary.min);
+
+}
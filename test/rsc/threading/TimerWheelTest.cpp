@@ -0,0 +1,153 @@
+/* ============================================================
+ *
+ * This file is a part of RSC project
+ *
+ * Copyright (C) 2026 by Johannes Wienke <jwienke at techfak dot uni-bielefeld dot de>
+ *
+ * This file may be licensed under the terms of the
+ * GNU Lesser General Public License Version 3 (the ``LGPL''),
+ * or (at your option) any later version.
+ *
+ * Software distributed under the License is distributed
+ * on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied. See the LGPL for the specific language
+ * governing rights and limitations.
+ *
+ * You should have received a copy of the LGPL along with this
+ * program. If not, go to http://www.gnu.org/licenses/lgpl.html
+ * or write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ * The development of this software was supported by:
+ *   CoR-Lab, Research Institute for Cognition and Robotics
+ *     Bielefeld University
+ *
+ * ============================================================ */
+
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "rsc/threading/TimerWheel.h"
+
+using namespace std;
+using namespace rsc::threading;
+
+TEST(TimerWheelTest, testEmpty) {
+
+    TimerWheel<int> wheel(10);
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(numeric_limits<boost::uint64_t>::max(), wheel.nextEventTick());
+
+    vector<int> expired;
+    EXPECT_EQ((size_t) 0, wheel.advance(1000, back_inserter(expired)));
+    EXPECT_EQ((boost::uint64_t) 1000, wheel.getCurrentTick());
+
+}
+
+TEST(TimerWheelTest, testExpiryAcrossLevels) {
+
+    TimerWheel<int> wheel(123);
+
+    // expiries in all levels, added out of order
+    const boost::uint64_t expiries[] = { 123 + 70000, 123 + 5, 123 + 300,
+            123 + 256, 123 + 20000000, 123 + 1 };
+    const size_t numExpiries = sizeof(expiries) / sizeof(boost::uint64_t);
+    for (size_t i = 0; i < numExpiries; ++i) {
+        wheel.add(expiries[i], (int) i);
+    }
+    EXPECT_EQ(numExpiries, wheel.size());
+    EXPECT_EQ((boost::uint64_t) 124, wheel.nextEventTick());
+
+    vector<boost::uint64_t> sorted(expiries, expiries + numExpiries);
+    sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < numExpiries; ++i) {
+        vector<int> expired;
+        EXPECT_EQ((size_t) 0, wheel.advance(sorted[i] - 1, back_inserter(expired)));
+        EXPECT_EQ((size_t) 1, wheel.advance(sorted[i], back_inserter(expired)));
+        ASSERT_EQ((size_t) 1, expired.size());
+        EXPECT_EQ(sorted[i], expiries[expired[0]]);
+    }
+    EXPECT_TRUE(wheel.empty());
+
+}
+
+TEST(TimerWheelTest, testExpiryOnCascade) {
+
+    // expiries which are cascaded down on the tick they expire
+    const boost::uint64_t expiries[] = { 256, 512, 65536, 16777216 };
+    for (size_t i = 0; i < sizeof(expiries) / sizeof(boost::uint64_t); ++i) {
+        TimerWheel<int> wheel;
+        wheel.add(expiries[i], 42);
+
+        vector<int> expired;
+        EXPECT_EQ((size_t) 0,
+                wheel.advance(expiries[i] - 1, back_inserter(expired)));
+        EXPECT_EQ((size_t) 1,
+                wheel.advance(expiries[i], back_inserter(expired)));
+        EXPECT_TRUE(wheel.empty());
+    }
+
+    // single tick steps across a cascade
+    TimerWheel<int> wheel;
+    wheel.add(256, 1);
+    wheel.add(257, 2);
+    vector<int> expired;
+    for (boost::uint64_t tick = 1; tick <= 255; ++tick) {
+        EXPECT_EQ((size_t) 0, wheel.advance(tick, back_inserter(expired)));
+    }
+    EXPECT_EQ((size_t) 1, wheel.advance(256, back_inserter(expired)));
+    EXPECT_EQ((size_t) 1, wheel.advance(257, back_inserter(expired)));
+
+}
+
+TEST(TimerWheelTest, testPastExpiry) {
+
+    TimerWheel<int> wheel(100);
+    wheel.add(50, 1);
+    wheel.add(100, 2);
+
+    vector<int> expired;
+    EXPECT_EQ((size_t) 2, wheel.advance(101, back_inserter(expired)));
+    EXPECT_EQ((size_t) 2, expired.size());
+
+}
+
+TEST(TimerWheelTest, testAdvanceInJumps) {
+
+    TimerWheel<int> wheel;
+    for (int i = 0; i < 1000; ++i) {
+        wheel.add(i * 37, i);
+    }
+
+    vector<int> expired;
+    wheel.advance(10000, back_inserter(expired));
+    ASSERT_EQ((size_t) 271, expired.size());
+    for (size_t i = 0; i < expired.size(); ++i) {
+        EXPECT_EQ((int) i, expired[i]);
+    }
+    EXPECT_LE(wheel.nextEventTick(), (boost::uint64_t) 10027);
+
+    expired.clear();
+    wheel.advance(1000000, back_inserter(expired));
+    EXPECT_EQ((size_t) 729, expired.size());
+    EXPECT_TRUE(wheel.empty());
+
+}
+
+TEST(TimerWheelTest, testClear) {
+
+    TimerWheel<int> wheel;
+    wheel.add(3, 1);
+    wheel.add(3000, 2);
+
+    vector<int> removed;
+    EXPECT_EQ((size_t) 2, wheel.clear(back_inserter(removed)));
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ((size_t) 2, removed.size());
+
+}